@@ -20,7 +20,10 @@
 #include <thread>
 #include <sstream>
 #include <atomic>
+#include <chrono>
+#include <ctime>
 #include <regex>
+#include <string>
 
 /**
  * eProsima log layer. Logging categories and verbosities can be specified dynamically at runtime. However, even on a category
@@ -48,6 +51,7 @@ namespace fastdds {
 namespace dds {
 
 class LogConsumer;
+class LogQueue;
 
 /**
  * Logging utilities.
@@ -112,6 +116,21 @@ public:
     RTPS_DllAPI static void SetErrorStringFilter(
             const std::regex&);
 
+    /**
+     * Limits the number of entries logged on each category per second. Entries over the limit are discarded
+     * before being formatted.
+     * @param max_entries_per_second Maximum number of entries per category and second. 0 means no limit,
+     * which is the default.
+     */
+    RTPS_DllAPI static void SetCategoryRateLimit(
+            uint32_t max_entries_per_second);
+
+    /**
+     * Returns the number of entries discarded since the start of the process, either because the queue of
+     * pending entries was full or because of the rate limit of their category.
+     */
+    RTPS_DllAPI static uint64_t GetDroppedEntries();
+
     //! Returns the logging engine to configuration defaults.
     RTPS_DllAPI static void Reset();
 
@@ -151,20 +170,42 @@ public:
             const Log::Context&,
             Log::Kind);
 
+    /**
+     * Not recommended to call this method directly! It is called by the log macros to apply the rate limit
+     * of the category before formatting the message.
+     * @return false if the entry should be discarded.
+     */
+    RTPS_DllAPI static bool AcceptEntry(
+            const char* category);
+
 private:
 
     struct Resources
     {
-        fastrtps::DBQueue<Entry> logs;
+        // Entries pending to be consumed. Producers don't take any lock to add them.
+        std::unique_ptr<LogQueue> logs;
         std::vector<std::unique_ptr<LogConsumer>> consumers;
         std::unique_ptr<std::thread> logging_thread;
 
         // Condition variable segment.
         std::condition_variable cv;
         std::mutex cv_mutex;
-        bool logging;
-        bool work;
-        int current_loop;
+        std::atomic<bool> logging;
+        // Set by the logging thread while it waits for new entries, so producers only take cv_mutex to wake it.
+        std::atomic<bool> waiting;
+        // Number of entries taken from the queue and delivered to the consumers.
+        uint64_t processed;
+
+        // Discarded entries, and the amount already reported by the logging thread.
+        std::atomic<uint64_t> dropped;
+        uint64_t dropped_reported;
+        std::chrono::steady_clock::time_point last_drop_report;
+
+        // Formatted date and time of the last second used by a timestamp.
+        std::time_t timestamp_seconds;
+        std::string timestamp_prefix;
+
+        std::atomic<uint32_t> category_rate_limit;
 
         // Context configuration.
         std::mutex config_mutex;
@@ -191,7 +232,15 @@ private:
 
     static void run();
 
+    // Delivers an entry to the consumers, if accepted by the filters.
+    static void consume(
+            Entry&);
+
+    // Reports the entries discarded since the last report.
+    static void report_dropped_entries();
+
     static void get_timestamp(
+            const std::chrono::system_clock::time_point&,
             std::string&);
 };
 
@@ -243,9 +292,13 @@ protected:
 #define logError_(cat, msg)                                                                                            \
     {                                                                                                                  \
         using namespace eprosima::fastdds::dds;                                                                        \
-        std::stringstream fastdds_log_ss_tmp__;                                                                        \
-        fastdds_log_ss_tmp__ << msg;                                                                                   \
-        Log::QueueLog(fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error); \
+        if (Log::AcceptEntry(#cat))                                                                                    \
+        {                                                                                                              \
+            std::stringstream fastdds_log_ss_tmp__;                                                                    \
+            fastdds_log_ss_tmp__ << msg;                                                                               \
+            Log::QueueLog(                                                                                             \
+                fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, Log::Kind::Error);       \
+        }                                                                                                              \
     }
 #elif (defined(__INTERNALDEBUG) || defined(_INTERNALDEBUG))
 #define logError_(cat, msg)                                     \
@@ -265,7 +318,7 @@ protected:
 #define logWarning_(cat, msg)                                                                                       \
     {                                                                                                               \
         using namespace eprosima::fastdds::dds;                                                                     \
-        if (Log::GetVerbosity() >= Log::Kind::Warning)                                                              \
+        if (Log::GetVerbosity() >= Log::Kind::Warning && Log::AcceptEntry(#cat))                                    \
         {                                                                                                           \
             std::stringstream fastdds_log_ss_tmp__;                                                                 \
             fastdds_log_ss_tmp__ << msg;                                                                            \
@@ -292,7 +345,7 @@ protected:
 #define logInfo_(cat, msg)                                                                              \
     {                                                                                                   \
         using namespace eprosima::fastdds::dds;                                                         \
-        if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
+        if (Log::GetVerbosity() >= Log::Kind::Info && Log::AcceptEntry(#cat))                           \
         {                                                                                               \
             std::stringstream fastdds_log_ss_tmp__;                                                     \
             fastdds_log_ss_tmp__ << msg;                                                                \
@@ -26,6 +26,7 @@
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
 #include <fastdds/dds/core/Entity.hpp>
+#include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 
 #include <fastrtps/types/TypesBase.h>
@@ -68,6 +69,9 @@ class DataReaderQos;
 class TopicDescription;
 struct LivelinessChangedStatus;
 
+//! Special value of max_samples on read and take operations, meaning no limit on the number of returned samples
+constexpr int32_t LENGTH_UNLIMITED = -1;
+
 /**
  * Class DataReader, contains the actual implementation of the behaviour of the Subscriber.
  *  @ingroup FASTDDS_MODULE
@@ -123,12 +127,42 @@ public:
 
     ///@{
 
-    /* TODO
-       RTPS_DllAPI bool read(
-            std::vector<void*>& data_values,
-            std::vector<SampleInfo>& sample_infos,
-            uint32_t max_samples);
+    /**
+     * @brief This operation accesses a collection of Data values from the DataReader. The operation also accesses
+     * the corresponding SampleInfo for each sample. All the samples are accessed with the history locked only once.
+     *
+     * Only samples matching the provided @c sample_states, @c view_states and @c instance_states will be returned,
+     * in the same order as they are stored in the DataReader. The returned samples will be marked as read.
+     *
+     * The behavior depends on the state of @c data_values and @c sample_infos, which should have the same
+     * maximum, length and ownership:
+     * @li If they have ownership and a zero maximum, the DataReader will loan its own buffers to them. Samples of
+     *     plain types will be returned in place, directly from the reader's payload pool, and samples of other types
+     *     will be deserialized into samples preallocated by the DataReader. The application should call
+     *     @ref return_loan once it has finished accessing them.
+     * @li If they have ownership and a maximum greater than zero, samples will be copied into the elements of
+     *     @c data_values, up to its maximum.
+     * @li If they have no ownership, RETCODE_PRECONDITION_NOT_MET is returned.
+     *
+     * @param [in,out] data_values   Collection where the data samples will be returned.
+     * @param [in,out] sample_infos  Sequence where the SampleInfo of each data sample will be returned.
+     * @param [in]     max_samples   Maximum number of samples to return. LENGTH_UNLIMITED returns as many as possible.
+     * @param [in]     sample_states Mask of the sample states of the samples to be returned.
+     * @param [in]     view_states   Mask of the view states of the samples to be returned.
+     * @param [in]     instance_states Mask of the instance states of the samples to be returned.
+     *
+     * @return RETCODE_OK if some samples were returned, RETCODE_NO_DATA if no sample matched the states,
+     *         RETCODE_PRECONDITION_NOT_MET if the collections are not in a valid state, RETCODE_OUT_OF_RESOURCES
+     *         if buffers could not be loaned, RETCODE_TIMEOUT if the history could not be locked,
+     *         RETCODE_NOT_ENABLED if the reader is not enabled.
      */
+    RTPS_DllAPI ReturnCode_t read(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
 
     /**
      * @brief This operation copies the next, non-previously accessed Data value from the DataReader; the operation also
@@ -150,12 +184,47 @@ public:
             void* data,
             SampleInfo* info);
 
-    /* TODO
-       RTPS_DllAPI bool take(
-            std::vector<void*>& data_values,
-            std::vector<SampleInfo>& sample_infos,
-            uint32_t max_samples);
+    /**
+     * @brief This operation accesses a collection of Data values from the DataReader and ‘removes’ them from the
+     * DataReader, so they are no longer accessible. This operation is analogous to @ref read except for the fact
+     * that the samples are ‘removed’ from the DataReader.
+     *
+     * Samples loaned by a take operation remain valid until @ref return_loan is called, even if the DataReader
+     * receives new samples meanwhile.
+     *
+     * @param [in,out] data_values   Collection where the data samples will be returned.
+     * @param [in,out] sample_infos  Sequence where the SampleInfo of each data sample will be returned.
+     * @param [in]     max_samples   Maximum number of samples to return. LENGTH_UNLIMITED returns as many as possible.
+     * @param [in]     sample_states Mask of the sample states of the samples to be returned.
+     * @param [in]     view_states   Mask of the view states of the samples to be returned.
+     * @param [in]     instance_states Mask of the instance states of the samples to be returned.
+     *
+     * @return Same return codes as @ref read.
+     */
+    RTPS_DllAPI ReturnCode_t take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * @brief This operation indicates to the DataReader that the application is done accessing the collections
+     * of @c data_values and @c sample_infos obtained by some earlier invocation of @ref read or @ref take.
+     *
+     * The collections are returned to their initial state: with ownership, and zero maximum and length.
+     * Calling this operation with collections that were not loaned has no effect and returns RETCODE_OK.
+     *
+     * @param [in,out] data_values   Collection of data samples loaned by the DataReader.
+     * @param [in,out] sample_infos  Sequence of SampleInfo loaned by the DataReader.
+     *
+     * @return RETCODE_OK if the loan was returned, RETCODE_PRECONDITION_NOT_MET if the collections were not
+     *         loaned by this DataReader, RETCODE_NOT_ENABLED if the reader is not enabled.
      */
+    RTPS_DllAPI ReturnCode_t return_loan(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos);
 
     /**
      * @brief This operation copies the next, non-previously accessed Data value from the DataReader and ‘removes’ it from
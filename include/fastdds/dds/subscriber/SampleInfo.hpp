@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFO_HPP_
 #define _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFO_HPP_
 
+#include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/subscriber/InstanceState.hpp>
 #include <fastdds/dds/subscriber/SampleState.hpp>
 #include <fastdds/dds/subscriber/ViewState.hpp>
@@ -113,6 +114,11 @@ struct SampleInfo
 
 };
 
+/**
+ * A sequence of SampleInfo, used by the read and take operations of DataReader.
+ */
+FASTDDS_SEQUENCE(SampleInfoSeq, SampleInfo);
+
 }  // namespace dds
 }  // namespace fastdds
 }  // namespace eprosima
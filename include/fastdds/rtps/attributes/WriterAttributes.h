@@ -96,6 +96,7 @@ public:
         , disable_heartbeat_piggyback(false)
         , disable_positive_acks(false)
         , keep_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
+        , late_joiner_replay_budget(65536)
     {
         endpoint.endpointKind = WRITER;
         endpoint.durabilityKind = TRANSIENT_LOCAL;
@@ -138,6 +139,14 @@ public:
 
     //! Keep duration to keep a sample before considering it has been acked
     Duration_t keep_duration;
+
+    /**
+     * Maximum number of bytes of the history replayed to late-joining readers on each turn of the asynchronous
+     * thread. The writer is unlocked between turns, so live changes are not delayed for longer than it takes to
+     * send this amount of data. At least one change is replayed on each turn.
+     * Only configurable on the RTPS layer.
+     */
+    uint32_t late_joiner_replay_budget;
 };
 
 } /* namespace rtps */
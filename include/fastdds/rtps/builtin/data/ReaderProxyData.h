@@ -361,6 +361,24 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Get the properties announced by the endpoint.
+     * @return const reference to the list of properties
+     */
+    const ParameterPropertyList_t& properties() const
+    {
+        return m_properties;
+    }
+
+    /**
+     * Get the properties announced by the endpoint.
+     * @return reference to the list of properties
+     */
+    ParameterPropertyList_t& properties()
+    {
+        return m_properties;
+    }
+
     /**
      * Get the size in bytes of the CDR serialization of this object.
      * @param include_encapsulation Whether to include the size of the encapsulation info.
@@ -386,6 +386,24 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Get the properties announced by the endpoint.
+     * @return const reference to the list of properties
+     */
+    const ParameterPropertyList_t& properties() const
+    {
+        return m_properties;
+    }
+
+    /**
+     * Get the properties announced by the endpoint.
+     * @return reference to the list of properties
+     */
+    ParameterPropertyList_t& properties()
+    {
+        return m_properties;
+    }
+
 #if HAVE_SECURITY
     //!EndpointSecurityInfo.endpoint_security_attributes
     security::EndpointSecurityAttributesMask security_attributes_;
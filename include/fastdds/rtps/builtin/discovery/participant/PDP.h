@@ -23,8 +23,12 @@
 
 #include <mutex>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
@@ -207,6 +211,24 @@ public:
             const GUID_t& writer,
             WriterProxyData& wdata);
 
+    /**
+     * Get the readers on a topic among the registered RTPSParticipants (including the local RTPSParticipant).
+     * The PDP mutex should be taken while the returned collection is used.
+     * @param topic_name Name of the topic.
+     * @return Collection with the proxy data of the readers on the topic.
+     */
+    const std::vector<ReaderProxyData*>& readers_on_topic(
+            const string_255& topic_name) const;
+
+    /**
+     * Get the writers on a topic among the registered RTPSParticipants (including the local RTPSParticipant).
+     * The PDP mutex should be taken while the returned collection is used.
+     * @param topic_name Name of the topic.
+     * @return Collection with the proxy data of the writers on the topic.
+     */
+    const std::vector<WriterProxyData*>& writers_on_topic(
+            const string_255& topic_name) const;
+
     /**
      * This method returns the name of a participant if it is found among the registered RTPSParticipants.
      * @param [in]  guid  GUID_t of the RTPSParticipant we are looking for.
@@ -351,6 +373,17 @@ public:
 
 protected:
 
+    //!Entry of the index of registered RTPSParticipants
+    struct ParticipantEntry
+    {
+        //!Participant proxy data object
+        ParticipantProxyData* proxy = nullptr;
+        //!Length of the last announcement processed for the participant
+        uint32_t announcement_length = 0;
+        //!Digest of the last announcement processed for the participant
+        uint64_t announcement_digest = 0;
+    };
+
     //!Pointer to the builtin protocols object.
     BuiltinProtocols* mp_builtin;
     //!Pointer to the local RTPSParticipant.
@@ -369,6 +402,8 @@ protected:
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_;
     //!Pool of participant proxy data objects ready for reuse
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_pool_;
+    //!Registered RTPSParticipants indexed by their GUID prefix
+    std::unordered_map<GuidPrefix_t, ParticipantEntry> participants_by_prefix_;
     //!Number of reader proxy data objects created
     size_t reader_proxies_number_;
     //!Pool of reader proxy data objects ready for reuse
@@ -377,6 +412,10 @@ protected:
     size_t writer_proxies_number_;
     //!Pool of writer proxy data objects ready for reuse
     ResourceLimitedVector<WriterProxyData*> writer_proxies_pool_;
+    //!Reader proxy data objects of the registered RTPSParticipants, indexed by topic name
+    std::unordered_map<std::string, std::vector<ReaderProxyData*>> readers_by_topic_;
+    //!Writer proxy data objects of the registered RTPSParticipants, indexed by topic name
+    std::unordered_map<std::string, std::vector<WriterProxyData*>> writers_by_topic_;
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
     //!Listener for the SPDP messages.
@@ -413,6 +452,64 @@ protected:
             const GUID_t& participant_guid,
             bool with_lease_duration);
 
+    /**
+     * Removes the endpoints of a participant proxy from the topic indexes.
+     * Should be called with the PDP mutex taken, before the participant proxy is cleared.
+     *
+     * @param pdata participant proxy whose endpoints are removed.
+     */
+    void remove_from_topic_index(
+            const ParticipantProxyData& pdata);
+
+    /**
+     * Looks for a registered participant proxy.
+     * Should be called with the PDP mutex taken.
+     *
+     * @param guid_prefix GUID prefix of the participant to look for.
+     *
+     * @return pointer to the participant proxy, nullptr when it is not registered.
+     */
+    ParticipantProxyData* find_participant_proxy(
+            const GuidPrefix_t& guid_prefix) const;
+
+    /**
+     * Computes the digest used to detect repeated participant announcements.
+     *
+     * @param payload serialized participant announcement.
+     *
+     * @return FNV-1a hash of the payload.
+     */
+    static uint64_t announcement_digest(
+            const SerializedPayload_t& payload);
+
+    /**
+     * Stores the digest of the last announcement processed for a registered participant.
+     * Should be called with the PDP mutex taken.
+     *
+     * @param guid_prefix GUID prefix of the participant.
+     * @param length length of the announcement.
+     * @param digest digest of the announcement, as returned by announcement_digest.
+     */
+    void set_participant_announcement(
+            const GuidPrefix_t& guid_prefix,
+            uint32_t length,
+            uint64_t digest);
+
+    /**
+     * Refreshes the lease of a registered participant when an announcement is equal to the last one processed for it.
+     * Should be called with the PDP mutex taken.
+     *
+     * @param guid GUID of the participant.
+     * @param length length of the announcement.
+     * @param digest digest of the announcement, as returned by announcement_digest.
+     *
+     * @return true when the announcement has not changed and the lease has been refreshed.
+     */
+    bool refresh_unchanged_participant(
+            const GUID_t& guid,
+            uint32_t length,
+            uint64_t digest);
+
     /**
      * Gets the key of a participant proxy data.
      *
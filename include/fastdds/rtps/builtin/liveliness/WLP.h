@@ -21,6 +21,7 @@
 #define _FASTDDS_RTPS_WLP_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <memory>
 #include <vector>
 #include <mutex>
 
@@ -38,6 +39,7 @@ namespace rtps {
 
 class BuiltinProtocols;
 class LivelinessManager;
+struct LivelinessAssertion;
 class ReaderHistory;
 class ReaderProxyData;
 class RTPSParticipantImpl;
@@ -138,6 +140,20 @@ public:
             LivelinessQosPolicyKind kind,
             Duration_t lease_duration);
 
+    /**
+     * @brief A method to assert liveliness of a given writer on its hot path
+     * @param writer The writer, specified via its id
+     * @param kind The writer liveliness kind
+     * @param lease_duration The writer lease duration
+     * @param assertion Assertion of the writer cached by the caller, so it can be asserted without locking
+     * @return True if liveliness was asserted
+     */
+    bool assert_liveliness(
+            GUID_t writer,
+            LivelinessQosPolicyKind kind,
+            Duration_t lease_duration,
+            std::shared_ptr<LivelinessAssertion>& assertion);
+
     /**
      * @brief A method to assert liveliness of MANUAL_BY_PARTICIPANT writers
      * @return True if there were any MANUAL_BY_PARTICIPANT writers
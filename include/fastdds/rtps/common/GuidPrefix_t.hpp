@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <sstream>
 
 namespace eprosima {
@@ -151,4 +152,24 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GuidPrefix_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& k) const
+    {
+        // the prefix is made of the host, process and participant identifiers, so all of them are combined
+        uint32_t words[3];
+        memcpy(words, k.value, sizeof(words));
+        std::size_t ret = words[0];
+        ret = ret * 31 + words[1];
+        ret = ret * 31 + words[2];
+        return ret;
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_COMMON_GUIDPREFIX_T_HPP_ */
@@ -159,6 +159,28 @@ inline bool operator !=(
     return !(ihandle1 == ihandle2);
 }
 
+/*!
+ * @brief Defines the STL hash function for type InstanceHandle_t.
+ *
+ * All the bytes are mixed, as short keys are stored on the handle without being hashed and padded with zeros.
+ */
+struct InstanceHandleHash
+{
+    std::size_t operator ()(
+            const InstanceHandle_t& handle) const noexcept
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (uint8_t i = 0; i < 16; ++i)
+        {
+            hash ^= handle.value[i];
+            hash *= 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+
+};
+
 #endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 /**
@@ -0,0 +1,66 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * A slice of memory that is part of an outgoing message.
+ * The memory is not owned by this structure.
+ * A message is sent as the concatenation of a list of these slices.
+ */
+struct NetworkBuffer
+{
+    NetworkBuffer()
+        : buffer(nullptr)
+        , size(0)
+    {
+    }
+
+    NetworkBuffer(
+            const octet* buf,
+            uint32_t len)
+        : buffer(buf)
+        , size(len)
+    {
+    }
+
+    //! Pointer to the beginning of the slice.
+    const octet* buffer;
+
+    //! Number of bytes on the slice.
+    uint32_t size;
+};
+
+//! List of slices that compose a message.
+using NetworkBuffers = std::vector<NetworkBuffer>;
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
@@ -22,6 +22,22 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
+/**
+ * Scheduling policy of a Throughput Controller.
+ * @ingroup NETWORK_MODULE
+ */
+enum ThroughputControllerKind : uint8_t
+{
+    //! No more than 'bytesPerPeriod' bytes are sent on each window of 'periodMillisecs'.
+    FIXED_WINDOW_THROUGHPUT_CONTROLLER,
+    //! Token bucket refilled at a rate of 'bytesPerPeriod' bytes each 'periodMillisecs', holding up to 'burstBytes'.
+    TOKEN_BUCKET_THROUGHPUT_CONTROLLER,
+    //! Token bucket where writers with a higher priority are always served before writers with a lower one.
+    PRIORITY_THROUGHPUT_CONTROLLER,
+    //! Token bucket where bandwidth is shared among writers proportionally to their weights.
+    FAIR_SHARE_THROUGHPUT_CONTROLLER
+};
+
 /**
  * Descriptor for a Throughput Controller, containing all constructor information
  * for it.
@@ -33,14 +49,25 @@ struct ThroughputControllerDescriptor
     uint32_t bytesPerPeriod;
     //! Window of time in which no more than 'bytesPerPeriod' bytes are allowed.
     uint32_t periodMillisecs;
+    //! Scheduling policy of the controller.
+    ThroughputControllerKind kind;
+    //! Maximum number of bytes that token bucket controllers can send at once. Zero means 'bytesPerPeriod'.
+    uint32_t burstBytes;
 
     RTPS_DllAPI ThroughputControllerDescriptor();
     RTPS_DllAPI ThroughputControllerDescriptor(uint32_t size, uint32_t time);
+    RTPS_DllAPI ThroughputControllerDescriptor(
+            uint32_t size,
+            uint32_t time,
+            ThroughputControllerKind controller_kind,
+            uint32_t burst = 0);
 
     bool operator==(const ThroughputControllerDescriptor& b) const
     {
         return (this->bytesPerPeriod == b.bytesPerPeriod) &&
-               (this->periodMillisecs == b.periodMillisecs);
+               (this->periodMillisecs == b.periodMillisecs) &&
+               (this->kind == b.kind) &&
+               (this->burstBytes == b.burstBytes);
     }
 };
 
@@ -31,6 +31,7 @@
 #include <fastrtps/utils/TimedMutex.hpp>
 
 #include <cassert>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -57,9 +58,15 @@ protected:
 
 public:
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
-    using reverse_iterator = std::vector<CacheChange_t*>::reverse_iterator;
-    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+    /**
+     * Container of the changes of the history.
+     * Changes are usually appended at the back and removed from the front, which takes constant time, and keeping
+     * them ordered allows looking them up by sequence number with a binary search.
+     */
+    using container = std::deque<CacheChange_t*>;
+    using iterator = container::iterator;
+    using reverse_iterator = container::reverse_iterator;
+    using const_iterator = container::const_iterator;
 
     //!Attributes of the History
     HistoryAttributes m_att;
@@ -131,7 +138,7 @@ public:
      * @param ch Pointer to the CacheChange_t to search for.
      * @return an iterator if a suitable change is found
      */
-    RTPS_DllAPI const_iterator find_change_nts(
+    RTPS_DllAPI virtual const_iterator find_change_nts(
             CacheChange_t* ch);
 
     /**
@@ -263,7 +270,16 @@ public:
             const GUID_t& guid,
             CacheChange_t** change) const;
 
-    const_iterator get_change_nts(
+    /**
+     * Find the change with the given sequence number and writer, starting the search on a hint.
+     * No Thread Safe
+     * @param seq Sequence number of the change.
+     * @param guid GUID of the writer of the change.
+     * @param[out] change Pointer to the change if found, nullptr otherwise.
+     * @param hint Iterator where the search starts.
+     * @return iterator to the change if found, or to the next change of the writer otherwise.
+     */
+    virtual const_iterator get_change_nts(
             const SequenceNumber_t& seq,
             const GUID_t& guid,
             CacheChange_t** change,
@@ -279,8 +295,8 @@ public:
 
 protected:
 
-    //!Vector of pointers to the CacheChange_t.
-    std::vector<CacheChange_t*> m_changes;
+    //!Pointers to the CacheChange_t.
+    container m_changes;
 
     //!Variable to know if the history is full without needing to block the History mutex.
     bool m_isHistoryFull = false;
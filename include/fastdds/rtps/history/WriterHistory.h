@@ -91,6 +91,31 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
+    /**
+     * Find a specific change in the history.
+     * Changes are ordered by sequence number, so a binary search is used.
+     * No Thread Safe
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            CacheChange_t* ch) override;
+
+    /**
+     * Find the change with the given sequence number using a binary search.
+     * No Thread Safe
+     * @param seq Sequence number of the change.
+     * @param guid GUID of the writer of the change.
+     * @param[out] change Pointer to the change if found, nullptr otherwise.
+     * @param hint Iterator where the search starts.
+     * @return iterator to the change if found, or to the next change otherwise.
+     */
+    const_iterator get_change_nts(
+            const SequenceNumber_t& seq,
+            const GUID_t& guid,
+            CacheChange_t** change,
+            const_iterator hint) const override;
+
     //! Introduce base class method into scope
     using History::remove_change;
 
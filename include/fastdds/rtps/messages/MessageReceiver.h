@@ -25,6 +25,7 @@
 #include <unordered_map>
 #include <mutex>
 #include <functional>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -74,6 +75,8 @@ private:
     std::mutex mtx_;
     std::vector<RTPSWriter*> associated_writers_;
     std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
+    //! Builtin readers in associated_readers_. They may accept messages from writers they are not matched with.
+    std::vector<RTPSReader*> associated_builtin_readers_;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -138,10 +141,13 @@ private:
     /**
      * Find all readers (in associated_readers_), with the given entity ID, and call the
      * callback provided.
+     * When the entity ID is unknown, only builtin readers, the user readers matched with the writer and those
+     * accepting unmatched writers are called.
      */
     template<typename Functor>
     void findAllReaders(
             const EntityId_t& readerID,
+            const GUID_t& writerGUID,
             const Functor& callback);
 
     /**@name Processing methods.
@@ -126,6 +126,11 @@ public:
             bool expectsInlineQos,
             InlineQosWriter* inlineQos);
 
+    /*
+     * When payload_position is not null, the serialized payload is not copied into msg, although the
+     * submessage length and alignment account for it. The position of msg where the payload should be
+     * inserted is returned on it, or 0 if the submessage does not carry the payload.
+     */
     static bool addSubmessageData(
             CDRMessage_t* msg,
             const CacheChange_t* change,
@@ -133,7 +138,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -152,7 +158,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
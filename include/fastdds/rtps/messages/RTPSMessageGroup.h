@@ -96,6 +96,15 @@ public:
             const uint32_t fragment_number,
             bool expects_inline_qos);
 
+    /**
+     * Checks whether a fragmented change can be sent to the current destinations on a single DATA message,
+     * because the transports reaching all of them allow messages bigger than the ones of the participant.
+     * @param change Reference to the cache change to send.
+     * @return True when the whole change fits on a message to the current destinations.
+     */
+    bool fits_unfragmented(
+            const CacheChange_t& change) const;
+
     /**
      * Adds a HEARTBEAT message to the group.
      * @param first_seq First available sequence number.
@@ -167,8 +176,8 @@ public:
             int32_t count);
 
     inline uint32_t get_current_bytes_processed() const
-    { 
-        return currentBytesSent_ + full_msg_->length; 
+    {
+        return currentBytesSent_ + full_msg_->length + payload_bytes_;
     }
 
     /**
@@ -191,6 +200,8 @@ private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
+    //! INFO_DST and INFO_TS submessages preceding a DATA
+    static constexpr uint32_t info_submessages_size_ = 28;
 
     void reset_to_header();
 
@@ -216,6 +227,8 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    bool append_submessage();
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -251,6 +264,18 @@ private:
     std::chrono::steady_clock::time_point max_blocking_time_point_;
 
     std::unique_ptr<RTPSMessageGroup_t> send_buffer_;
+
+    //! Whether serialized payloads can be sent from the history instead of being copied into the message.
+    bool reference_payloads_;
+
+    //! Sum of the sizes of the payloads referenced by the message being built.
+    uint32_t payload_bytes_;
+
+    //! Position on submessage_msg_ where pending_payload_ should be inserted. 0 when there is none.
+    uint32_t pending_payload_position_;
+
+    //! Payload of the submessage being built, when it is not copied into submessage_msg_.
+    NetworkBuffer pending_payload_;
 };
 
 } /* namespace rtps */
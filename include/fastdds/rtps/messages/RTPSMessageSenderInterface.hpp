@@ -24,6 +24,7 @@
 
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 #include <vector>
 
@@ -71,14 +72,27 @@ class RTPSMessageSenderInterface
          */
         virtual const std::vector<GUID_t>& remote_guids() const = 0;
 
+        /**
+         * Get the maximum size of the messages that the transports of all destinations can carry.
+         *
+         * @return the minimum of the maximum message sizes of the transports reaching the destinations, or 0
+         * when it is unknown and the maximum message size of the participant should be used.
+         */
+        virtual uint32_t max_message_size() const
+        {
+            return 0;
+        }
+
         /**
          * Send a message through this interface.
          *
-         * @param message Pointer to the buffer with the message already serialized.
+         * @param buffers List of slices with the message already serialized.
+         * @param total_bytes Sum of the sizes of all the slices.
          * @param max_blocking_time_point Future timepoint where blocking send should end.
          */
         virtual bool send(
-                CDRMessage_t* message,
+                const NetworkBuffers& buffers,
+                uint32_t total_bytes,
                 std::chrono::steady_clock::time_point& max_blocking_time_point) const = 0;
 };
 
@@ -127,6 +127,15 @@ public:
         return maxMessageSizeBetweenTransports_;
     }
 
+    /**
+     * Gets the maximum message size of the transport that supports a locator.
+     * @param locator Destination locator.
+     * @return The maximum message size of the first registered transport supporting the locator, or the
+     * minimum between all transports when none of them supports it.
+     */
+    uint32_t get_max_message_size(
+            const Locator_t& locator) const;
+
     uint32_t get_min_send_buffer_size()
     {
         return minSendBufferSize_;
@@ -15,6 +15,8 @@
 #ifndef _FASTDDS_RTPS_SENDER_RESOURCE_H
 #define _FASTDDS_RTPS_SENDER_RESOURCE_H
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+
 #include <functional>
 #include <vector>
 #include <chrono>
@@ -54,12 +56,36 @@ public:
         LocatorsIterator* destination_locators_begin,
         LocatorsIterator* destination_locators_end,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        NetworkBuffers buffers(1, NetworkBuffer(data, dataLength));
+        return send(buffers, dataLength, destination_locators_begin, destination_locators_end,
+                max_blocking_time_point);
+    }
+
+    /**
+     * Sends to a destination locator, through the channel managed by this resource.
+     * The message sent is the concatenation of all the buffers, which are not copied when the
+     * transport is able to gather them.
+     * @param buffers List of data slices to be sent.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
+        LocatorsIterator* destination_locators_begin,
+        LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
     {
         bool returned_value = false;
 
         if (send_lambda_)
         {
-            returned_value = send_lambda_(data, dataLength, destination_locators_begin, destination_locators_end, max_blocking_time_point);
+            returned_value = send_lambda_(buffers, total_bytes, destination_locators_begin,
+                            destination_locators_end, max_blocking_time_point);
         }
 
         return returned_value;
@@ -87,7 +113,7 @@ protected:
 
     std::function<void()> clean_up;
     std::function<bool(
-            const octet*,
+            const NetworkBuffers&,
             uint32_t,
             LocatorsIterator* destination_locators_begin,
             LocatorsIterator* destination_locators_end,
@@ -28,11 +28,14 @@
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 #include "../history/ReaderHistory.h"
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
 // Forward declarations
+class DataSharingListener;
 class LivelinessManager;
 class ReaderListener;
 class WriterProxy;
@@ -225,6 +228,32 @@ public:
             CacheChange_t** change,
             WriterProxy** wp) = 0;
 
+    /**
+     * Check whether a CacheChange_t of the history can be returned to the user.
+     * Should be called with the reader mutex taken.
+     * @param change Pointer to the CacheChange_t to be accessed.
+     * @param wp Output reference to the WriterProxy of the writer that sent the change, if any.
+     * @param is_future_change Output flag telling whether the change cannot be accessed yet,
+     *                         because previous changes from the same writer are still missing.
+     * @return False if the writer of the change is no longer matched and the change should be removed.
+     */
+    virtual bool begin_sample_access_nts(
+            CacheChange_t* change,
+            WriterProxy*& wp,
+            bool& is_future_change) = 0;
+
+    /**
+     * Finish the access to a CacheChange_t previously checked with begin_sample_access_nts.
+     * Should be called with the reader mutex taken.
+     * @param change Pointer to the CacheChange_t that was accessed.
+     * @param wp Reference to the WriterProxy returned by begin_sample_access_nts.
+     * @param mark_as_read Whether the change should be marked as read.
+     */
+    void end_sample_access_nts(
+            CacheChange_t* change,
+            WriterProxy*& wp,
+            bool mark_as_read);
+
     RTPS_DllAPI bool wait_for_unread_cache(
             const eprosima::fastrtps::Duration_t& timeout);
 
@@ -255,18 +284,34 @@ public:
     //! The liveliness changed status struct as defined in the DDS
     LivelinessChangedStatus liveliness_changed_status_;
 
-    inline void enableMessagesFromUnkownWriters(
-            bool enable)
-    {
-        m_acceptMessagesFromUnkownWriters = enable;
-    }
+    void enableMessagesFromUnkownWriters(
+            bool enable);
 
     void setTrustedWriter(
-            const EntityId_t& writer)
-    {
-        m_acceptMessagesFromUnkownWriters = false;
-        m_trustedWriterEntityId = writer;
-    }
+            const EntityId_t& writer);
+
+    /**
+     * @return Whether this reader can receive changes through data-sharing.
+     */
+    bool is_datasharing_compatible() const;
+
+    /**
+     * Check whether the changes of a matched writer should be received through data-sharing.
+     * @param wdata Attributes of the writer.
+     * @return True if both endpoints use data-sharing and are on different processes of the same host.
+     */
+    bool is_datasharing_compatible_with(
+            const WriterProxyData& wdata) const;
+
+    /**
+     * Check whether the payload of a change can still be used.
+     * Changes received through data-sharing reference the payload on the writer's memory,
+     * which is recycled once the writer removes the change from its history.
+     * @param change Pointer to the CacheChange_t.
+     * @return True if the payload still belongs to the change.
+     */
+    bool is_sample_valid(
+            const CacheChange_t* change) const;
 
 protected:
 
@@ -341,6 +386,15 @@ protected:
             CacheChange_t** change,
             History::const_iterator hint) const;
 
+    /*!
+     * @brief Get the pool that should hold the payload of a received change.
+     * Payloads received through data-sharing are kept on the writer's pool and referenced in place.
+     * @param payload_owner Pool owning the payload of the received change.
+     * @return Pool where the payload should be taken from.
+     */
+    IPayloadPool* payload_pool_for(
+            IPayloadPool* payload_owner) const;
+
     //!ReaderHistory
     ReaderHistory* mp_history;
     //!Listener
@@ -366,6 +420,9 @@ protected:
     //! The liveliness lease duration of this reader
     Duration_t liveliness_lease_duration_;
 
+    //! Receives the changes of the writers matched through data-sharing
+    std::unique_ptr<DataSharingListener> datasharing_listener_;
+
 private:
 
     RTPSReader& operator =(
@@ -201,6 +201,11 @@ public:
             CacheChange_t** change,
             WriterProxy** wpout = nullptr) override;
 
+    bool begin_sample_access_nts(
+            CacheChange_t* change,
+            WriterProxy*& wp,
+            bool& is_future_change) override;
+
     /**
      * Update the times parameters of the Reader.
      * @param times ReaderTimes reference.
@@ -261,13 +266,15 @@ public:
 
     /**
      * Use the participant of this reader to send a message to certain locator.
-     * @param message Message to be sent.
+     * @param buffers List of slices with the message to be sent.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param locators_begin Destination locators iterator begin.
      * @param locators_end Destination locators iterator end.
      * @param max_blocking_time_point Future time point where any blocking should end.
      */
     bool send_sync_nts(
-            CDRMessage_t* message,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             const Locators& locators_begin,
             const Locators& locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point);
@@ -292,6 +299,14 @@ private:
     void NotifyChanges(
             WriterProxy* wp);
 
+    /**
+     * Get the first sequence number of a data-sharing writer that has not been consumed yet.
+     * Changes still on the history reference their payload on the writer's pool, so they cannot be acknowledged.
+     * @remarks Non thread-safe.
+     */
+    SequenceNumber_t datasharing_acknack_base_nts(
+            const WriterProxy* wp) const;
+
     //! Acknack Count
     uint32_t acknack_count_;
     //! NACKFRAG Count
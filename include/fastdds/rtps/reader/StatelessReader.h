@@ -25,6 +25,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
+#include <memory>
 #include <mutex>
 #include <map>
 
@@ -32,6 +33,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+struct LivelinessAssertion;
+
 /**
  * Class StatelessReader, specialization of the RTPSReader for Best Effort Readers.
  * @ingroup READER_MODULE
@@ -178,6 +181,11 @@ public:
             CacheChange_t** change,
             WriterProxy** wpout = nullptr) override;
 
+    bool begin_sample_access_nts(
+            CacheChange_t* change,
+            WriterProxy*& wp,
+            bool& is_future_change) override;
+
     /**
      * Get the number of matched writers
      * @return Number of matched writers
@@ -214,6 +222,7 @@ private:
         GUID_t persistence_guid;
         bool has_manual_topic_liveliness = false;
         CacheChange_t* fragmented_change = nullptr;
+        std::shared_ptr<LivelinessAssertion> liveliness_assertion;
     };
 
     bool acceptMsgFrom(
@@ -16,17 +16,22 @@
 #define _FASTDDS_RTPS_RESOURCES_ASYNC_INTEREST_TREE_H_
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <functional>
+#include <map>
 #include <mutex>
-#include <set>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
 /*!
- * Used by AsyncWriterThread to manage a double queue.
- * One queue is being processed by AsyncWriterThread's internal thread while in the other one other threads can register
- * RTPSWriter pointers that need to send samples asynchronously.
+ * Ready queue of one of the threads of AsyncWriterThread.
+ * Writers that need to send samples asynchronously are queued in FIFO order on the list of their priority.
+ * On each round, the thread takes all the queued writers and serves them by decreasing priority, so writers with
+ * the same priority are served in round-robin.
+ * Queueing and dequeueing a writer takes constant time, as the list links and the queued flag are stored on the
+ * writer itself.
  */
 class AsyncInterestTree
 {
@@ -35,7 +40,7 @@ class AsyncInterestTree
 public:
 
     /*!
-     * @brief Registers a writer in a hidden queue.
+     * @brief Adds a writer to the back of the list of its priority.
      * @param writer Pointer to the writer.
      * @return true if the writer was queued or false if it already is queued.
      */
@@ -43,7 +48,7 @@ public:
         RTPSWriter* writer);
 
     /*!
-     * @brief Registers a writer in a hidden queue.
+     * @brief Adds a writer to the back of the list of its priority.
      * @param writer Pointer to the writer.
      * @param max_blocking_time Time point until the function must be blocked.
      * @return true if the writer was queued or false if it already is queued.
@@ -54,38 +59,42 @@ public:
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
     /*!
-     * @brief Unregister a writer from both queues.
+     * @brief Removes a writer from the queue.
      * @param writer Pointer to the writer.
-     * @return true if both queues remain empty.
+     * @return true if the queue remains empty.
      */
     bool unregister_interest(
         RTPSWriter* writer);
 
     /*!
-     * @brief Clears the visible queue and swaps with the hidden set.
+     * @brief Removes all the writers from the queue, in the order they should be served.
+     * Writers queued afterwards wait for the next call, so a writer that queues itself again while being served
+     * does not prevent the rest from being served.
+     * @param writers Vector where the writers are returned. It is cleared first.
      */
-    void swap();
-
-    /*!
-     * @brief Remove next writer from visible queue and returns it.
-     * @return Next writer.
-     */
-    RTPSWriter* next_active_nts();
+    void take_all(
+        std::vector<RTPSWriter*>& writers);
 
 private:
 
     bool register_interest_nts(
         RTPSWriter* writer);
 
-    mutable std::timed_mutex mMutexActive, mMutexHidden;
-
-    RTPSWriter* active_front_ = nullptr;
+    //! Intrusive FIFO list of writers with the same priority.
+    struct WriterList
+    {
+        RTPSWriter* front = nullptr;
+        RTPSWriter* back = nullptr;
+    };
 
-    RTPSWriter* hidden_front_ = nullptr;
+    mutable std::timed_mutex mutex_;
 
-    int active_pos_ = 0;
+    //! Lists ordered by decreasing priority. Lists are kept when they become empty, so no allocations are done
+    //! once every priority in use has been seen.
+    std::map<int32_t, WriterList, std::greater<int32_t>> lists_;
 
-    int hidden_pos_ = 1;
+    //! Number of writers on the queue.
+    size_t queued_ = 0;
 };
 
 } /* namespace rtps */
@@ -21,9 +21,13 @@
 
 #include <thread>
 #include <atomic>
+#include <condition_variable>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include <fastdds/rtps/resources/AsyncInterestTree.h>
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
@@ -34,19 +38,63 @@ namespace rtps {
 class RTPSWriter;
 
 /**
- * @brief This static class owns a thread that manages asynchronous writes.
+ * @brief This class owns a pool of threads that manage asynchronous writes.
  * Asynchronous writes happen directly (when using an async writer) and
  * indirectly (when responding to a NACK).
+ *
+ * Each writer is served by one of the threads. Writers are assigned to a thread when registered, either explicitly
+ * through the property returned by thread_property_name(), or automatically: writers limited by the participant
+ * flow controllers share the first thread, and the rest are spread among all threads in round-robin.
+ * Inside a thread, writers are served in rounds: each round serves the writers woken up before it started, by
+ * decreasing priority (property returned by priority_property_name()) and in round-robin among writers with the same
+ * priority. Writers woken up during a round are served on the next one.
  * @ingroup COMMON_MODULE
  */
 class AsyncWriterThread
 {
 public:
 
-    AsyncWriterThread() = default;
+    AsyncWriterThread();
 
     ~AsyncWriterThread();
 
+    //! Name of the participant property with the number of threads of the pool.
+    static const char* threads_property_name()
+    {
+        return "fastdds.async_writer_threads";
+    }
+
+    //! Name of the writer property with the index of the thread that should serve the writer.
+    static const char* thread_property_name()
+    {
+        return "fastdds.async_writer_thread";
+    }
+
+    //! Name of the writer property with the priority of the writer. Higher values are served first.
+    static const char* priority_property_name()
+    {
+        return "fastdds.async_writer_priority";
+    }
+
+    /*!
+     * @brief Sets the number of threads of the pool. Threads are started the first time a writer served by them
+     * is woken up.
+     * @param participant_properties Properties of the participant.
+     * @note Should be called before any writer is registered.
+     */
+    void init(
+        const PropertyPolicy& participant_properties);
+
+    /*!
+     * @brief Assigns a writer to one of the threads of the pool and sets its priority.
+     * @param writer Asynchronous writer to be registered.
+     * @param uses_participant_flow_controllers Whether the writer is limited by the participant flow controllers.
+     * @note Should be called before the writer is woken up for the first time.
+     */
+    void register_writer(
+        RTPSWriter* writer,
+        bool uses_participant_flow_controllers);
+
     /*!
      * @brief Unregister a writer if it is waiting to be processed.
      * @param writer Asynchronous writer to be removed.
@@ -57,14 +105,14 @@ public:
         RTPSWriter* writer);
 
     /*!
-     * Wakes the thread up and starts processing async writers.
+     * Wakes the thread of the writer up and starts processing async writers.
      * @param interested_writer The writer interested in an async write.
      */
     void wake_up(
         RTPSWriter* interested_writer);
 
     /*!
-     * Wakes the thread up and starts processing async writers.
+     * Wakes the thread of the writer up and starts processing async writers.
      * @param interested_writer The writer interested in an async write.
      * @param max_blocking_time Time point until the function must be blocked.
      * @note This method is blocked for a period of time.
@@ -78,18 +126,51 @@ private:
     AsyncWriterThread(const AsyncWriterThread&) = delete;
     const AsyncWriterThread& operator=(const AsyncWriterThread&) = delete;
 
-    //! @brief runs main method
-    void run();
+    //! One of the threads of the pool, with its own ready queue.
+    struct Worker
+    {
+        std::thread* thread = nullptr;
+        RecursiveTimedMutex condition_variable_mutex;
 
-    std::thread* thread_ = nullptr;
-    RecursiveTimedMutex condition_variable_mutex_;
+        //! Protects the writers of the current round and the writer being processed.
+        std::mutex processing_mutex;
+
+        //! Notified when the processing of a writer finishes.
+        std::condition_variable processing_cv;
+
+        //! Writers taken from the queue on the current round. Unregistered writers are replaced by nullptr.
+        std::vector<RTPSWriter*> round;
+
+        //! Writer being processed right now, if any.
+        RTPSWriter* processing_writer = nullptr;
+
+        //! Queue of asynchronous writers.
+        AsyncInterestTree interest_tree;
+
+        bool running = false;
+        bool run_scheduled = false;
+        TimedConditionVariable cv;
+    };
+
+    //! @brief Marks a worker as scheduled, starting its thread if necessary. Lock should be held.
+    void schedule_nts(
+        Worker& worker);
+
+    //! @brief Processes the writers queued on a worker when the round starts.
+    void process_round(
+        Worker& worker);
+
+    //! @brief runs main method of a worker
+    void run(
+        Worker* worker);
+
+    Worker& worker_of(
+        RTPSWriter* writer);
 
-    //! List of asynchronous writers.
-    AsyncInterestTree interestTree_;
+    std::vector<std::unique_ptr<Worker>> workers_;
 
-    bool running_ = false;
-    bool run_scheduled_ = false;
-    TimedConditionVariable cv_;
+    //! Index of the thread to be assigned to the next writer without an explicit assignment.
+    std::atomic<uint32_t> next_thread_index_;
 };
 
 } // namespace rtps
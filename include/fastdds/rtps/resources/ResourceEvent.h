@@ -27,6 +27,8 @@
 
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <vector>
 
 namespace eprosima {
@@ -117,8 +119,36 @@ private:
     //! Collection of events pending update action.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
+    //! Collection of events whose expiration was reached on the current round.
+    std::vector<TimedEventImpl*> expired_timers_;
+
+    //! Number of bits of the tick used to select a slot on each level of the timer wheel.
+    static constexpr uint32_t wheel_slot_bits_ = 8u;
+
+    //! Number of slots on each level of the timer wheel.
+    static constexpr uint32_t wheel_slots_ = 1u << wheel_slot_bits_;
+
+    //! Number of levels of the timer wheel.
+    static constexpr uint32_t wheel_levels_ = 4u;
+
+    /*!
+     * Hierarchical timer wheel holding the events waiting completion.
+     * Each slot is the head of an intrusive list of TimedEventImpl objects.
+     * Level 0 slots hold one tick each, and each slot on level N spans a whole rotation of level N-1.
+     */
+    TimedEventImpl* wheel_[wheel_levels_][wheel_slots_] = {};
+
+    //! Bitmap of the non-empty slots of each level of the timer wheel.
+    uint32_t wheel_bitmap_[wheel_levels_][wheel_slots_ / 32u] = {};
+
+    //! Events expiring beyond the range covered by the timer wheel.
+    TimedEventImpl* wheel_overflow_ = nullptr;
+
+    //! Last tick processed by the timer wheel.
+    uint64_t wheel_tick_ = 0;
+
+    //! Time point corresponding to tick 0 of the timer wheel.
+    std::chrono::steady_clock::time_point wheel_origin_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -135,23 +165,66 @@ private:
     bool register_timer_nts(
             TimedEventImpl* event);
 
+    /*!
+     * @brief Removes a TimedEventImpl object from the internal queue to be processed.
+     * Non thread safe.
+     * @param event Event to be removed from the queue.
+     * @return True value if the event was on the queue. In other case, it return False.
+     */
+    bool unregister_timer_nts(
+            TimedEventImpl* event);
+
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
-
     //! Updates internal register of current time.
     void update_current_time();
 
     //! Method called by the internal thread to process due actions.
     void do_timer_actions();
 
+    /*!
+     * @brief Adds an event to the timer wheel, using its next trigger time.
+     * @param event Event to be scheduled.
+     */
+    void wheel_schedule(
+            TimedEventImpl* event);
+
+    /*!
+     * @brief Links an event on the slot of the timer wheel corresponding to its expiration tick.
+     * @param event Event to be linked. Its expiration tick should not be lower than the current tick.
+     */
+    void wheel_link(
+            TimedEventImpl* event);
+
+    /*!
+     * @brief Unlinks an event from the timer wheel, in case it is on it.
+     * @param event Event to be unlinked.
+     * @return true if the event was on the timer wheel.
+     */
+    bool wheel_unlink(
+            TimedEventImpl* event);
+
+    /*!
+     * @brief Advances the timer wheel up to a tick, moving the expired events to expired_timers_.
+     * @param tick Tick to advance to.
+     */
+    void wheel_advance(
+            uint64_t tick);
+
+    /*!
+     * @brief Calculates the next tick on which the timer wheel has some work to do.
+     * @param [out] tick Next tick with work to do.
+     * @return false if the timer wheel is empty.
+     */
+    bool wheel_next_tick(
+            uint64_t& tick) const;
+
     //! Ensures internal collections can accommodate current total number of timers.
     void resize_collections()
     {
         pending_timers_.reserve(timers_count_);
-        active_timers_.reserve(timers_count_);
+        expired_timers_.reserve(timers_count_);
     }
 
 };
@@ -76,7 +76,8 @@ protected:
 #if TLS_FOUND
     asio::ssl::context ssl_context_;
 #endif
-    std::shared_ptr<std::thread> io_service_thread_;
+    //! Threads running io_service_, which serve the acceptors and the non secure connections
+    std::vector<std::thread> io_service_threads_;
     std::shared_ptr<std::thread> io_service_timers_thread_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
@@ -141,6 +142,53 @@ protected:
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    //! Sends the connection request of a new channel, or waits for the request of the remote side.
+    bool begin_listen_operation(
+            std::shared_ptr<TCPChannelResource>& channel,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager);
+
+    //! Starts receiving the messages of a new non secure channel on the threads running io_service_.
+    void start_async_listen_operation(
+            std::shared_ptr<TCPChannelResource>& channel,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager);
+
+    //! State of the asynchronous reception on a channel.
+    struct AsyncReceiveOperation;
+
+    void async_read_header(
+            const std::shared_ptr<AsyncReceiveOperation>& operation);
+
+    void async_read_body(
+            const std::shared_ptr<AsyncReceiveOperation>& operation);
+
+    void async_discard_body(
+            const std::shared_ptr<AsyncReceiveOperation>& operation,
+            size_t remaining);
+
+    //! Closes the channel of an asynchronous reception, unless it has been reconnected with another socket.
+    void close_async_receive_channel(
+            const std::shared_ptr<AsyncReceiveOperation>& operation);
+
+    /**
+     * Processes a message received on a channel after its TCP header.
+     * RTCP control messages are processed here, and the logical port of the remote locator is set for the rest.
+     * @return true when the message should be delivered to the receiver of its logical port.
+     */
+    bool process_tcp_message(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            fastrtps::rtps::octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            fastrtps::rtps::Locator_t& remote_locator);
+
+    //! Delivers a message to the receiver of the logical port of the remote locator.
+    void deliver_tcp_message(
+            std::shared_ptr<TCPChannelResource>& channel,
+            const fastrtps::rtps::octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            const fastrtps::rtps::Locator_t& remote_locator);
+
     bool read_body(
         fastrtps::rtps::octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -82,7 +82,8 @@ public:
         uint32_t maxMsgSize,
         const fastrtps::rtps::Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver);
+        TransportReceiverInterface* receiver,
+        uint32_t receive_batch_size = 1);
 
     virtual ~UDPChannelResource() override;
 
@@ -152,6 +153,15 @@ protected:
     void perform_listen_operation(
             fastrtps::rtps::Locator_t input_locator);
 
+    /**
+     * Function to be called from a new thread, which takes cares of performing blocking receive
+     * operations that read several datagrams at once into a ring of preallocated buffers.
+     * Falls back to perform_listen_operation on platforms without recvmmsg.
+     * @param input_locator - Locator that triggered the creation of the resource
+    */
+    void perform_batch_listen_operation(
+            fastrtps::rtps::Locator_t input_locator);
+
     /**
     * Blocking Receive from the specified channel.
     * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
@@ -173,6 +183,7 @@ private:
     bool only_multicast_purpose_;
     std::string interface_;
     UDPTransportInterface* transport_;
+    uint32_t receive_batch_size_; //Maximum number of datagrams read by a single receive operation
 
     UDPChannelResource(const UDPChannelResource&) = delete;
     UDPChannelResource& operator=(const UDPChannelResource&) = delete;
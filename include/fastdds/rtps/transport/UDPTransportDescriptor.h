@@ -53,6 +53,25 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
     * datagram. This may hinder performance on high-frequency writers.
     */
    bool non_blocking_send = false;
+
+   /**
+    * Number of listening threads, each one with its own socket, created for every unicast input port.
+    *
+    * When greater than 1, the sockets share the port through SO_REUSEPORT and the kernel distributes the
+    * incoming datagrams among them, so bursts are drained by several threads. Datagrams coming from the
+    * same remote socket are always delivered to the same listening thread.
+    * Only supported on Linux. Multicast ports always use a single listening thread.
+    */
+   uint32_t listen_threads = 1;
+
+   /**
+    * Maximum number of datagrams read from the socket by a single receive operation.
+    *
+    * When greater than 1, the listening threads use recvmmsg to read several datagrams per system call
+    * into a ring of preallocated buffers.
+    * Only supported on Linux. On other platforms datagrams are read one by one.
+    */
+   uint32_t receive_batch_size = 1;
 } UDPTransportDescriptor;
 
 } // namespace rtps
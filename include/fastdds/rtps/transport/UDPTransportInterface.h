@@ -16,6 +16,7 @@
 #define _FASTDDS_UDP_TRANSPORT_INTERFACE_H_
 
 #include <asio.hpp>
+#include <chrono>
 #include <thread>
 
 #include <fastdds/rtps/transport/TransportInterface.h>
@@ -36,6 +37,16 @@ class UDPTransportInterface : public TransportInterface
 {
 public:
 
+    /**
+     * Information kept for each output socket in order to avoid redundant system calls on the send path.
+     * It is owned by the sender resource of the socket, which serializes the calls that use it.
+     */
+    struct SocketSendState
+    {
+        //! Value of SO_SNDTIMEO currently configured on the socket. Negative when it is unknown.
+        std::chrono::microseconds timeout{-1};
+    };
+
     virtual ~UDPTransportInterface() override;
 
     void clean();
@@ -96,10 +107,11 @@ public:
     /**
      * Blocking Send through the specified channel. In both modes, using a localLocator of 0.0.0.0 will
      * send through all whitelisted interfaces provided the channel is open.
-     * @param send_buffer Slice into the raw data to send.
-     * @param send_buffer_size Size of the raw data. It will be used as a bounds check for the previous argument.
+     * @param buffers List of slices of raw data to send. They are sent as a single datagram.
+     * @param total_bytes Sum of the sizes of all the slices.
      * It must not exceed the send_buffer_size fed to this class during construction.
      * @param socket channel we're sending from.
+     * @param send_state information kept for the socket between calls.
      * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
      * so should not be reuse.
      * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
@@ -108,9 +120,10 @@ public:
      * @param max_blocking_time_point maximum blocking time.
      */
     virtual bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             eProsimaUDPSocket& socket,
+            SocketSendState& send_state,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             bool only_multicast_purpose,
@@ -227,11 +240,13 @@ protected:
             const fastrtps::rtps::Locator_t& locator,
             bool is_multicast,
             uint32_t maxMsgSize,
-            TransportReceiverInterface* receiver);
+            TransportReceiverInterface* receiver,
+            bool reuse_port);
     virtual eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) = 0;
+            bool is_multicast,
+            bool reuse_port) = 0;
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
             uint16_t& port);
@@ -244,16 +259,41 @@ protected:
             eProsimaUDPSocket&,
             const std::string&) = 0;
 
+    /**
+     * Configures the blocking time of the send operations on a socket.
+     * The timeout is rounded down to a power of two microseconds, so the option is only set on the socket
+     * when the rounded value changes.
+     * @param socket Socket to configure.
+     * @param send_state Information kept for the socket, holding the value currently configured.
+     * @param timeout Maximum blocking time. Non positive values mean no timeout.
+     */
+    void configure_send_timeout(
+            eProsimaUDPSocket& socket,
+            SocketSendState& send_state,
+            std::chrono::microseconds timeout);
+
     /**
      * Send a buffer to a destination
      */
     bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             eProsimaUDPSocket& socket,
             const fastrtps::rtps::Locator_t& remote_locator,
-            bool only_multicast_purpose,
-            const std::chrono::microseconds& timeout);
+            bool only_multicast_purpose);
+
+#if defined(__linux__)
+    /**
+     * Send a buffer to all the destinations, using a single sendmmsg system call for each batch of them.
+     */
+    bool send_batch(
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose);
+#endif // if defined(__linux__)
 };
 
 } // namespace rtps
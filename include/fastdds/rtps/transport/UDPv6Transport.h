@@ -125,7 +125,8 @@ protected:
     eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) override;
+            bool is_multicast,
+            bool reuse_port) override;
 
     //! Checks for whether locator is allowed.
     virtual bool is_locator_allowed(
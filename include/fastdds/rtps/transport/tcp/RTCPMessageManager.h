@@ -143,6 +143,19 @@ public:
 
     static uint32_t& addToCRC(uint32_t &crc, fastrtps::rtps::octet data);
 
+    /**
+     * Adds a block of data to a CRC. The result is the same as adding its octets one by one, but the octets are
+     * summed on a wide accumulator that the compiler can vectorize, and the carries are folded once at the end.
+     * @param crc CRC of the previous data.
+     * @param data Pointer to the data to add.
+     * @param size Number of octets to add.
+     * @return The CRC including the data.
+     */
+    static uint32_t addToCRC(
+            uint32_t crc,
+            const fastrtps::rtps::octet* data,
+            size_t size);
+
     void dispose()
     {
         alive_.store(false);
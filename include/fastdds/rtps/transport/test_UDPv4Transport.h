@@ -40,9 +40,10 @@ public:
             const test_UDPv4TransportDescriptor& descriptor);
 
     virtual bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             eProsimaUDPSocket& socket,
+            SocketSendState& send_state,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             bool only_multicast_purpose,
@@ -107,12 +108,12 @@ private:
             PercentageData* percentage);
 
     bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
+            const std::vector<fastrtps::rtps::octet>& flat_buffer,
             eProsimaUDPSocket& socket,
             const fastrtps::rtps::Locator_t& remote_locator,
-            bool only_multicast_purpose,
-            const std::chrono::microseconds& timeout);
+            bool only_multicast_purpose);
 };
 
 } // namespace rtps
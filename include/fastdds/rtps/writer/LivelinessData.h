@@ -21,12 +21,29 @@
 #include <fastrtps/qos/QosPolicies.h>
 #include <fastdds/rtps/common/Time_t.h>
 
+#include <atomic>
 #include <chrono>
+#include <memory>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * @brief Last assertion of a group of writers, which can be updated without locking the LivelinessManager
+ * @details Writers with MANUAL_BY_TOPIC liveliness have their own group, while writers with AUTOMATIC or
+ * MANUAL_BY_PARTICIPANT liveliness share the group of their kind, as asserting one of them asserts all of them.
+ * @ingroup WRITER_MODULE
+ */
+struct LivelinessAssertion
+{
+    //! Time of the last assertion, in nanoseconds of the steady clock
+    std::atomic<int64_t> time_ns{0};
+
+    //! True while all the writers of the group are alive, so asserting them does not change their status
+    std::atomic<bool> all_alive{false};
+};
+
 /**
  * @brief A struct keeping relevant liveliness information of a writer
  * @ingroup WRITER_MODULE
@@ -108,8 +125,11 @@ struct LivelinessData
     //! The writer status
     WriterStatus status;
 
-    //! The time when the writer will lose liveliness
+    //! The time when the writer will lose liveliness, unless its group has been asserted afterwards
     std::chrono::steady_clock::time_point time;
+
+    //! The group of writers asserted together with this one
+    std::shared_ptr<LivelinessAssertion> assertion;
 };
 
 } /* namespace rtps */
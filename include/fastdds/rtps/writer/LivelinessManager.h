@@ -22,6 +22,7 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <memory>
 #include <mutex>
 
 namespace eprosima {
@@ -102,6 +103,22 @@ public:
             LivelinessQosPolicyKind kind,
             Duration_t lease_duration);
 
+    /**
+     * @brief Asserts liveliness of a writer in the set, without locking when its status does not change
+     * @details When all the writers asserted by this writer are alive, only the time of the assertion is stored,
+     * and the timer checks it when it expires. Otherwise, the writer is asserted as in the method above.
+     * @param guid The writer to assert liveliness of
+     * @param kind The kind of the writer
+     * @param lease_duration The lease duration
+     * @param assertion Assertion of the writer, cached by the caller. It is filled when it is empty.
+     * @return True if liveliness was successfully asserted
+     */
+    bool assert_liveliness(
+            GUID_t guid,
+            LivelinessQosPolicyKind kind,
+            Duration_t lease_duration,
+            std::shared_ptr<LivelinessAssertion>& assertion);
+
     /**
      * @brief Asserts liveliness of writers with given liveliness kind
      * @param kind Liveliness kind
@@ -127,8 +144,38 @@ private:
 
     //! @brief A method responsible for invoking the callback when liveliness is asserted
     //! @param writer The liveliness data of the writer asserting liveliness
-    //!
-    void assert_writer_liveliness(LivelinessData& writer);
+    //! @param now Time of the assertion
+    //! @return True if the status of the writer changed
+    bool assert_writer_liveliness(
+            LivelinessData& writer,
+            const std::chrono::steady_clock::time_point& now);
+
+    //! @brief Asserts liveliness of a writer, and of the writers of its kind if it is not MANUAL_BY_TOPIC
+    //! @param writer The liveliness data of the writer
+    //! @return True if liveliness was successfully asserted
+    bool assert_liveliness_nts(
+            LivelinessData& writer);
+
+    //! @brief Restarts the timer if the status of a writer changed, as it may expire earlier
+    //! @param status_changed Whether the status of any writer changed
+    //! @return True if at least one writer is alive
+    bool restart_timer_if_needed(
+            bool status_changed);
+
+    //! @brief Sets the interval of the timer so it expires when the timer owner does
+    void update_timer_interval();
+
+    //! @brief Moves the expiration of the alive writers according to the assertions done without locking
+    void update_times_from_assertions();
+
+    //! @brief Updates whether each group of writers can be asserted without locking
+    void update_assertions();
+
+    //! @brief Gets the group of writers shared by writers of a kind
+    //! @param kind The liveliness kind
+    //! @return The group of the kind, or a new group for MANUAL_BY_TOPIC writers
+    std::shared_ptr<LivelinessAssertion> assertion_for(
+            LivelinessQosPolicyKind kind) const;
 
     /**
      * @brief A method to calculate the time when the next writer is going to lose liveliness
@@ -163,6 +210,12 @@ private:
     //! A vector of liveliness data
     ResourceLimitedVector<LivelinessData> writers_;
 
+    //! The group of writers with automatic liveliness
+    std::shared_ptr<LivelinessAssertion> automatic_assertion_;
+
+    //! The group of writers with manual by participant liveliness
+    std::shared_ptr<LivelinessAssertion> manual_by_participant_assertion_;
+
     //! A mutex to protect the liveliness data
     std::mutex mutex_;
 
@@ -41,7 +41,9 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class WriterPool;
 struct CacheChange_t;
+struct LivelinessAssertion;
 
 /**
  * Class RTPSWriter, manages the sending of data to the readers. Is always associated with a HistoryCache.
@@ -53,6 +55,7 @@ class RTPSWriter : public Endpoint, public RTPSMessageSenderInterface
     friend class RTPSParticipantImpl;
     friend class RTPSMessageGroup;
     friend class AsyncInterestTree;
+    friend class AsyncWriterThread;
 
 protected:
 
@@ -370,6 +373,19 @@ public:
      */
     const Duration_t& get_liveliness_announcement_period() const;
 
+    /**
+     * @return Whether this writer can deliver changes through data-sharing.
+     */
+    bool is_datasharing_compatible() const;
+
+    /**
+     * Check whether the changes should be delivered to a matched reader through data-sharing.
+     * @param rdata Attributes of the reader.
+     * @return True if both endpoints use data-sharing and are on different processes of the same host.
+     */
+    bool is_datasharing_compatible_with(
+            const ReaderProxyData& rdata) const;
+
     //! Liveliness lost status of this writer
     LivelinessLostStatus liveliness_lost_status_;
 
@@ -403,14 +419,24 @@ public:
      */
     const std::vector<GUID_t>& remote_guids() const override;
 
+    /**
+     * Get the maximum size of the messages that the transports of all destinations can carry.
+     *
+     * @return the minimum of the maximum message sizes of the transports reaching the destinations, or 0
+     * when it is unknown and the maximum message size of the participant should be used.
+     */
+    uint32_t max_message_size() const override;
+
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices with the message already serialized.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
-            CDRMessage_t* message,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 protected:
@@ -437,6 +463,11 @@ protected:
     Duration_t liveliness_lease_duration_;
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
+    //! Cached by the liveliness manager to assert the liveliness of this writer without locking
+    std::shared_ptr<LivelinessAssertion> liveliness_assertion_;
+
+    //! Shared memory pool used to deliver changes through data-sharing, when enabled
+    std::shared_ptr<WriterPool> datasharing_pool_;
 
     void add_guid(
             const GUID_t& remote_guid);
@@ -472,7 +503,18 @@ private:
             const std::shared_ptr<IChangePool>& change_pool);
 
 
-    RTPSWriter* next_[2] = { nullptr, nullptr };
+    //! Links of the writer on the ready queue of its asynchronous thread.
+    RTPSWriter* async_next_ = nullptr;
+    RTPSWriter* async_prev_ = nullptr;
+
+    //! Whether the writer is on the ready queue of its asynchronous thread.
+    bool async_queued_ = false;
+
+    //! Index of the asynchronous thread that sends the samples of this writer.
+    uint32_t async_thread_index_ = 0;
+
+    //! Priority of this writer on the ready queue of its asynchronous thread. Higher values are served first.
+    int32_t async_priority_ = 0;
 };
 
 } /* namespace rtps */
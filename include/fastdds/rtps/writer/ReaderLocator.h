@@ -20,6 +20,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <memory>
 #include <vector>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/Guid.h>
@@ -34,6 +35,7 @@ namespace rtps {
 class RTPSParticipantImpl;
 class RTPSWriter;
 class RTPSReader;
+class DataSharingNotification;
 
 /**
  * Class ReaderLocator, contains information about a remote reader, without saving its state.
@@ -68,6 +70,14 @@ public:
         return is_local_reader_;
     }
 
+    /**
+     * @return Whether the remote reader receives the changes through data-sharing.
+     */
+    bool is_datasharing_reader() const
+    {
+        return is_datasharing_reader_;
+    }
+
     RTPSReader* local_reader();
 
     void local_reader(
@@ -93,6 +103,7 @@ public:
      * @param unicast_locators    Unicast locators of the remote reader.
      * @param multicast_locators  Multicast locators of the remote reader.
      * @param expects_inline_qos  Whether remote reader expects to receive inline QoS.
+     * @param is_datasharing      Whether the remote reader should receive the changes through data-sharing.
      *
      * @return false when this object was already started, true otherwise.
      */
@@ -100,7 +111,8 @@ public:
             const GUID_t& remote_guid,
             const ResourceLimitedVector<Locator_t>& unicast_locators,
             const ResourceLimitedVector<Locator_t>& multicast_locators,
-            bool expects_inline_qos);
+            bool expects_inline_qos,
+            bool is_datasharing = false);
 
     /**
      * Try to update information of this object.
@@ -168,16 +180,31 @@ public:
         return guid_as_vector_;
     }
 
+    /**
+     * Get the maximum size of the messages that the transports of all destinations can carry.
+     *
+     * @return the minimum of the maximum message sizes of the transports reaching the destinations, or 0
+     * when it is unknown and the maximum message size of the participant should be used.
+     */
+    uint32_t max_message_size() const override;
+
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices with the message already serialized.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
-            CDRMessage_t* message,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
+    /**
+     * Wake up the remote data-sharing reader, so it reads the new changes of the writer.
+     */
+    void datasharing_notify();
+
 private:
 
     RTPSWriter* owner_;
@@ -186,6 +213,8 @@ private:
     bool expects_inline_qos_;
     bool is_local_reader_;
     RTPSReader* local_reader_;
+    bool is_datasharing_reader_;
+    std::shared_ptr<DataSharingNotification> datasharing_notifier_;
     std::vector<GuidPrefix_t> guid_prefix_as_vector_;
     std::vector<GUID_t> guid_as_vector_;
 };
@@ -73,9 +73,11 @@ public:
     /**
      * Activate this proxy associating it to a remote reader.
      * @param reader_attributes ReaderProxyData of the reader for which to keep state.
+     * @param is_datasharing Whether the reader should receive the changes through data-sharing.
      */
     void start(
-            const ReaderProxyData& reader_attributes);
+            const ReaderProxyData& reader_attributes,
+            bool is_datasharing = false);
 
     /**
      * Update information about the remote reader.
@@ -104,6 +106,59 @@ public:
             bool restart_nack_supression,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Start replaying the history to this reader.
+     * The changes on the replayed range are added later, in batches, by add_replayed_change. Until then they are
+     * considered unacknowledged, but they are not informed as holes.
+     * @param first Sequence number of the first change to replay.
+     * @param end Sequence number following the last change to replay.
+     */
+    void start_replay(
+            const SequenceNumber_t& first,
+            const SequenceNumber_t& end);
+
+    /**
+     * Add the next change of the history being replayed.
+     * @param change Information regarding the change. Its sequence number should not be below replay_next().
+     */
+    void add_replayed_change(
+            const ChangeForReader_t& change);
+
+    /**
+     * Mark the changes of the history being replayed as added up to a sequence number.
+     * Those not added by add_replayed_change are considered holes.
+     * @param seq_num Sequence number of the first change not added yet.
+     */
+    void replayed_up_to(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * Check if there are changes of the history still pending to be replayed to this reader.
+     * @return true when the replay of the history has not finished.
+     */
+    inline bool replay_pending() const
+    {
+        return replay_next_ < replay_end_;
+    }
+
+    /**
+     * Get the sequence number of the next change of the history to replay.
+     * @return the sequence number of the next change to replay.
+     */
+    inline SequenceNumber_t replay_next() const
+    {
+        return replay_next_;
+    }
+
+    /**
+     * Get the sequence number following the last change of the history to replay.
+     * @return the sequence number following the last change to replay.
+     */
+    inline SequenceNumber_t replay_end() const
+    {
+        return replay_end_;
+    }
+
     /**
      * Check if there are changes pending for this reader.
      * @return true when there are pending changes, false otherwise.
@@ -170,7 +225,8 @@ public:
             {
                 // Holes before this change are informed as irrelevant.
                 SequenceNumber_t change_seq = it->getSequenceNumber();
-                for (; current_seq < change_seq; ++current_seq)
+                for (current_seq = skip_pending_replay(current_seq); current_seq < change_seq;
+                        current_seq = skip_pending_replay(current_seq + 1))
                 {
                     f(current_seq, nullptr);
                 }
@@ -185,7 +241,8 @@ public:
             }
 
             // After the last change has been checked, there may be a hole at the end.
-            for (; current_seq < max_seq; ++current_seq)
+            for (current_seq = skip_pending_replay(current_seq); current_seq < max_seq;
+                    current_seq = skip_pending_replay(current_seq + 1))
             {
                 f(current_seq, nullptr);
             }
@@ -193,7 +250,8 @@ public:
         else
         {
             // This may be entered if all changes where removed before being acknowledged.
-            for (SequenceNumber_t seq = changes_low_mark_ + 1; seq < max_seq; ++seq)
+            for (SequenceNumber_t seq = skip_pending_replay(changes_low_mark_ + 1); seq < max_seq;
+                    seq = skip_pending_replay(seq + 1))
             {
                 f(seq, nullptr);
             }
@@ -317,6 +375,23 @@ public:
         return locator_info_.local_reader();
     }
 
+    /**
+     * Check if the reader receives the changes through data-sharing.
+     * @return true if the reader is a data-sharing reader.
+     */
+    inline bool is_datasharing_reader() const
+    {
+        return locator_info_.is_datasharing_reader();
+    }
+
+    /**
+     * Wake up the data-sharing reader represented by this proxy.
+     */
+    inline void datasharing_notify()
+    {
+        locator_info_.datasharing_notify();
+    }
+
     /**
      * Called when an ACKNACK is received to set a new value for the count of the last received ACKNACK.
      * @param acknack_count The count of the received ACKNACK.
@@ -433,12 +508,27 @@ private:
     uint32_t last_nackfrag_count_;
 
     SequenceNumber_t changes_low_mark_;
+    //! Next change of the history to replay. Changes from here up to replay_end_ are not on changes_for_reader_ yet.
+    SequenceNumber_t replay_next_;
+    //! Sequence number following the last change of the history to replay.
+    SequenceNumber_t replay_end_;
 
     using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
     using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
 
     void disable_timers();
 
+    /**
+     * Skip the changes of the history pending to be replayed, as they are not holes.
+     * @param seq_num Sequence number to check.
+     * @return seq_num, or the sequence number following the replayed range when seq_num is on it.
+     */
+    SequenceNumber_t skip_pending_replay(
+            const SequenceNumber_t& seq_num) const
+    {
+        return (replay_next_ <= seq_num && seq_num < replay_end_) ? replay_end_ : seq_num;
+    }
+
     /*
      * Converts all changes with a given status to a different status.
      * @param previous Status to change.
@@ -152,6 +152,7 @@ public:
 
     /**
      * Sends a change directly to a intraprocess reader.
+     * @return true if the reader holds the change, so it can be considered acknowledged.
      */
     bool intraprocess_delivery(
             CacheChange_t* change,
@@ -398,6 +399,14 @@ private:
 
     void send_heartbeat_to_all_readers();
 
+    /**
+     * Add the next batch of the history to the readers it is being replayed to.
+     * Each reader receives up to late_joiner_replay_budget_ bytes, so the writer mutex is not kept for long while
+     * replaying big histories. Holes and irrelevant changes are sent as GAPs.
+     * @return true when the replay has not finished for some reader.
+     */
+    bool replay_history_to_readers();
+
     void send_changes_separatedly(
             SequenceNumber_t max_sequence,
             bool& activateHeartbeatPeriod);
@@ -440,6 +449,9 @@ private:
     bool there_are_remote_readers_ = false;
     bool there_are_local_readers_ = false;
 
+    //! Maximum number of bytes of the history replayed to each late joiner on each turn of the asynchronous thread.
+    uint32_t late_joiner_replay_budget_ = 0;
+
     StatefulWriter& operator =(
             const StatefulWriter&) = delete;
 
@@ -158,14 +158,24 @@ public:
     void add_flow_controller(
             std::unique_ptr<FlowController> controller) override;
 
+    /**
+     * Get the maximum size of the messages that the transports of all destinations can carry.
+     *
+     * @return the minimum of the maximum message sizes of the transports reaching the destinations, or 0
+     * when it is unknown and the maximum message size of the participant should be used.
+     */
+    uint32_t max_message_size() const override;
+
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices with the message already serialized.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
-            CDRMessage_t* message,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 private:
@@ -189,12 +199,84 @@ private:
 
     void send_unsent_changes_with_flow_control();
 
+    bool is_late_joiner(
+            const GUID_t& reader_guid) const;
+
+    /**
+     * Check whether a reader is a late joiner at a given position of the history replay.
+     * @param reader_guid GUID of the reader.
+     * @param replay_next Sequence number of the next change to replay.
+     * @return true when the reader is waiting for the replay of the change with sequence number replay_next.
+     */
+    bool is_late_joiner_at(
+            const GUID_t& reader_guid,
+            const SequenceNumber_t& replay_next) const;
+
+    /**
+     * Check whether a change of the history is still pending to be replayed to some late joiner.
+     * @param seq Sequence number of the change.
+     * @return true when the replay has not reached the change for some late joiner.
+     */
+    bool is_pending_replay(
+            const SequenceNumber_t& seq) const;
+
+    //! Select all the readers except the late joiners waiting for the history replay as destinations of the messages.
+    void select_up_to_date_readers();
+
+    /**
+     * Select the late joiners at a given position of the history replay as destinations of the messages.
+     * @param replay_next Sequence number of the next change to replay to the selected late joiners.
+     */
+    void select_late_joiners(
+            const SequenceNumber_t& replay_next);
+
+    /**
+     * Move forward the position of the late joiners whose replay has been progressed.
+     * @param replay_next Position of the late joiners before the replay turn.
+     * @param new_replay_next Position of those late joiners after the replay turn.
+     * @param finished Whether the replay has reached the end of the history for those late joiners.
+     */
+    void late_joiners_replayed_up_to(
+            const SequenceNumber_t& replay_next,
+            const SequenceNumber_t& new_replay_next,
+            bool finished);
+
+    //! Select all the matched readers and fixed locators as destinations of the messages.
+    void select_all_readers();
+
+    /**
+     * Replay the next batch of the history to the late joiners.
+     * The batch ends when late_joiner_replay_budget_ bytes have been replayed, so the writer mutex is not kept for
+     * long while live changes are waiting to be published.
+     * The batch is sent to the late joiner that has been waiting for the longest time, together with the late joiners
+     * at the same position of the replay, so new late joiners do not delay the ones already being served.
+     */
+    void replay_history_to_late_joiners();
+
+    /**
+     * Replay the next batch of the history to the late joiners through the flow controllers.
+     * @return true when the flow controllers did not allow sending the whole batch.
+     */
+    bool replay_history_with_flow_control();
+
     bool is_inline_qos_expected_ = false;
     LocatorList_t fixed_locators_;
     ResourceLimitedVector<ReaderLocator> matched_readers_;
 
-    ResourceLimitedVector<GUID_t> late_joiner_guids_;
-    SequenceNumber_t first_seq_for_all_readers_;
+    //! A reader waiting for the replay of the history.
+    struct LateJoiner
+    {
+        //! GUID of the reader.
+        GUID_t guid;
+        //! Sequence number of the next change of the history to replay to the reader.
+        SequenceNumber_t replay_next;
+    };
+
+    //! Readers waiting for the replay of the history, in order of arrival.
+    //! Live changes are not sent to them until their replay finishes.
+    ResourceLimitedVector<LateJoiner> late_joiners_;
+    //! Maximum number of bytes replayed to the late joiners on each turn of the asynchronous thread.
+    uint32_t late_joiner_replay_budget_ = 0;
     bool ignore_fixed_locators_ = false;
 
     ResourceLimitedVector<ChangeForReader_t, std::true_type> unsent_changes_;
@@ -22,6 +22,7 @@
 
 #include <fastdds/rtps/common/CacheChange.h>
 #include <chrono>
+#include <vector>
 
 namespace eprosima{
 namespace fastrtps{
@@ -36,6 +37,8 @@ struct KeyedChanges
     KeyedChanges()
         : cache_changes()
         , next_deadline_us()
+        , deadline_position(0)
+        , empty_position(0)
     {
     }
 
@@ -43,6 +46,8 @@ struct KeyedChanges
     KeyedChanges(const KeyedChanges& other)
         : cache_changes(other.cache_changes)
         , next_deadline_us(other.next_deadline_us)
+        , deadline_position(other.deadline_position)
+        , empty_position(other.empty_position)
     {
     }
 
@@ -55,6 +60,10 @@ struct KeyedChanges
     std::vector<rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
+    //! Position of the group on the deadline heap of its KeyedChangesCollection
+    size_t deadline_position;
+    //! Position of the group on the list of groups without changes of its KeyedChangesCollection
+    size_t empty_position;
 };
 
 } /* namespace  */
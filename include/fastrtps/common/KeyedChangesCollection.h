@@ -0,0 +1,312 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyedChangesCollection.h
+ *
+ */
+
+#ifndef KEYEDCHANGESCOLLECTION_H_
+#define KEYEDCHANGESCOLLECTION_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastrtps/common/KeyedChanges.h>
+
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief Collection of the instances of a keyed history.
+ *
+ * Instances are found through a hash index on their handle. Their deadlines are kept on a binary min-heap, so the
+ * instance that will miss its deadline first is known in constant time, and changing a deadline takes logarithmic
+ * time. Instances without changes are kept on a list, so one of them can be evicted in constant time.
+ *
+ * The changes of an instance should only be added and removed through this class, to keep that list updated.
+ * @ingroup FASTRTPS_MODULE
+ */
+class KeyedChangesCollection
+{
+    using map_type = std::unordered_map<rtps::InstanceHandle_t, KeyedChanges, rtps::InstanceHandleHash>;
+
+public:
+
+    using iterator = map_type::iterator;
+    using value_type = map_type::value_type;
+    using change_iterator = std::vector<rtps::CacheChange_t*>::iterator;
+
+    iterator begin()
+    {
+        return instances_.begin();
+    }
+
+    iterator end()
+    {
+        return instances_.end();
+    }
+
+    size_t size() const
+    {
+        return instances_.size();
+    }
+
+    iterator find(
+            const rtps::InstanceHandle_t& handle)
+    {
+        return instances_.find(handle);
+    }
+
+    /**
+     * Adds an instance without changes, or finds it if it was already on the collection.
+     * Until its deadline is set, the instance is the first one to miss it.
+     * @param handle Handle of the instance.
+     * @return Iterator to the instance.
+     */
+    iterator insert(
+            const rtps::InstanceHandle_t& handle)
+    {
+        auto result = instances_.emplace(handle, KeyedChanges());
+        if (result.second)
+        {
+            value_type* instance = &(*result.first);
+            instance->second.deadline_position = deadlines_.size();
+            deadlines_.push_back(instance);
+            sift_up(instance->second.deadline_position);
+
+            instance->second.empty_position = empty_instances_.size();
+            empty_instances_.push_back(instance);
+        }
+
+        return result.first;
+    }
+
+    /**
+     * Removes an instance from the collection, whatever its changes.
+     * @param it Iterator to the instance.
+     */
+    void erase(
+            iterator it)
+    {
+        KeyedChanges& instance = it->second;
+        if (instance.cache_changes.empty())
+        {
+            remove_empty(instance);
+        }
+
+        size_t position = instance.deadline_position;
+        move_deadline(deadlines_.back(), position);
+        deadlines_.pop_back();
+        if (position < deadlines_.size())
+        {
+            sift_down(position);
+            sift_up(position);
+        }
+
+        instances_.erase(it);
+    }
+
+    /**
+     * Removes one of the instances without changes.
+     * @return false when all the instances have changes.
+     */
+    bool erase_empty()
+    {
+        if (empty_instances_.empty())
+        {
+            return false;
+        }
+
+        erase(instances_.find(empty_instances_.back()->first));
+        return true;
+    }
+
+    /**
+     * Changes the time when an instance will miss its deadline.
+     * @param it Iterator to the instance.
+     * @param next_deadline_us The time point when the deadline will occur.
+     */
+    void set_next_deadline(
+            iterator it,
+            const std::chrono::steady_clock::time_point& next_deadline_us)
+    {
+        bool earlier = next_deadline_us < it->second.next_deadline_us;
+        it->second.next_deadline_us = next_deadline_us;
+        if (earlier)
+        {
+            sift_up(it->second.deadline_position);
+        }
+        else
+        {
+            sift_down(it->second.deadline_position);
+        }
+    }
+
+    /**
+     * Gets the instance that will miss its deadline first.
+     * @param handle Handle of the instance.
+     * @param next_deadline_us The time point when the instance will miss the deadline.
+     * @return false when the collection is empty.
+     */
+    bool get_next_deadline(
+            rtps::InstanceHandle_t& handle,
+            std::chrono::steady_clock::time_point& next_deadline_us) const
+    {
+        if (deadlines_.empty())
+        {
+            return false;
+        }
+
+        handle = deadlines_.front()->first;
+        next_deadline_us = deadlines_.front()->second.next_deadline_us;
+        return true;
+    }
+
+    /**
+     * Adds a change at the end of the changes of an instance.
+     * @param it Iterator to the instance.
+     * @param change Change to add.
+     */
+    void push_change(
+            iterator it,
+            rtps::CacheChange_t* change)
+    {
+        if (it->second.cache_changes.empty())
+        {
+            remove_empty(it->second);
+        }
+
+        it->second.cache_changes.push_back(change);
+    }
+
+    /**
+     * Removes a range of changes of an instance.
+     * @param it Iterator to the instance.
+     * @param first First change to remove.
+     * @param last Change following the last one to remove.
+     * @return Iterator following the last removed change.
+     */
+    change_iterator erase_changes(
+            iterator it,
+            change_iterator first,
+            change_iterator last)
+    {
+        std::vector<rtps::CacheChange_t*>& changes = it->second.cache_changes;
+        bool was_empty = changes.empty();
+        change_iterator ret = changes.erase(first, last);
+        if (!was_empty && changes.empty())
+        {
+            it->second.empty_position = empty_instances_.size();
+            empty_instances_.push_back(&(*it));
+        }
+
+        return ret;
+    }
+
+    change_iterator erase_change(
+            iterator it,
+            change_iterator change)
+    {
+        return erase_changes(it, change, change + 1);
+    }
+
+private:
+
+    void remove_empty(
+            KeyedChanges& instance)
+    {
+        value_type* last = empty_instances_.back();
+        last->second.empty_position = instance.empty_position;
+        empty_instances_[instance.empty_position] = last;
+        empty_instances_.pop_back();
+    }
+
+    void move_deadline(
+            value_type* instance,
+            size_t position)
+    {
+        instance->second.deadline_position = position;
+        deadlines_[position] = instance;
+    }
+
+    void sift_up(
+            size_t position)
+    {
+        value_type* instance = deadlines_[position];
+        while (position > 0)
+        {
+            size_t parent = (position - 1) / 2;
+            if (!(instance->second.next_deadline_us < deadlines_[parent]->second.next_deadline_us))
+            {
+                break;
+            }
+
+            move_deadline(deadlines_[parent], position);
+            position = parent;
+        }
+
+        move_deadline(instance, position);
+    }
+
+    void sift_down(
+            size_t position)
+    {
+        value_type* instance = deadlines_[position];
+        size_t size = deadlines_.size();
+        for (;;)
+        {
+            size_t child = 2 * position + 1;
+            if (child >= size)
+            {
+                break;
+            }
+
+            if (child + 1 < size &&
+                    deadlines_[child + 1]->second.next_deadline_us < deadlines_[child]->second.next_deadline_us)
+            {
+                ++child;
+            }
+
+            if (!(deadlines_[child]->second.next_deadline_us < instance->second.next_deadline_us))
+            {
+                break;
+            }
+
+            move_deadline(deadlines_[child], position);
+            position = child;
+        }
+
+        move_deadline(instance, position);
+    }
+
+    //! Instances indexed by their handle. Elements are not moved by rehashing, so pointers to them are stable.
+    map_type instances_;
+
+    //! Binary min-heap of instances ordered by their next deadline
+    std::vector<value_type*> deadlines_;
+
+    //! Instances without changes
+    std::vector<value_type*> empty_instances_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // KEYEDCHANGESCOLLECTION_H_
@@ -25,7 +25,7 @@
 
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastrtps/qos/QosPolicies.h>
-#include <fastrtps/common/KeyedChanges.h>
+#include <fastrtps/common/KeyedChangesCollection.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
 namespace eprosima {
@@ -143,9 +143,9 @@ public:
 
 private:
 
-    typedef std::map<rtps::InstanceHandle_t, KeyedChanges> t_m_Inst_Caches;
+    typedef KeyedChangesCollection t_m_Inst_Caches;
 
-    //!Map where keys are instance handles and values are vectors of cache changes associated
+    //!Collection where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
@@ -26,12 +26,13 @@
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastrtps/qos/QosPolicies.h>
-#include <fastrtps/common/KeyedChanges.h>
+#include <fastrtps/common/KeyedChangesCollection.h>
 #include <fastrtps/subscriber/SampleInfo.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
 #include <chrono>
 #include <functional>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -91,6 +92,54 @@ public:
             std::chrono::steady_clock::time_point& max_blocking_time);
     ///@}
 
+    /**
+     * @brief Access, with the history mutex taken only once, the changes that can be returned to the user.
+     *
+     * Changes are visited in order, skipping those that cannot be accessed yet. Every change accepted by the
+     * visitor is marked as read and, when @c should_take is true, removed from the history after the visit.
+     *
+     * @param max_blocking_time Maximum time the function can be blocked waiting for the history mutex.
+     * @param max_changes Maximum number of changes to be accepted.
+     * @param should_take Whether the accepted changes should be removed from the history.
+     * @param visitor Called with each accessible change and the ownership strength of its writer.
+     *                Returns whether the change has been accepted.
+     * @return false if the history mutex could not be taken, true otherwise.
+     */
+    bool access_changes(
+            std::chrono::steady_clock::time_point& max_blocking_time,
+            uint32_t max_changes,
+            bool should_take,
+            const std::function<bool(rtps::CacheChange_t*, uint32_t)>& visitor);
+
+    /**
+     * @brief Deserialize the data of a change and get its information.
+     * Should be called with the history mutex taken.
+     * @param change Pointer to the CacheChange_t.
+     * @param ownership_strength Ownership strength of the writer of the change.
+     * @param data Pointer to the object where the data should be deserialized.
+     * @param info Pointer to a SampleInfo_t object where the information should be stored. May be nullptr.
+     * @return True if the data was correctly deserialized.
+     */
+    bool deserialize_change(
+            rtps::CacheChange_t* change,
+            uint32_t ownership_strength,
+            void* data,
+            SampleInfo_t* info);
+
+    /**
+     * @brief Get the information of a change whose data is already available.
+     * Should be called with the history mutex taken.
+     * @param change Pointer to the CacheChange_t.
+     * @param ownership_strength Ownership strength of the writer of the change.
+     * @param data Pointer to the data of the change, used to compute its key when it was not received.
+     * @param info Pointer to a SampleInfo_t object where the information should be stored.
+     */
+    void get_change_info(
+            rtps::CacheChange_t* change,
+            uint32_t ownership_strength,
+            void* data,
+            SampleInfo_t* info);
+
     /**
      * @brief Returns information about the first untaken sample.
      * @param [out] info Pointer to a SampleInfo_t structure to store first untaken sample information.
@@ -129,9 +178,9 @@ public:
 
 private:
 
-    using t_m_Inst_Caches = std::map<rtps::InstanceHandle_t, KeyedChanges>;
+    using t_m_Inst_Caches = KeyedChangesCollection;
 
-    //!Map where keys are instance handles and values vectors of cache changes
+    //!Collection where keys are instance handles and values vectors of cache changes
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
@@ -202,13 +251,10 @@ private:
 
     bool add_received_change_with_key(
             rtps::CacheChange_t* a_change,
-            std::vector<rtps::CacheChange_t*>& instance_changes);
+            t_m_Inst_Caches::iterator instance);
 
-    bool deserialize_change(
-            rtps::CacheChange_t* change,
-            uint32_t ownership_strength,
-            void* data,
-            SampleInfo_t* info);
+    //! Changes to be removed at the end of access_changes
+    std::vector<rtps::CacheChange_t*> changes_to_remove_;
 };
 
 } // namespace fastrtps
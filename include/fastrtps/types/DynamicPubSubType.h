@@ -19,8 +19,11 @@
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicDataPtr.h>
+#include <fastrtps/types/DynamicTypeLayout.h>
 #include <fastrtps/utils/md5.h>
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -35,6 +38,9 @@ protected:
     MD5 m_md5;
     unsigned char* m_keyBuffer;
 
+    //! Layout the samples are stored and serialized with, when the compiled layout is enabled
+    std::shared_ptr<DynamicTypeLayout> layout_;
+
 public:
 
     RTPS_DllAPI DynamicPubSubType();
@@ -74,6 +80,17 @@ public:
 
     RTPS_DllAPI ReturnCode_t SetDynamicType(
             DynamicType_ptr pType);
+
+    /**
+     * Compiles the registered type into a DynamicTypeLayout, and uses it from then on.
+     * Samples are FlatDynamicData objects instead of DynamicData ones while it is enabled, and they are serialized
+     * by the program of the layout, with the same representation.
+     * @return false when there is no type registered, or it has members not supported by DynamicTypeLayout.
+     */
+    RTPS_DllAPI bool EnableCompiledLayout();
+
+    //! Gets the compiled layout, or nullptr when it is not enabled.
+    RTPS_DllAPI std::shared_ptr<const DynamicTypeLayout> GetCompiledLayout() const;
 };
 
 } // namespace types
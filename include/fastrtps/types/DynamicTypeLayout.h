@@ -0,0 +1,214 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_DYNAMIC_TYPE_LAYOUT_H
+#define TYPES_DYNAMIC_TYPE_LAYOUT_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class FlatDynamicDataView;
+
+/**
+ * Flat layout of the samples of a structure DynamicType, and the program that serializes them.
+ *
+ * The type is compiled once into a table of members indexed by their MemberId and a list of instructions.
+ * Fixed size members are placed at an offset of a contiguous buffer, and strings and sequences on slots of the
+ * sample, so members are accessed with offset arithmetic. Members of nested structures are placed inside the
+ * buffer and slots of the structure containing them, and their instructions are inlined on its program.
+ *
+ * The program writes the members in the same order and with the same CDR representation as DynamicData, so
+ * samples are interoperable with the ones serialized by it and by the generated code.
+ *
+ * Structures whose members are primitives, enumerations, strings, nested structures, and arrays or sequences of
+ * primitives are supported. Member ids should be consecutive starting from 0.
+ */
+class DynamicTypeLayout
+{
+public:
+
+    //! Operations of the instructions of the program
+    enum class Opcode : uint8_t
+    {
+        //! Fixed size value, or array of them, stored on the buffer
+        PRIMITIVE,
+        //! String stored on a slot
+        STRING,
+        //! Sequence of fixed size values stored on a slot
+        SEQUENCE
+    };
+
+    //! Instruction of the serialization program
+    struct Instruction
+    {
+        Opcode opcode;
+
+        //! Size of each element: 1, 2, 4 or 8 bytes
+        uint8_t element_size;
+
+        //! Offset on the buffer for primitives, slot for strings and sequences
+        uint32_t offset;
+
+        //! Number of elements for primitives, bound for sequences (0 when unbounded)
+        uint32_t count;
+    };
+
+    //! Location of a member of the structure
+    struct Member
+    {
+        //! Kind of the member. TK_NONE for ids not used by the structure.
+        TypeKind kind = TK_NONE;
+
+        //! Kind of the elements of arrays and sequences, and of the member itself otherwise
+        TypeKind element_kind = TK_NONE;
+
+        uint8_t element_size = 0;
+
+        //! Offset on the buffer for fixed size members and structures, slot for strings and sequences
+        uint32_t offset = 0;
+
+        //! Number of elements of arrays, bound of sequences
+        uint32_t count = 0;
+
+        //! First string and sequence slots of nested structures
+        uint32_t string_base = 0;
+        uint32_t sequence_base = 0;
+
+        //! Layout of nested structures
+        const DynamicTypeLayout* nested = nullptr;
+    };
+
+    /**
+     * Compiles the layout of a type.
+     * @param type Structure to compile.
+     * @return The layout, or nullptr when the type has members which are not supported.
+     */
+    RTPS_DllAPI static std::shared_ptr<DynamicTypeLayout> compile(
+            const DynamicType_ptr& type);
+
+    //! Gets the location of a member, or nullptr when the structure does not have it
+    inline const Member* member(
+            MemberId id) const
+    {
+        return id < members_.size() && TK_NONE != members_[id].kind ? &members_[id] : nullptr;
+    }
+
+    //! Size in bytes of the buffer of fixed size members
+    inline uint32_t buffer_size() const
+    {
+        return buffer_size_;
+    }
+
+    inline uint32_t string_count() const
+    {
+        return string_count_;
+    }
+
+    inline uint32_t sequence_count() const
+    {
+        return sequence_count_;
+    }
+
+    inline const std::vector<Instruction>& program() const
+    {
+        return program_;
+    }
+
+    inline const std::vector<Instruction>& key_program() const
+    {
+        return key_program_;
+    }
+
+    inline const std::string& name() const
+    {
+        return name_;
+    }
+
+    //! Writes a sample following the program.
+    RTPS_DllAPI void serialize(
+            const FlatDynamicDataView& data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Writes the key members of a sample following the key program.
+    RTPS_DllAPI void serialize_key(
+            const FlatDynamicDataView& data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    /**
+     * Reads a sample following the program.
+     * @return false when a sequence is longer than its bound.
+     */
+    RTPS_DllAPI bool deserialize(
+            FlatDynamicDataView& data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Computes the serialized size of a sample.
+    RTPS_DllAPI size_t get_cdr_serialized_size(
+            const FlatDynamicDataView& data,
+            size_t current_alignment = 0) const;
+
+private:
+
+    bool add_member(
+            MemberId id,
+            const DynamicType_ptr& type,
+            bool serialized,
+            bool key);
+
+    void add_nested(
+            const DynamicTypeLayout& nested,
+            Member& member,
+            bool serialized);
+
+    uint32_t reserve(
+            uint32_t size,
+            uint32_t alignment);
+
+    std::string name_;
+
+    std::vector<Member> members_;
+
+    std::vector<Instruction> program_;
+
+    std::vector<Instruction> key_program_;
+
+    //! Layouts of the nested structures
+    std::vector<std::shared_ptr<DynamicTypeLayout>> nested_;
+
+    uint32_t buffer_size_ = 0;
+
+    uint32_t buffer_alignment_ = 1;
+
+    uint32_t string_count_ = 0;
+
+    uint32_t sequence_count_ = 0;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_DYNAMIC_TYPE_LAYOUT_H
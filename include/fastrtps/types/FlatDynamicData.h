@@ -0,0 +1,313 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_DATA_H
+#define TYPES_FLAT_DYNAMIC_DATA_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypeLayout.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Access to the members of a sample stored with a DynamicTypeLayout.
+ *
+ * It does not own the storage of the sample. Views of nested structures are obtained with get_nested, and are
+ * valid while the sample containing them is.
+ */
+class FlatDynamicDataView
+{
+public:
+
+    FlatDynamicDataView()
+        : layout_(nullptr)
+        , buffer_(nullptr)
+        , strings_(nullptr)
+        , sequences_(nullptr)
+    {
+    }
+
+    FlatDynamicDataView(
+            const DynamicTypeLayout* layout,
+            octet* buffer,
+            std::string* strings,
+            std::vector<octet>* sequences)
+        : layout_(layout)
+        , buffer_(buffer)
+        , strings_(strings)
+        , sequences_(sequences)
+    {
+    }
+
+    inline bool is_valid() const
+    {
+        return nullptr != layout_;
+    }
+
+    inline const DynamicTypeLayout* layout() const
+    {
+        return layout_;
+    }
+
+    /**
+     * Gets the value of a primitive or enumeration member.
+     * @param value Where the value is returned.
+     * @param id Member to get.
+     * @return RETCODE_BAD_PARAMETER when the member does not exist or its kind does not match the type of value.
+     */
+    template<typename T>
+    ReturnCode_t get_value(
+            T& value,
+            MemberId id) const
+    {
+        const DynamicTypeLayout::Member* member = layout_->member(id);
+        if (nullptr == member || member->kind != member->element_kind || !matches(member->kind, &value))
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        value = *reinterpret_cast<const T*>(buffer_ + member->offset);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    //! Sets the value of a primitive or enumeration member.
+    template<typename T>
+    ReturnCode_t set_value(
+            T value,
+            MemberId id)
+    {
+        const DynamicTypeLayout::Member* member = layout_->member(id);
+        if (nullptr == member || member->kind != member->element_kind || !matches(member->kind, &value))
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        *reinterpret_cast<T*>(buffer_ + member->offset) = value;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    RTPS_DllAPI ReturnCode_t get_string_value(
+            std::string& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t set_string_value(
+            const std::string& value,
+            MemberId id);
+
+    /**
+     * Gets the elements of an array or sequence member.
+     * @param id Member to get.
+     * @param count Where the number of elements is returned.
+     * @return Pointer to the first element, or nullptr when the member does not exist or its elements do not
+     * match T.
+     */
+    template<typename T>
+    T* get_elements(
+            MemberId id,
+            uint32_t& count)
+    {
+        const DynamicTypeLayout::Member* member = layout_->member(id);
+        if (nullptr == member || !matches(member->element_kind, static_cast<T*>(nullptr)))
+        {
+            return nullptr;
+        }
+
+        if (TK_ARRAY == member->kind)
+        {
+            count = member->count;
+            return reinterpret_cast<T*>(buffer_ + member->offset);
+        }
+        else if (TK_SEQUENCE == member->kind)
+        {
+            std::vector<octet>& sequence = sequences_[member->offset];
+            count = static_cast<uint32_t>(sequence.size() / sizeof(T));
+            return reinterpret_cast<T*>(sequence.data());
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    const T* get_elements(
+            MemberId id,
+            uint32_t& count) const
+    {
+        return const_cast<FlatDynamicDataView*>(this)->get_elements<T>(id, count);
+    }
+
+    /**
+     * Changes the number of elements of a sequence member. New elements are zeroed.
+     * @return RETCODE_BAD_PARAMETER when the member is not a sequence or length exceeds its bound.
+     */
+    RTPS_DllAPI ReturnCode_t resize_sequence(
+            MemberId id,
+            uint32_t length);
+
+    //! Gets a view of a nested structure member. It is not valid when the member is not a structure.
+    RTPS_DllAPI FlatDynamicDataView get_nested(
+            MemberId id) const;
+
+    inline octet* buffer() const
+    {
+        return buffer_;
+    }
+
+    inline std::string& string_slot(
+            uint32_t slot) const
+    {
+        return strings_[slot];
+    }
+
+    inline std::vector<octet>& sequence_slot(
+            uint32_t slot) const
+    {
+        return sequences_[slot];
+    }
+
+protected:
+
+    static bool matches(
+            TypeKind kind,
+            const bool*)
+    {
+        return TK_BOOLEAN == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const octet*)
+    {
+        return TK_BYTE == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const char*)
+    {
+        return TK_CHAR8 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const int16_t*)
+    {
+        return TK_INT16 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const uint16_t*)
+    {
+        return TK_UINT16 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const int32_t*)
+    {
+        return TK_INT32 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const uint32_t*)
+    {
+        return TK_UINT32 == kind || TK_ENUM == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const int64_t*)
+    {
+        return TK_INT64 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const uint64_t*)
+    {
+        return TK_UINT64 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const float*)
+    {
+        return TK_FLOAT32 == kind;
+    }
+
+    static bool matches(
+            TypeKind kind,
+            const double*)
+    {
+        return TK_FLOAT64 == kind;
+    }
+
+    const DynamicTypeLayout* layout_;
+
+    octet* buffer_;
+
+    std::string* strings_;
+
+    std::vector<octet>* sequences_;
+};
+
+/**
+ * Sample of a type compiled into a DynamicTypeLayout.
+ *
+ * Fixed size members are stored on a single buffer, allocated when the sample is created, and strings and
+ * sequences keep their capacity between uses, so serializing and deserializing do not allocate per member.
+ * Members start zeroed. It is the data type of DynamicPubSubType when its compiled layout is enabled.
+ */
+class FlatDynamicData : public FlatDynamicDataView
+{
+public:
+
+    RTPS_DllAPI explicit FlatDynamicData(
+            std::shared_ptr<const DynamicTypeLayout> layout);
+
+    RTPS_DllAPI FlatDynamicData(
+            const FlatDynamicData& other);
+
+    RTPS_DllAPI FlatDynamicData& operator =(
+            const FlatDynamicData& other);
+
+    //! Zeroes the fixed size members and empties strings and sequences.
+    RTPS_DllAPI void clear();
+
+private:
+
+    void bind();
+
+    std::shared_ptr<const DynamicTypeLayout> layout_owner_;
+
+    //! Fixed size members. Its elements are the largest primitive so all of them are aligned.
+    std::vector<uint64_t> buffer_storage_;
+
+    std::vector<std::string> strings_storage_;
+
+    std::vector<std::vector<octet>> sequences_storage_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_DATA_H
@@ -60,6 +60,8 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* UDP_LISTEN_THREADS;
+extern const char* UDP_RECEIVE_BATCH_SIZE;
 extern const char* WHITE_LIST;
 extern const char* MAX_MESSAGE_SIZE;
 extern const char* MAX_INITIAL_PEERS_RANGE;
@@ -69,6 +71,7 @@ extern const char* MAX_LOGICAL_PORT;
 extern const char* LOGICAL_PORT_RANGE;
 extern const char* LOGICAL_PORT_INCREMENT;
 extern const char* ENABLE_TCP_NODELAY;
+extern const char* TCP_IO_THREADS;
 extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
@@ -249,6 +252,11 @@ extern const char* DEPTH;
 extern const char* ALLOCATED_SAMPLES;
 extern const char* BYTES_PER_SECOND;
 extern const char* PERIOD_MILLISECS;
+extern const char* BURST_BYTES;
+extern const char* THROUGHPUT_FIXED_WINDOW;
+extern const char* THROUGHPUT_TOKEN_BUCKET;
+extern const char* THROUGHPUT_PRIORITY;
+extern const char* THROUGHPUT_FAIR_SHARE;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -17,6 +17,7 @@
 #include <fastrtps/types/DynamicTypeMember.h>
 #include <fastrtps/types/DynamicDataFactory.h>
 #include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/FlatDynamicData.h>
 #include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastdds/dds/log/Log.hpp>
@@ -50,6 +51,7 @@ DynamicPubSubType::~DynamicPubSubType()
 void DynamicPubSubType::CleanDynamicType()
 {
     dynamic_type_ = nullptr;
+    layout_.reset();
 }
 
 DynamicType_ptr DynamicPubSubType::GetDynamicType() const
@@ -87,13 +89,41 @@ ReturnCode_t DynamicPubSubType::SetDynamicType(DynamicType_ptr pType)
     }
 }
 
+bool DynamicPubSubType::EnableCompiledLayout()
+{
+    if (dynamic_type_ == nullptr)
+    {
+        return false;
+    }
+
+    if (!layout_)
+    {
+        layout_ = DynamicTypeLayout::compile(dynamic_type_);
+    }
+    return !!layout_;
+}
+
+std::shared_ptr<const DynamicTypeLayout> DynamicPubSubType::GetCompiledLayout() const
+{
+    return layout_;
+}
+
 void* DynamicPubSubType::createData()
 {
+    if (layout_)
+    {
+        return new FlatDynamicData(layout_);
+    }
     return DynamicDataFactory::get_instance()->create_data(dynamic_type_);
 }
 
 void DynamicPubSubType::deleteData(void* data)
 {
+    if (layout_)
+    {
+        delete static_cast<FlatDynamicData*>(data);
+        return;
+    }
     DynamicDataFactory::get_instance()->delete_data((DynamicData*)data);
 }
 
@@ -110,6 +140,10 @@ bool DynamicPubSubType::deserialize(
 
     try
     {
+        if (layout_)
+        {
+            return layout_->deserialize(*static_cast<FlatDynamicData*>(data), deser);
+        }
         ((DynamicData*)data)->deserialize(deser); //Deserialize the object:
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
@@ -139,7 +173,14 @@ bool DynamicPubSubType::getKey(
 
     eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
-    pDynamicData->serializeKey(ser);
+    if (layout_)
+    {
+        layout_->serialize_key(*static_cast<FlatDynamicData*>(data), ser);
+    }
+    else
+    {
+        pDynamicData->serializeKey(ser);
+    }
     if (force_md5 || keyBufferSize > 16)
     {
         m_md5.init();
@@ -162,6 +203,16 @@ bool DynamicPubSubType::getKey(
 
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
 {
+    if (layout_)
+    {
+        std::shared_ptr<DynamicTypeLayout> layout = layout_;
+        return [layout, data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(layout->get_cdr_serialized_size(*static_cast<FlatDynamicData*>(data)))
+                          + 4 /*encapsulation*/;
+               };
+    }
+
     return [data]() -> uint32_t
     {
         return (uint32_t)DynamicData::getCdrSerializedSize((DynamicData*)data) + 4 /*encapsulation*/;
@@ -184,7 +235,14 @@ bool DynamicPubSubType::serialize(
 
     try
     {
-        ((DynamicData*)data)->serialize(ser); // Serialize the object:
+        if (layout_)
+        {
+            layout_->serialize(*static_cast<FlatDynamicData*>(data), ser);
+        }
+        else
+        {
+            ((DynamicData*)data)->serialize(ser); // Serialize the object:
+        }
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
     {
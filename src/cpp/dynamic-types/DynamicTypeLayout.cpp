@@ -0,0 +1,408 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/DynamicTypeLayout.h>
+#include <fastrtps/types/FlatDynamicData.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastcdr/Cdr.h>
+
+#include <map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+namespace {
+
+using Instruction = DynamicTypeLayout::Instruction;
+using Opcode = DynamicTypeLayout::Opcode;
+
+// Size of the fixed size kinds, or 0 for the rest
+uint8_t primitive_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+            return 1;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+            return 4;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// Values are written as unsigned integers of their size, which have the same representation on CDR.
+void serialize_elements(
+        eprosima::fastcdr::Cdr& cdr,
+        const octet* data,
+        uint8_t element_size,
+        uint32_t count)
+{
+    switch (element_size)
+    {
+        case 1:
+            cdr.serializeArray(reinterpret_cast<const uint8_t*>(data), count);
+            break;
+        case 2:
+            cdr.serializeArray(reinterpret_cast<const uint16_t*>(data), count);
+            break;
+        case 4:
+            cdr.serializeArray(reinterpret_cast<const uint32_t*>(data), count);
+            break;
+        default:
+            cdr.serializeArray(reinterpret_cast<const uint64_t*>(data), count);
+            break;
+    }
+}
+
+void deserialize_elements(
+        eprosima::fastcdr::Cdr& cdr,
+        octet* data,
+        uint8_t element_size,
+        uint32_t count)
+{
+    switch (element_size)
+    {
+        case 1:
+            cdr.deserializeArray(reinterpret_cast<uint8_t*>(data), count);
+            break;
+        case 2:
+            cdr.deserializeArray(reinterpret_cast<uint16_t*>(data), count);
+            break;
+        case 4:
+            cdr.deserializeArray(reinterpret_cast<uint32_t*>(data), count);
+            break;
+        default:
+            cdr.deserializeArray(reinterpret_cast<uint64_t*>(data), count);
+            break;
+    }
+}
+
+void execute(
+        const std::vector<Instruction>& program,
+        const FlatDynamicDataView& data,
+        eprosima::fastcdr::Cdr& cdr)
+{
+    for (const Instruction& instruction : program)
+    {
+        switch (instruction.opcode)
+        {
+            case Opcode::PRIMITIVE:
+                serialize_elements(cdr, data.buffer() + instruction.offset, instruction.element_size,
+                        instruction.count);
+                break;
+            case Opcode::STRING:
+                cdr << data.string_slot(instruction.offset);
+                break;
+            case Opcode::SEQUENCE:
+            {
+                const std::vector<octet>& sequence = data.sequence_slot(instruction.offset);
+                uint32_t length = static_cast<uint32_t>(sequence.size() / instruction.element_size);
+                cdr << length;
+                if (0 < length)
+                {
+                    serialize_elements(cdr, sequence.data(), instruction.element_size, length);
+                }
+                break;
+            }
+        }
+    }
+}
+
+Instruction relocate(
+        Instruction instruction,
+        const DynamicTypeLayout::Member& member)
+{
+    switch (instruction.opcode)
+    {
+        case Opcode::PRIMITIVE:
+            instruction.offset += member.offset;
+            break;
+        case Opcode::STRING:
+            instruction.offset += member.string_base;
+            break;
+        case Opcode::SEQUENCE:
+            instruction.offset += member.sequence_base;
+            break;
+    }
+    return instruction;
+}
+
+} // namespace
+
+std::shared_ptr<DynamicTypeLayout> DynamicTypeLayout::compile(
+        const DynamicType_ptr& type)
+{
+    if (type == nullptr || TK_STRUCTURE != type->get_kind() || type->get_descriptor()->get_base_type() != nullptr)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<DynamicTypeLayout> layout = std::make_shared<DynamicTypeLayout>();
+    layout->name_ = type->get_name();
+
+    std::map<MemberId, DynamicTypeMember*> members;
+    type->get_all_members(members);
+    layout->members_.resize(members.size());
+
+    // DynamicData serializes members by consecutive ids
+    MemberId expected_id = 0;
+    for (auto it = members.begin(); it != members.end(); ++it, ++expected_id)
+    {
+        const MemberDescriptor* descriptor = it->second->get_descriptor();
+        DynamicType_ptr member_type = descriptor->get_type();
+        if (it->first != expected_id || member_type == nullptr)
+        {
+            logInfo(DYN_TYPES, "Cannot compile the layout of " << layout->name_ << ": unexpected member "
+                                                               << it->first);
+            return nullptr;
+        }
+
+        bool serialized = !descriptor->annotation_is_non_serialized() &&
+                !member_type->get_descriptor()->annotation_is_non_serialized();
+        if (!layout->add_member(it->first, member_type, serialized, member_type->key_annotation()))
+        {
+            logInfo(DYN_TYPES, "Cannot compile the layout of " << layout->name_ << ": member "
+                                                               << descriptor->get_name() << " is not supported");
+            return nullptr;
+        }
+    }
+
+    return layout;
+}
+
+bool DynamicTypeLayout::add_member(
+        MemberId id,
+        const DynamicType_ptr& type,
+        bool serialized,
+        bool key)
+{
+    Member& member = members_[id];
+    member.kind = type->get_kind();
+    member.element_kind = member.kind;
+
+    Instruction instruction;
+    uint8_t size = primitive_size(member.kind);
+    if (0 < size)
+    {
+        member.element_size = size;
+        member.count = 1;
+        member.offset = reserve(size, size);
+        instruction = {Opcode::PRIMITIVE, size, member.offset, 1};
+    }
+    else if (TK_STRING8 == member.kind)
+    {
+        member.offset = string_count_++;
+        instruction = {Opcode::STRING, 1, member.offset, 0};
+    }
+    else if (TK_ARRAY == member.kind || TK_SEQUENCE == member.kind)
+    {
+        DynamicType_ptr element_type = type->get_descriptor()->get_element_type();
+        size = element_type != nullptr ? primitive_size(element_type->get_kind()) : 0;
+        if (0 == size)
+        {
+            return false;
+        }
+
+        member.element_kind = element_type->get_kind();
+        member.element_size = size;
+        if (TK_ARRAY == member.kind)
+        {
+            member.count = type->get_total_bounds();
+            member.offset = reserve(size * member.count, size);
+            instruction = {Opcode::PRIMITIVE, size, member.offset, member.count};
+        }
+        else
+        {
+            member.count = type->get_bounds();
+            member.offset = sequence_count_++;
+            instruction = {Opcode::SEQUENCE, size, member.offset, member.count};
+        }
+    }
+    else if (TK_STRUCTURE == member.kind)
+    {
+        std::shared_ptr<DynamicTypeLayout> nested = compile(type);
+        if (!nested)
+        {
+            return false;
+        }
+
+        add_nested(*nested, member, serialized);
+        nested_.push_back(nested);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (serialized)
+    {
+        program_.push_back(instruction);
+        if (key)
+        {
+            key_program_.push_back(instruction);
+        }
+    }
+
+    return true;
+}
+
+void DynamicTypeLayout::add_nested(
+        const DynamicTypeLayout& nested,
+        Member& member,
+        bool serialized)
+{
+    member.offset = reserve(nested.buffer_size_, nested.buffer_alignment_);
+    member.string_base = string_count_;
+    member.sequence_base = sequence_count_;
+    member.nested = &nested;
+    string_count_ += nested.string_count_;
+    sequence_count_ += nested.sequence_count_;
+
+    if (serialized)
+    {
+        // Keys of nested structures are their own key members, as DynamicData::serializeKey does
+        for (const Instruction& instruction : nested.program_)
+        {
+            program_.push_back(relocate(instruction, member));
+        }
+
+        for (const Instruction& instruction : nested.key_program_)
+        {
+            key_program_.push_back(relocate(instruction, member));
+        }
+    }
+}
+
+uint32_t DynamicTypeLayout::reserve(
+        uint32_t size,
+        uint32_t alignment)
+{
+    uint32_t offset = (buffer_size_ + alignment - 1) / alignment * alignment;
+    buffer_size_ = offset + size;
+    if (buffer_alignment_ < alignment)
+    {
+        buffer_alignment_ = alignment;
+    }
+    return offset;
+}
+
+void DynamicTypeLayout::serialize(
+        const FlatDynamicDataView& data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    execute(program_, data, cdr);
+}
+
+void DynamicTypeLayout::serialize_key(
+        const FlatDynamicDataView& data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    execute(key_program_, data, cdr);
+}
+
+bool DynamicTypeLayout::deserialize(
+        FlatDynamicDataView& data,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    for (const Instruction& instruction : program_)
+    {
+        switch (instruction.opcode)
+        {
+            case Opcode::PRIMITIVE:
+                deserialize_elements(cdr, data.buffer() + instruction.offset, instruction.element_size,
+                        instruction.count);
+                break;
+            case Opcode::STRING:
+                cdr >> data.string_slot(instruction.offset);
+                break;
+            case Opcode::SEQUENCE:
+            {
+                std::vector<octet>& sequence = data.sequence_slot(instruction.offset);
+                uint32_t length = 0;
+                cdr >> length;
+                if (0 < instruction.count && instruction.count < length)
+                {
+                    return false;
+                }
+
+                sequence.resize(static_cast<size_t>(length) * instruction.element_size);
+                if (0 < length)
+                {
+                    deserialize_elements(cdr, sequence.data(), instruction.element_size, length);
+                }
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+size_t DynamicTypeLayout::get_cdr_serialized_size(
+        const FlatDynamicDataView& data,
+        size_t current_alignment) const
+{
+    size_t initial_alignment = current_alignment;
+
+    for (const Instruction& instruction : program_)
+    {
+        switch (instruction.opcode)
+        {
+            case Opcode::PRIMITIVE:
+                current_alignment += eprosima::fastcdr::Cdr::alignment(current_alignment, instruction.element_size) +
+                        static_cast<size_t>(instruction.element_size) * instruction.count;
+                break;
+            case Opcode::STRING:
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) +
+                        data.string_slot(instruction.offset).size() + 1;
+                break;
+            case Opcode::SEQUENCE:
+            {
+                size_t size = data.sequence_slot(instruction.offset).size();
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+                if (0 < size)
+                {
+                    current_alignment += eprosima::fastcdr::Cdr::alignment(current_alignment,
+                                    instruction.element_size) + size;
+                }
+                break;
+            }
+        }
+    }
+
+    return current_alignment - initial_alignment;
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
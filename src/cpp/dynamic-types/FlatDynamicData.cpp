@@ -0,0 +1,133 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicData.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+ReturnCode_t FlatDynamicDataView::get_string_value(
+        std::string& value,
+        MemberId id) const
+{
+    const DynamicTypeLayout::Member* member = layout_->member(id);
+    if (nullptr == member || TK_STRING8 != member->kind)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    value = strings_[member->offset];
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicDataView::set_string_value(
+        const std::string& value,
+        MemberId id)
+{
+    const DynamicTypeLayout::Member* member = layout_->member(id);
+    if (nullptr == member || TK_STRING8 != member->kind)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    strings_[member->offset] = value;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicDataView::resize_sequence(
+        MemberId id,
+        uint32_t length)
+{
+    const DynamicTypeLayout::Member* member = layout_->member(id);
+    if (nullptr == member || TK_SEQUENCE != member->kind || (0 < member->count && member->count < length))
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    sequences_[member->offset].resize(static_cast<size_t>(length) * member->element_size, 0);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+FlatDynamicDataView FlatDynamicDataView::get_nested(
+        MemberId id) const
+{
+    const DynamicTypeLayout::Member* member = layout_->member(id);
+    if (nullptr == member || nullptr == member->nested)
+    {
+        return FlatDynamicDataView();
+    }
+
+    return FlatDynamicDataView(member->nested, buffer_ + member->offset, strings_ + member->string_base,
+                   sequences_ + member->sequence_base);
+}
+
+FlatDynamicData::FlatDynamicData(
+        std::shared_ptr<const DynamicTypeLayout> layout)
+    : layout_owner_(layout)
+    , buffer_storage_((layout->buffer_size() + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0)
+    , strings_storage_(layout->string_count())
+    , sequences_storage_(layout->sequence_count())
+{
+    bind();
+}
+
+FlatDynamicData::FlatDynamicData(
+        const FlatDynamicData& other)
+    : FlatDynamicDataView()
+    , layout_owner_(other.layout_owner_)
+    , buffer_storage_(other.buffer_storage_)
+    , strings_storage_(other.strings_storage_)
+    , sequences_storage_(other.sequences_storage_)
+{
+    bind();
+}
+
+FlatDynamicData& FlatDynamicData::operator =(
+        const FlatDynamicData& other)
+{
+    layout_owner_ = other.layout_owner_;
+    buffer_storage_ = other.buffer_storage_;
+    strings_storage_ = other.strings_storage_;
+    sequences_storage_ = other.sequences_storage_;
+    bind();
+    return *this;
+}
+
+void FlatDynamicData::clear()
+{
+    std::fill(buffer_storage_.begin(), buffer_storage_.end(), 0);
+    for (std::string& value : strings_storage_)
+    {
+        value.clear();
+    }
+    for (std::vector<octet>& value : sequences_storage_)
+    {
+        value.clear();
+    }
+}
+
+void FlatDynamicData::bind()
+{
+    layout_ = layout_owner_.get();
+    buffer_ = reinterpret_cast<octet*>(buffer_storage_.data());
+    strings_ = strings_storage_.data();
+    sequences_ = sequences_storage_.data();
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <mutex>
 
@@ -23,17 +25,46 @@
 #include <fastdds/dds/log/Colors.hpp>
 #include <iostream>
 
+#include "LogQueue.hpp"
+
 using namespace std;
 namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+//! Maximum number of entries pending to be consumed. Further entries are discarded.
+static constexpr size_t log_queue_capacity = 4096;
+
+//! Maximum number of categories with their own rate limit. Further categories are not limited.
+static constexpr size_t max_rate_limited_categories = 256;
+
+//! Minimum time between two reports of discarded entries.
+static constexpr std::chrono::seconds dropped_entries_report_period(1);
+
+/**
+ * Number of entries logged on a category during the current second.
+ * Categories are assigned to a bucket the first time they are seen, and never removed.
+ */
+struct CategoryRateLimitBucket
+{
+    std::atomic<const char*> category;
+    std::atomic<int64_t> second;
+    std::atomic<uint32_t> count;
+};
+
+static CategoryRateLimitBucket rate_limit_buckets[max_rate_limited_categories];
+
 struct Log::Resources Log::resources_;
 
 Log::Resources::Resources()
-    : logging(false)
-    , work(false)
-    , current_loop(0)
+    : logs(new LogQueue(log_queue_capacity))
+    , logging(false)
+    , waiting(false)
+    , processed(0)
+    , dropped(0)
+    , dropped_reported(0)
+    , timestamp_seconds(0)
+    , category_rate_limit(0)
     , filenames(false)
     , functions(true)
     , verbosity(Log::Error)
@@ -59,12 +90,8 @@ void Log::RegisterConsumer(
 
 void Log::ClearConsumers()
 {
-    std::unique_lock<std::mutex> working(resources_.cv_mutex);
-    resources_.cv.wait(working,
-            [&]()
-            {
-                return resources_.logs.BothEmpty();
-            });
+    // Pending entries are delivered to the current consumers
+    Flush();
     std::unique_lock<std::mutex> guard(resources_.config_mutex);
     resources_.consumers.clear();
 }
@@ -78,6 +105,7 @@ void Log::Reset()
     resources_.filenames = false;
     resources_.functions = true;
     resources_.verbosity = Log::Error;
+    resources_.category_rate_limit = 0;
     resources_.consumers.clear();
 #if STDOUTERR_LOG_CONSUMER
     resources_.consumers.emplace_back(new StdoutErrConsumer);
@@ -96,76 +124,103 @@ void Log::Flush()
         return;
     }
 
-    /*   Flush() two steps strategy:
-
-         I must assure Log::Run swaps the queues because only swapping the queues the background content
-         will be consumed (first Run() loop).
-
-         Then, I must assure the new front queue content is consumed (second Run() loop).
-     */
-
-    int last_loop = -1;
-
-    for (int i = 0; i < 2; ++i)
-    {
-        resources_.cv.wait(guard,
-                [&]()
-                {
-                    /* I must avoid:
-                     + the two calls be processed without an intermediate Run() loop (by using last_loop sequence number)
-                     + deadlock by absence of Run() loop activity (by using BothEmpty() call)
-                     */
-                    return !resources_.logging ||
-                    ( resources_.logs.Empty() &&
-                    ( last_loop != resources_.current_loop || resources_.logs.BothEmpty()));
-                });
-
-        last_loop = resources_.current_loop;
-
-    }
+    // Wait until the entries added before this call have been consumed.
+    uint64_t last_entry = resources_.logs->pushed();
+    resources_.cv.wait(guard,
+            [&]()
+            {
+                return !resources_.logging || resources_.processed >= last_entry;
+            });
 }
 
 void Log::run()
 {
     std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+    Entry entry;
+    LogQueue::Record record;
 
     while (resources_.logging)
     {
-        resources_.cv.wait(guard,
-                [&]()
-                {
-                    return !resources_.logging || resources_.work;
-                });
-
-        resources_.work = false;
+        // Producers check this flag after adding an entry. Both sides use a full fence, so either the producer
+        // sees the flag and notifies, or this thread sees the new entry.
+        resources_.waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (resources_.logging && resources_.logs->empty())
+        {
+            if (resources_.dropped.load(std::memory_order_relaxed) == resources_.dropped_reported)
+            {
+                resources_.cv.wait(guard);
+            }
+            else if (std::chrono::steady_clock::now() < resources_.last_drop_report + dropped_entries_report_period)
+            {
+                // Discarded entries are reported even if no more entries arrive
+                resources_.cv.wait_until(guard, resources_.last_drop_report + dropped_entries_report_period);
+            }
+            else
+            {
+                break;
+            }
+        }
+        resources_.waiting.store(false, std::memory_order_relaxed);
 
         guard.unlock();
         {
-            resources_.logs.Swap();
-            while (!resources_.logs.Empty())
+            while (resources_.logs->pop(record))
             {
-                std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
-                if (preprocess(resources_.logs.Front()))
-                {
-                    for (auto& consumer : resources_.consumers)
-                    {
-                        consumer->Consume(resources_.logs.Front());
-                    }
-                }
-
-                resources_.logs.Pop();
+                entry.message.swap(record.message);
+                entry.context = record.context;
+                entry.kind = record.kind;
+                get_timestamp(record.timestamp, entry.timestamp);
+                consume(entry);
             }
+
+            report_dropped_entries();
         }
         guard.lock();
 
-        // avoid overflow
-        if (++resources_.current_loop > 10000)
+        resources_.processed = resources_.logs->popped();
+        resources_.cv.notify_all();
+    }
+}
+
+void Log::consume(
+        Log::Entry& entry)
+{
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    if (preprocess(entry))
+    {
+        for (auto& consumer : resources_.consumers)
         {
-            resources_.current_loop = 0;
+            consumer->Consume(entry);
         }
+    }
+}
 
-        resources_.cv.notify_all();
+void Log::report_dropped_entries()
+{
+    uint64_t dropped = resources_.dropped.load(std::memory_order_relaxed);
+    if (dropped == resources_.dropped_reported)
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - resources_.last_drop_report < dropped_entries_report_period)
+    {
+        return;
     }
+
+    Entry entry;
+    std::stringstream stream;
+    stream << (dropped - resources_.dropped_reported) << " log entries were discarded";
+    entry.message = stream.str();
+    entry.context = Log::Context{__FILE__, __LINE__, __func__, "LOG"};
+    entry.kind = Log::Kind::Warning;
+    get_timestamp(std::chrono::system_clock::now(), entry.timestamp);
+    consume(entry);
+
+    resources_.dropped_reported = dropped;
+    resources_.last_drop_report = now;
 }
 
 void Log::ReportFilenames(
@@ -214,7 +269,6 @@ void Log::KillThread()
     {
         std::unique_lock<std::mutex> guard(resources_.cv_mutex);
         resources_.logging = false;
-        resources_.work = false;
     }
 
     if (resources_.logging_thread)
@@ -235,6 +289,7 @@ void Log::QueueLog(
         const Log::Context& context,
         Log::Kind kind)
 {
+    if (!resources_.logging)
     {
         std::unique_lock<std::mutex> guard(resources_.cv_mutex);
         if (!resources_.logging && !resources_.logging_thread)
@@ -244,14 +299,95 @@ void Log::QueueLog(
         }
     }
 
-    std::string timestamp;
-    get_timestamp(timestamp);
-    resources_.logs.Push(Log::Entry{message, context, kind, timestamp});
+    if (!resources_.logs->push(message, context, kind, std::chrono::system_clock::now()))
+    {
+        resources_.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // The logging thread is only notified when it is waiting for entries
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (resources_.waiting.load(std::memory_order_relaxed))
     {
         std::unique_lock<std::mutex> guard(resources_.cv_mutex);
-        resources_.work = true;
+        resources_.cv.notify_all();
+    }
+}
+
+bool Log::AcceptEntry(
+        const char* category)
+{
+    uint32_t limit = resources_.category_rate_limit.load(std::memory_order_relaxed);
+    if (0 == limit)
+    {
+        return true;
+    }
+
+    // Categories come from literals, which may be duplicated among compilation units, so the bucket is found
+    // through the hash of the name.
+    size_t hash = 0;
+    for (const char* c = category; *c != '\0'; ++c)
+    {
+        hash = hash * 31 + static_cast<unsigned char>(*c);
+    }
+
+    CategoryRateLimitBucket* bucket = nullptr;
+    for (size_t i = 0; i < max_rate_limited_categories && nullptr == bucket; ++i)
+    {
+        CategoryRateLimitBucket& candidate = rate_limit_buckets[(hash + i) % max_rate_limited_categories];
+        const char* bucket_category = candidate.category.load(std::memory_order_acquire);
+        if (nullptr == bucket_category &&
+                candidate.category.compare_exchange_strong(bucket_category, category))
+        {
+            bucket_category = category;
+        }
+
+        if (bucket_category == category || 0 == strcmp(bucket_category, category))
+        {
+            bucket = &candidate;
+        }
+    }
+
+    if (nullptr == bucket)
+    {
+        return true;
+    }
+
+    int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t bucket_second = bucket->second.load(std::memory_order_relaxed);
+    if (bucket_second != second && bucket->second.compare_exchange_strong(bucket_second, second))
+    {
+        bucket->count.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t count = bucket->count.fetch_add(1, std::memory_order_relaxed);
+    if (count >= limit)
+    {
+        resources_.dropped.fetch_add(1, std::memory_order_relaxed);
+
+        // The logging thread is woken up on the first discarded entry of each period, so it is reported
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (count == limit && resources_.waiting.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+            resources_.cv.notify_all();
+        }
+        return false;
     }
-    resources_.cv.notify_all();
+
+    return true;
+}
+
+void Log::SetCategoryRateLimit(
+        uint32_t max_entries_per_second)
+{
+    resources_.category_rate_limit = max_entries_per_second;
+}
+
+uint64_t Log::GetDroppedEntries()
+{
+    return resources_.dropped.load(std::memory_order_relaxed);
 }
 
 Log::Kind Log::GetVerbosity()
@@ -288,26 +424,36 @@ void Log::SetErrorStringFilter(
 }
 
 void Log::get_timestamp(
+        const std::chrono::system_clock::time_point& time,
         std::string& timestamp)
 {
-    std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
-    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-    std::chrono::system_clock::duration tp = now.time_since_epoch();
+    std::time_t time_c = std::chrono::system_clock::to_time_t(time);
+    std::chrono::system_clock::duration tp = time.time_since_epoch();
     tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
     auto ms = static_cast<unsigned>(tp / std::chrono::milliseconds(1));
 
+    // Date and time are only formatted when the second changes
+    if (resources_.timestamp_prefix.empty() || time_c != resources_.timestamp_seconds)
+    {
+        std::stringstream stream;
 #if defined(_WIN32)
-    struct tm timeinfo;
-    localtime_s(&timeinfo, &now_c);
-    stream << std::put_time(&timeinfo, "%F %T") << "." << std::setw(3) << std::setfill('0') << ms << " ";
-    //#elif defined(__clang__) && !defined(std::put_time) // TODO arm64 doesn't seem to support std::put_time
-    //    (void)now_c;
-    //    (void)ms;
+        struct tm timeinfo;
+        localtime_s(&timeinfo, &time_c);
+        stream << std::put_time(&timeinfo, "%F %T") << ".";
+        //#elif defined(__clang__) && !defined(std::put_time) // TODO arm64 doesn't seem to support std::put_time
+        //    (void)now_c;
+        //    (void)ms;
 #else
-    stream << std::put_time(localtime(&now_c), "%F %T") << "." << std::setw(3) << std::setfill('0') << ms << " ";
+        stream << std::put_time(localtime(&time_c), "%F %T") << ".";
 #endif // if defined(_WIN32)
-    timestamp = stream.str();
+        resources_.timestamp_prefix = stream.str();
+        resources_.timestamp_seconds = time_c;
+    }
+
+    char milliseconds[6];
+    snprintf(milliseconds, sizeof(milliseconds), "%03u ", ms);
+    timestamp.assign(resources_.timestamp_prefix);
+    timestamp.append(milliseconds);
 }
 
 void LogConsumer::print_timestamp(
@@ -0,0 +1,183 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogQueue.hpp
+ */
+
+#ifndef _FASTDDS_LOG_LOGQUEUE_HPP_
+#define _FASTDDS_LOG_LOGQUEUE_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Bounded multi-producer single-consumer queue of log records.
+ *
+ * Producers claim a slot with a single atomic operation and never block. When the queue is full the
+ * record is discarded and push returns false.
+ * Records keep the time they were generated, so the timestamp is formatted by the consumer. Slots are
+ * allocated once, and the memory of the messages is recycled between producers and the consumer.
+ */
+class LogQueue
+{
+public:
+
+    //! Information kept for each log entry until it is consumed.
+    struct Record
+    {
+        std::string message;
+        Log::Context context;
+        Log::Kind kind;
+        std::chrono::system_clock::time_point timestamp;
+    };
+
+    /**
+     * @param capacity Maximum number of records on the queue. It should be a power of two.
+     */
+    explicit LogQueue(
+            size_t capacity)
+        : slots_(new Slot[capacity])
+        , mask_(capacity - 1)
+        , enqueue_pos_(0)
+        , dequeue_pos_(0)
+    {
+        assert(capacity > 1 && (capacity & mask_) == 0);
+
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Adds a record to the queue. Thread safe.
+     * @return false when the queue is full.
+     */
+    bool push(
+            const std::string& message,
+            const Log::Context& context,
+            Log::Kind kind,
+            const std::chrono::system_clock::time_point& timestamp)
+    {
+        Slot* slot = nullptr;
+        uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &slots_[pos & mask_];
+            uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(sequence - pos);
+            if (0 == diff)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (0 > diff)
+            {
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->record.message.assign(message);
+        slot->record.context = context;
+        slot->record.kind = kind;
+        slot->record.timestamp = timestamp;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Takes the oldest record of the queue. Should only be called from the consumer thread.
+     * The message is swapped with the one on @c record, so its memory is reused by later records.
+     * @return false when there are no records ready.
+     */
+    bool pop(
+            Record& record)
+    {
+        uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;
+        }
+
+        record.message.swap(slot.record.message);
+        record.context = slot.record.context;
+        record.kind = slot.record.kind;
+        record.timestamp = slot.record.timestamp;
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Whether there is a record ready to be taken.
+    bool empty() const
+    {
+        uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        return slots_[pos & mask_].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    //! Number of records added to the queue since its creation.
+    uint64_t pushed() const
+    {
+        return enqueue_pos_.load(std::memory_order_acquire);
+    }
+
+    //! Number of records taken from the queue since its creation.
+    uint64_t popped() const
+    {
+        return dequeue_pos_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        Record record;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+
+    uint64_t mask_;
+
+    std::atomic<uint64_t> enqueue_pos_;
+
+    //! Keeps the positions of producers and consumer on different cache lines
+    char padding_[64];
+
+    std::atomic<uint64_t> dequeue_pos_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_LOG_LOGQUEUE_HPP_
@@ -40,6 +40,7 @@
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
 
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
 #include <functional>
@@ -205,6 +206,14 @@ ReturnCode_t DataWriterImpl::enable()
         return ReturnCode_t::RETCODE_ERROR;
     }
 
+    if (std::dynamic_pointer_cast<DataSharingPayloadPool>(payload_pool_) && !writer->is_datasharing_compatible())
+    {
+        RTPSDomain::removeRTPSWriter(writer);
+        release_payload_pool();
+        logError(DATA_WRITER, "Could not enable data-sharing on writer of topic " << topic_->get_name());
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+
     writer_ = writer;
 
     // In case it has been loaded from the persistence DB, rebuild instances on history
@@ -1369,8 +1378,23 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         // Avoid calling the serialization size functors on PREALLOCATED mode
         fixed_payload_size_ = config.memory_policy == PREALLOCATED_MEMORY_MODE ? config.payload_initial_size : 0u;
 
-        // Get payload pool reference and allocate space for our history
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        // Data-sharing writers keep their payloads on a private shared memory segment
+        if (DataSharingPayloadPool::is_enabled(qos_.properties()) && type_->is_bounded())
+        {
+            config.memory_policy = PREALLOCATED_MEMORY_MODE;
+            config.payload_initial_size = type_->m_typeSize;
+            payload_pool_ = DataSharingPayloadPool::get_writer_pool(config);
+            if (payload_pool_)
+            {
+                fixed_payload_size_ = config.payload_initial_size;
+            }
+        }
+
+        if (!payload_pool_)
+        {
+            // Get payload pool reference and allocate space for our history
+            payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        }
         payload_pool_->reserve_history(config, false);
 
         // Prepare loans collection for plain types only
@@ -1392,7 +1416,15 @@ void DataWriterImpl::release_payload_pool()
     PoolConfig config = PoolConfig::from_history_attributes(history_.m_att);
     payload_pool_->release_history(config, false);
 
-    TopicPayloadPoolRegistry::release(payload_pool_);
+    if (std::dynamic_pointer_cast<DataSharingPayloadPool>(payload_pool_))
+    {
+        // Not shared with other writers, so it is not on the registry
+        payload_pool_.reset();
+    }
+    else
+    {
+        TopicPayloadPoolRegistry::release(payload_pool_);
+    }
 }
 
 bool DataWriterImpl::add_loan(
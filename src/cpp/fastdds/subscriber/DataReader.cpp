@@ -85,6 +85,35 @@ ReturnCode_t DataReader::read_next_sample(
     return impl_->read_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::read(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->read(data_values, sample_infos, max_samples, sample_states, view_states, instance_states);
+}
+
+ReturnCode_t DataReader::take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->take(data_values, sample_infos, max_samples, sample_states, view_states, instance_states);
+}
+
+ReturnCode_t DataReader::return_loan(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos)
+{
+    return impl_->return_loan(data_values, sample_infos);
+}
+
 ReturnCode_t DataReader::take_next_sample(
         void* data,
         SampleInfo* info)
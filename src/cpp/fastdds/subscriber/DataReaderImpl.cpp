@@ -40,6 +40,9 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <memory>
+#include <vector>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
@@ -48,6 +51,19 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+static InstanceStateKind instance_state_of(
+        ChangeKind_t kind)
+{
+    switch (kind)
+    {
+        case eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED:
+            return NOT_ALIVE_DISPOSED_INSTANCE_STATE;
+        default:
+            //TODO [ILG] change this if the other kinds ever get implemented
+            return ALIVE_INSTANCE_STATE;
+    }
+}
+
 void sample_info_to_dds (
         const SampleInfo_t& rtps_info,
         SampleInfo* dds_info)
@@ -65,21 +81,196 @@ void sample_info_to_dds (
     dds_info->sample_identity = rtps_info.sample_identity;
     dds_info->related_sample_identity = rtps_info.related_sample_identity;
     dds_info->valid_data = rtps_info.sampleKind == eprosima::fastrtps::rtps::ALIVE ? true : false;
+    dds_info->instance_state = instance_state_of(rtps_info.sampleKind);
+}
+
+static bool is_in_native_representation(
+        const SerializedPayload_t& payload)
+{
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
+    constexpr octet native_representation = CDR_BE;
+#else
+    constexpr octet native_representation = CDR_LE;
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
+
+    return payload.length > SerializedPayload_t::representation_header_size &&
+           payload.data[0] == 0 && payload.data[1] == native_representation;
+}
+
+class DataReaderImpl::LoanCollection
+{
+public:
+
+    //! Buffers loaned to the collections of one read or take operation
+    struct Loan
+    {
+        //! Buffer loaned to the data_values collection
+        std::vector<void*> data_buffer;
+        //! Buffer loaned to the sample_infos sequence, pointing to the elements of infos
+        std::vector<void*> info_buffer;
+        std::vector<SampleInfo> infos;
+        //! Payloads referenced by samples loaned in place. Empty for samples deserialized on the sample pool.
+        std::vector<PayloadInfo_t> payloads;
+        //! Number of samples on the loan
+        LoanableCollection::size_type length = 0;
+
+        LoanableCollection::size_type maximum() const
+        {
+            return static_cast<LoanableCollection::size_type>(data_buffer.size());
+        }
+
+        void reserve(
+                LoanableCollection::size_type max_samples)
+        {
+            if (max_samples > maximum())
+            {
+                data_buffer.resize(max_samples, nullptr);
+                info_buffer.resize(max_samples, nullptr);
+                infos.resize(max_samples);
+                payloads.resize(max_samples);
+                for (LoanableCollection::size_type n = 0; n < max_samples; ++n)
+                {
+                    info_buffer[n] = &infos[n];
+                }
+            }
+            length = 0;
+        }
 
-    switch (rtps_info.sampleKind)
+    };
+
+    explicit LoanCollection(
+            const TypeSupport& type)
+        : type_(type)
     {
-        case eprosima::fastrtps::rtps::ALIVE:
-            dds_info->instance_state = ALIVE_INSTANCE_STATE;
-            break;
-        case eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED:
-            dds_info->instance_state = NOT_ALIVE_DISPOSED_INSTANCE_STATE;
-            break;
-        default:
-            //TODO [ILG] change this if the other kinds ever get implemented
-            dds_info->instance_state = ALIVE_INSTANCE_STATE;
-            break;
     }
-}
+
+    ~LoanCollection()
+    {
+        for (std::unique_ptr<Loan>& loan : loans_)
+        {
+            release_samples(*loan);
+        }
+
+        for (void* sample : free_samples_)
+        {
+            type_->deleteData(sample);
+        }
+    }
+
+    Loan* get_loan(
+            LoanableCollection::size_type max_samples)
+    {
+        std::unique_ptr<Loan> loan;
+        if (free_loans_.empty())
+        {
+            loan.reset(new Loan());
+        }
+        else
+        {
+            loan = std::move(free_loans_.back());
+            free_loans_.pop_back();
+        }
+
+        loan->reserve(max_samples);
+        loans_.push_back(std::move(loan));
+        return loans_.back().get();
+    }
+
+    bool return_loan(
+            const LoanableCollection::element_type* data_buffer,
+            const LoanableCollection::element_type* info_buffer)
+    {
+        for (auto it = loans_.begin(); it != loans_.end(); ++it)
+        {
+            if ((*it)->data_buffer.data() == data_buffer && (*it)->info_buffer.data() == info_buffer)
+            {
+                release_samples(**it);
+                free_loans_.push_back(std::move(*it));
+                loans_.erase(it);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Reference the payload of a change on a loan, so its sample can be accessed in place.
+     * @return pointer to the sample, or nullptr if the payload could not be referenced.
+     */
+    void* reference_payload(
+            CacheChange_t& change,
+            Loan& loan,
+            LoanableCollection::size_type index)
+    {
+        CacheChange_t payload_ref;
+        payload_ref.writerGUID = change.writerGUID;
+        payload_ref.sequenceNumber = change.sequenceNumber;
+
+        IPayloadPool* owner = change.payload_owner();
+        if (!owner->get_payload(change.serializedPayload, owner, payload_ref))
+        {
+            return nullptr;
+        }
+
+        void* sample = payload_ref.serializedPayload.data + SerializedPayload_t::representation_header_size;
+        loan.payloads[index].move_from_change(payload_ref);
+        loan.data_buffer[index] = sample;
+        return sample;
+    }
+
+    void* get_sample()
+    {
+        if (free_samples_.empty())
+        {
+            return type_->createData();
+        }
+
+        void* sample = free_samples_.back();
+        free_samples_.pop_back();
+        return sample;
+    }
+
+    void return_sample(
+            void* sample)
+    {
+        free_samples_.push_back(sample);
+    }
+
+private:
+
+    void release_samples(
+            Loan& loan)
+    {
+        for (LoanableCollection::size_type n = 0; n < loan.length; ++n)
+        {
+            PayloadInfo_t& payload = loan.payloads[n];
+            if (payload.payload_owner != nullptr)
+            {
+                CacheChange_t change;
+                payload.move_into_change(change);
+                change.payload_owner()->release_payload(change);
+            }
+            else
+            {
+                free_samples_.push_back(loan.data_buffer[n]);
+            }
+            loan.data_buffer[n] = nullptr;
+        }
+        loan.length = 0;
+    }
+
+    TypeSupport type_;
+
+    //! Loans currently held by the application
+    std::vector<std::unique_ptr<Loan>> loans_;
+
+    //! Returned loans, kept to reuse their buffers
+    std::vector<std::unique_ptr<Loan>> free_loans_;
+
+    //! Samples not currently loaned, kept to avoid creating them on every loan
+    std::vector<void*> free_samples_;
+};
 
 DataReaderImpl::DataReaderImpl(
         SubscriberImpl* s,
@@ -172,6 +363,7 @@ ReturnCode_t DataReaderImpl::enable()
     }
 
     reader_ = reader;
+    loans_.reset(new LoanCollection(type_));
 
     deadline_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
                     [&]() -> bool
@@ -211,6 +403,8 @@ DataReaderImpl::~DataReaderImpl()
     if (reader_ != nullptr)
     {
         logInfo(DATA_READER, guid().entityId << " in topic: " << topic_->get_name());
+        // Loaned payloads should be released before the payload pool
+        loans_.reset();
         RTPSDomain::removeRTPSReader(reader_);
         release_payload_pool();
     }
@@ -283,6 +477,251 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ReturnCode_t DataReaderImpl::read(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, sample_states, view_states, instance_states, false);
+}
+
+ReturnCode_t DataReaderImpl::take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, sample_states, view_states, instance_states, true);
+}
+
+ReturnCode_t DataReaderImpl::check_collection_preconditions_and_calc_max_samples(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t& max_samples)
+{
+    // Properties should be the same on both collections
+    if ((data_values.has_ownership() != sample_infos.has_ownership()) ||
+            (data_values.maximum() != sample_infos.maximum()) ||
+            (data_values.length() != sample_infos.length()))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // Collections holding a loan should be returned first
+    if (!data_values.has_ownership())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // Samples will be copied into the collections, up to their maximum
+    if (0 < data_values.maximum())
+    {
+        int32_t collection_max = static_cast<int32_t>(data_values.maximum());
+
+        // All negative values are considered LENGTH_UNLIMITED
+        if (0 > max_samples)
+        {
+            max_samples = collection_max;
+        }
+        else if (max_samples > collection_max)
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataReaderImpl::read_or_take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states,
+        bool should_take)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    ReturnCode_t code = check_collection_preconditions_and_calc_max_samples(data_values, sample_infos, max_samples);
+    if (!code)
+    {
+        return code;
+    }
+
+    // Samples are always notified as not new
+    if (0 == max_samples || 0 == (view_states & NOT_NEW_VIEW_STATE))
+    {
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+#if HAVE_STRICT_REALTIME
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+#else
+            std::chrono::hours(24);
+#endif // if HAVE_STRICT_REALTIME
+
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+
+    uint32_t history_size = static_cast<uint32_t>(history_.getHistorySize());
+    if (0 == history_size)
+    {
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    // Buffers are loaned when the collections have no elements
+    LoanCollection::Loan* loan = nullptr;
+    uint32_t max = static_cast<uint32_t>(max_samples);
+    if (0 == data_values.maximum())
+    {
+        if (0 > max_samples || max > history_size)
+        {
+            max = history_size;
+        }
+        loan = loans_->get_loan(max);
+    }
+    else
+    {
+        sample_infos.length(max);
+    }
+
+    bool is_plain = type_->is_plain();
+    uint32_t count = 0;
+
+    auto sample_visitor = [&](CacheChange_t* change, uint32_t ownership_strength) -> bool
+            {
+                SampleStateKind sample_state = change->isRead ? READ_SAMPLE_STATE : NOT_READ_SAMPLE_STATE;
+                InstanceStateKind instance_state = instance_state_of(change->kind);
+                if (0 == (sample_states & sample_state) || 0 == (instance_states & instance_state))
+                {
+                    return false;
+                }
+
+                SampleInfo_t rtps_info;
+                void* sample = nullptr;
+                bool is_valid = false;
+                if (loan == nullptr)
+                {
+                    sample = data_values.buffer()[count];
+                    is_valid = history_.deserialize_change(change, ownership_strength, sample, &rtps_info);
+                }
+                else if (is_plain && change->kind == eprosima::fastrtps::rtps::ALIVE &&
+                        change->payload_owner() == payload_pool_.get() &&
+                        is_in_native_representation(change->serializedPayload))
+                {
+                    // Plain samples are loaned straight from the payload pool
+                    sample = loans_->reference_payload(*change, *loan, count);
+                    is_valid = sample != nullptr;
+                    if (is_valid)
+                    {
+                        history_.get_change_info(change, ownership_strength, sample, &rtps_info);
+                    }
+                }
+                else
+                {
+                    sample = loans_->get_sample();
+                    is_valid = history_.deserialize_change(change, ownership_strength, sample, &rtps_info);
+                    if (is_valid)
+                    {
+                        loan->data_buffer[count] = sample;
+                    }
+                    else
+                    {
+                        loans_->return_sample(sample);
+                    }
+                }
+
+                // Invalid samples are consumed, but not returned
+                if (is_valid)
+                {
+                    SampleInfo* info = loan ? &loan->infos[count] : &sample_infos[count];
+                    sample_info_to_dds(rtps_info, info);
+                    info->sample_state = sample_state;
+                    ++count;
+                    if (loan != nullptr)
+                    {
+                        loan->length = count;
+                    }
+                }
+
+                return true;
+            };
+
+    bool locked = history_.access_changes(max_blocking_time, max, should_take, sample_visitor);
+
+    if (loan != nullptr)
+    {
+        if (0 < count)
+        {
+            data_values.loan(loan->data_buffer.data(), loan->maximum(), count);
+            sample_infos.loan(loan->info_buffer.data(), loan->maximum(), count);
+        }
+        else
+        {
+            loans_->return_loan(loan->data_buffer.data(), loan->info_buffer.data());
+        }
+    }
+    else
+    {
+        data_values.length(count);
+        sample_infos.length(count);
+    }
+
+    if (!locked)
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+
+    return 0 < count ? ReturnCode_t::RETCODE_OK : ReturnCode_t::RETCODE_NO_DATA;
+}
+
+ReturnCode_t DataReaderImpl::return_loan(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos)
+{
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // Properties should be the same on both collections
+    if ((data_values.has_ownership() != sample_infos.has_ownership()) ||
+            (data_values.maximum() != sample_infos.maximum()) ||
+            (data_values.length() != sample_infos.length()))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // Nothing to do on collections without a loan
+    if (data_values.has_ownership())
+    {
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    if (!loans_->return_loan(data_values.buffer(), sample_infos.buffer()))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    data_values.unloan();
+    sample_infos.unloan();
+    return ReturnCode_t::RETCODE_OK;
+}
+
 ReturnCode_t DataReaderImpl::get_first_untaken_info(
         SampleInfo* info)
 {
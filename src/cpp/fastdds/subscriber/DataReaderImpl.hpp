@@ -21,6 +21,7 @@
 #define _FASTRTPS_DATAREADERIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
@@ -38,6 +39,7 @@
 #include <fastrtps/qos/LivelinessChangedStatus.h>
 #include <fastrtps/types/TypesBase.h>
 
+#include <rtps/common/PayloadInfo_t.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
 using eprosima::fastrtps::types::ReturnCode_t;
@@ -69,6 +71,9 @@ protected:
 
     using ITopicPayloadPool = eprosima::fastrtps::rtps::ITopicPayloadPool;
     using IPayloadPool = eprosima::fastrtps::rtps::IPayloadPool;
+    using PayloadInfo_t = eprosima::fastrtps::rtps::detail::PayloadInfo_t;
+
+    class LoanCollection;
 
     friend class SubscriberImpl;
 
@@ -101,23 +106,29 @@ public:
 
     ///@{
 
-    /* TODO
-       bool read(
-            std::vector<void*>& data_values,
-            std::vector<fastrtps::SampleInfo>& sample_infos,
-            uint32_t max_samples);
-     */
+    ReturnCode_t read(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
 
     ReturnCode_t read_next_sample(
             void* data,
             SampleInfo* info);
 
-    /* TODO
-       bool take(
-            std::vector<void*>& data_values,
-            std::vector<fastrtps::SampleInfo>& sample_infos,
-            uint32_t max_samples);
-     */
+    ReturnCode_t take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    ReturnCode_t return_loan(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos);
 
     ReturnCode_t take_next_sample(
             void* data,
@@ -306,6 +317,9 @@ protected:
 
     std::shared_ptr<ITopicPayloadPool> payload_pool_;
 
+    //! Buffers loaned to the application by read and take operations
+    std::unique_ptr<LoanCollection> loans_;
+
     /**
      * @brief A method called when a new cache change is added
      * @param change The cache change that has been added
@@ -348,6 +362,24 @@ protected:
 
     std::shared_ptr<IPayloadPool> get_payload_pool();
 
+    ReturnCode_t read_or_take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states,
+            bool should_take);
+
+    /**
+     * Check the preconditions of the collections received on a read or take operation, and compute the
+     * maximum number of samples that can be returned on them.
+     */
+    ReturnCode_t check_collection_preconditions_and_calc_max_samples(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t& max_samples);
+
     void release_payload_pool();
 
 };
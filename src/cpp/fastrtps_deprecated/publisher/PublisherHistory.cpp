@@ -91,7 +91,7 @@ void PublisherHistory::rebuild_instances()
             t_m_Inst_Caches::iterator vit;
             if (find_or_add_key(change->instanceHandle, &vit))
             {
-                vit->second.cache_changes.push_back(change);
+                keyed_changes_.push_change(vit, change);
             }
         }
     }
@@ -207,7 +207,7 @@ bool PublisherHistory::add_pub_change(
 
         if (add)
         {
-            vit->second.cache_changes.push_back(change);
+            keyed_changes_.push_change(vit, change);
         }
     }
 
@@ -244,7 +244,7 @@ bool PublisherHistory::find_or_add_key(
 
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
-        *vit_out = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        *vit_out = keyed_changes_.insert(instance_handle);
         return true;
     }
 
@@ -331,7 +331,7 @@ bool PublisherHistory::remove_change_pub(
             {
                 if (remove_change(change))
                 {
-                    vit->second.cache_changes.erase(chit);
+                    keyed_changes_.erase_change(vit, chit);
                     m_isHistoryFull = false;
                     return true;
                 }
@@ -382,7 +382,7 @@ bool PublisherHistory::remove_instance_changes(
         }
     }
 
-    vit->second.cache_changes.erase(vit->second.cache_changes.begin(), chit);
+    keyed_changes_.erase_changes(vit, vit->second.cache_changes.begin(), chit);
 
     if (vit->second.cache_changes.empty())
     {
@@ -410,12 +410,13 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        keyed_changes_.set_next_deadline(vit, next_deadline_us);
         return true;
     }
 
@@ -435,19 +436,7 @@ bool PublisherHistory::get_next_deadline(
 
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
-
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
-        return true;
+        return keyed_changes_.get_next_deadline(handle, next_deadline_us);
     }
     else if (topic_att_.getTopicKind() == NO_KEY)
     {
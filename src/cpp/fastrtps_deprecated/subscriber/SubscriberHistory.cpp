@@ -196,7 +196,7 @@ bool SubscriberHistory::received_change_keep_all_with_key(
         std::vector<CacheChange_t*>& instance_changes = vit->second.cache_changes;
         if (instance_changes.size() < static_cast<size_t>(resource_limited_qos_.max_samples_per_instance))
         {
-            return add_received_change_with_key(a_change, vit->second.cache_changes);
+            return add_received_change_with_key(a_change, vit);
         }
 
         logWarning(SUBSCRIBER, "Change not added due to maximum number of samples per instance");
@@ -228,7 +228,7 @@ bool SubscriberHistory::received_change_keep_last_with_key(
 
         if (add)
         {
-            return add_received_change_with_key(a_change, instance_changes);
+            return add_received_change_with_key(a_change, vit);
         }
     }
 
@@ -264,7 +264,7 @@ bool SubscriberHistory::add_received_change(
 
 bool SubscriberHistory::add_received_change_with_key(
         CacheChange_t* a_change,
-        std::vector<CacheChange_t*>& instance_changes)
+        t_m_Inst_Caches::iterator instance)
 {
     if (m_isHistoryFull)
     {
@@ -284,7 +284,7 @@ bool SubscriberHistory::add_received_change_with_key(
 
         // As the instance should be ordered following the presentation QoS, and
         // we only support ordering by reception timestamp, we can always add at the end.
-        instance_changes.push_back(a_change);
+        keyed_changes_.push_change(instance, a_change);
 
         logInfo(SUBSCRIBER, mp_reader->getGuid().entityId
                 << ": Change " << a_change->sequenceNumber << " added from: "
@@ -336,25 +336,43 @@ bool SubscriberHistory::deserialize_change(
             logError(SUBSCRIBER, "Deserialization of data failed");
             return false;
         }
+
+        // Reliable readers acknowledge data-sharing changes once removed from the history, so only
+        // best-effort readers, or writers replacing unacknowledged changes, may overwrite them while deserializing
+        if (!mp_reader->is_sample_valid(change))
+        {
+            logWarning(SUBSCRIBER, "Change " << change->sequenceNumber << " from " << change->writerGUID
+                                             << " was overwritten by the writer while being read");
+            return false;
+        }
     }
 
     if (info != nullptr)
     {
-        if (topic_att_.topicKind == WITH_KEY &&
-                change->instanceHandle == c_InstanceHandle_Unknown &&
-                change->kind == ALIVE)
-        {
-            bool is_key_protected = false;
+        get_change_info(change, ownership_strength, data, info);
+    }
+
+    return true;
+}
+
+void SubscriberHistory::get_change_info(
+        CacheChange_t* change,
+        uint32_t ownership_strength,
+        void* data,
+        SampleInfo_t* info)
+{
+    if (topic_att_.topicKind == WITH_KEY &&
+            change->instanceHandle == c_InstanceHandle_Unknown &&
+            change->kind == ALIVE)
+    {
+        bool is_key_protected = false;
 #if HAVE_SECURITY
-            is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
+        is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
 #endif // if HAVE_SECURITY
-            type_->getKey(data, &change->instanceHandle, is_key_protected);
-        }
-
-        get_sample_info(info, change, ownership_strength);
+        type_->getKey(data, &change->instanceHandle, is_key_protected);
     }
 
-    return true;
+    get_sample_info(info, change, ownership_strength);
 }
 
 bool SubscriberHistory::readNextData(
@@ -417,6 +435,70 @@ bool SubscriberHistory::takeNextData(
     return false;
 }
 
+bool SubscriberHistory::access_changes(
+        std::chrono::steady_clock::time_point& max_blocking_time,
+        uint32_t max_changes,
+        bool should_take,
+        const std::function<bool(CacheChange_t*, uint32_t)>& visitor)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(SUBSCRIBER, "You need to create a Reader with this History before using it");
+        return false;
+    }
+
+    std::unique_lock<RecursiveTimedMutex> lock(*mp_mutex, std::defer_lock);
+
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return false;
+    }
+
+    uint32_t accepted = 0;
+    for (auto it = m_changes.begin(); it != m_changes.end() && accepted < max_changes; ++it)
+    {
+        CacheChange_t* change = *it;
+        WriterProxy* wp = nullptr;
+        bool is_future_change = false;
+
+        if (!mp_reader->begin_sample_access_nts(change, wp, is_future_change))
+        {
+            logWarning(SUBSCRIBER,
+                    "Removing change " << change->sequenceNumber << " from " << change->writerGUID <<
+                    " because is no longer paired");
+            changes_to_remove_.push_back(change);
+            continue;
+        }
+
+        if (is_future_change)
+        {
+            continue;
+        }
+
+        uint32_t ownership = wp && qos_.m_ownership.kind == EXCLUSIVE_OWNERSHIP_QOS ?
+                wp->ownership_strength() : 0;
+        bool is_accepted = visitor(change, ownership);
+        mp_reader->end_sample_access_nts(change, wp, is_accepted);
+
+        if (is_accepted)
+        {
+            ++accepted;
+            if (should_take)
+            {
+                changes_to_remove_.push_back(change);
+            }
+        }
+    }
+
+    for (CacheChange_t* change : changes_to_remove_)
+    {
+        remove_change_sub(change);
+    }
+    changes_to_remove_.clear();
+
+    return true;
+}
+
 bool SubscriberHistory::get_first_untaken_info(
         SampleInfo_t* info)
 {
@@ -446,24 +528,14 @@ bool SubscriberHistory::find_key(
         return true;
     }
 
-    if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
+    if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances) ||
+            keyed_changes_.erase_empty())
     {
-        *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+        *vit_out = keyed_changes_.insert(a_change->instanceHandle);
         return true;
     }
-    else
-    {
-        for (vit = keyed_changes_.begin(); vit != keyed_changes_.end(); ++vit)
-        {
-            if (vit->second.cache_changes.size() == 0)
-            {
-                keyed_changes_.erase(vit);
-                *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-                return true;
-            }
-        }
-        logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
-    }
+
+    logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
     return false;
 }
 
@@ -487,7 +559,7 @@ bool SubscriberHistory::remove_change_sub(
             {
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
-                    vit->second.cache_changes.erase(chit);
+                    keyed_changes_.erase_change(vit, chit);
                     found = true;
                     break;
                 }
@@ -526,12 +598,13 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        keyed_changes_.set_next_deadline(vit, next_deadline_us);
         return true;
     }
 
@@ -556,17 +629,7 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                        keyed_changes_.end(),
-                        [](
-                            const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                            const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-                        {
-                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-                        });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
-        return true;
+        return keyed_changes_.get_next_deadline(handle, next_deadline_us);
     }
 
     return false;
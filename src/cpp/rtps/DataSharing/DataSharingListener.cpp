@@ -0,0 +1,197 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingListener.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingListener.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+DataSharingListener::DataSharingListener(
+        RTPSReader* reader)
+    : reader_(reader)
+    , is_running_(false)
+    , delivering_pool_(nullptr)
+{
+}
+
+DataSharingListener::~DataSharingListener()
+{
+    stop();
+}
+
+bool DataSharingListener::start()
+{
+    if (!notification_.create(reader_->getGuid()))
+    {
+        return false;
+    }
+
+    is_running_.store(true);
+    listening_thread_ = std::thread(&DataSharingListener::run, this);
+    return true;
+}
+
+void DataSharingListener::stop()
+{
+    if (!is_running_.exchange(false))
+    {
+        return;
+    }
+
+    // Wake up the listening thread so it sees it should finish
+    {
+        std::lock_guard<DataSharingNotification::Segment::mutex> lock(
+            notification_.notification()->notification_mutex);
+        notification_.notification()->new_data.store(true);
+    }
+    notification_.notification()->notification_cv.notify_all();
+
+    if (listening_thread_.joinable())
+    {
+        listening_thread_.join();
+    }
+}
+
+void DataSharingListener::run()
+{
+    DataSharingNotification::Notification* notification = notification_.notification();
+
+    while (is_running_.load())
+    {
+        {
+            std::unique_lock<DataSharingNotification::Segment::mutex> lock(notification->notification_mutex);
+            notification->notification_cv.wait(lock, [&]
+                    {
+                        return notification->new_data.load();
+                    });
+        }
+
+        if (!is_running_.load())
+        {
+            break;
+        }
+
+        // Clear the flag before reading, so notifications arriving meanwhile are not lost
+        notification->new_data.store(false);
+        process_new_data();
+    }
+}
+
+void DataSharingListener::process_new_data()
+{
+    {
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        pools_to_process_.assign(writer_pools_.begin(), writer_pools_.end());
+    }
+
+    CacheChange_t change;
+    for (const std::shared_ptr<ReaderPool>& pool : pools_to_process_)
+    {
+        while (is_running_.load() && pool->get_next_unread_payload(change))
+        {
+            // Inform the reader about the changes it will never get, as if the writer had sent a heartbeat
+            SequenceNumber_t last_sequence_number = pool->last_sequence_number();
+            if (change.sequenceNumber > last_sequence_number + 1)
+            {
+                reader_->processHeartbeatMsg(pool->writer(), pool->next_heartbeat_count(),
+                        change.sequenceNumber, change.sequenceNumber, true, false);
+            }
+
+            delivering_pool_.store(pool.get());
+            reader_->processDataMsg(&change);
+            delivering_pool_.store(nullptr);
+
+            if (change.sequenceNumber > last_sequence_number)
+            {
+                pool->last_sequence_number(change.sequenceNumber);
+            }
+
+            // The payload is owned by the writer's segment
+            change.serializedPayload.data = nullptr;
+            change.payload_owner(nullptr);
+        }
+    }
+
+    pools_to_process_.clear();
+}
+
+bool DataSharingListener::add_datasharing_writer(
+        const GUID_t& writer_guid,
+        bool is_volatile)
+{
+    std::shared_ptr<ReaderPool> pool = std::make_shared<ReaderPool>(is_volatile);
+    if (!pool->init_shared_memory(writer_guid))
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writers_mutex_);
+        purge_retired_pools_nts();
+        writer_pools_.push_back(pool);
+    }
+
+    // Changes may have been published before the pool was added
+    notification_.notify();
+    return true;
+}
+
+bool DataSharingListener::remove_datasharing_writer(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> lock(writers_mutex_);
+    purge_retired_pools_nts();
+
+    auto it = std::find_if(writer_pools_.begin(), writer_pools_.end(),
+                    [&writer_guid](const std::shared_ptr<ReaderPool>& pool)
+                    {
+                        return pool->writer() == writer_guid;
+                    });
+    if (it == writer_pools_.end())
+    {
+        return false;
+    }
+
+    if ((*it)->has_outstanding_payloads())
+    {
+        retired_pools_.push_back(*it);
+    }
+    writer_pools_.erase(it);
+    return true;
+}
+
+void DataSharingListener::purge_retired_pools_nts()
+{
+    retired_pools_.erase(
+        std::remove_if(retired_pools_.begin(), retired_pools_.end(),
+        [](const std::shared_ptr<ReaderPool>& pool)
+        {
+            return !pool->has_outstanding_payloads();
+        }),
+        retired_pools_.end());
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
@@ -0,0 +1,136 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingListener.hpp
+ */
+
+#ifndef RTPS_DATASHARING_DATASHARINGLISTENER_HPP
+#define RTPS_DATASHARING_DATASHARINGLISTENER_HPP
+
+#include <fastdds/rtps/common/Guid.h>
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/DataSharing/ReaderPool.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/**
+ * Receives the notifications of the data-sharing writers matched with a reader.
+ *
+ * A dedicated thread waits on the reader's notification segment. When woken up, it reads
+ * the new changes of every matched data-sharing writer in order, and hands them to the reader
+ * as if they had been received from the network, referencing the payloads in place.
+ */
+class DataSharingListener
+{
+public:
+
+    explicit DataSharingListener(
+            RTPSReader* reader);
+
+    ~DataSharingListener();
+
+    /**
+     * Create the notification segment and start the listening thread.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool start();
+
+    /**
+     * Stop the listening thread.
+     * Should be called before the reader starts its destruction.
+     */
+    void stop();
+
+    /**
+     * Start reading the changes of a data-sharing writer.
+     *
+     * @param writer_guid  GUID of the matched writer.
+     * @param is_volatile  Whether the changes published before matching should be ignored.
+     *
+     * @return true on success, false if the writer's segment could not be opened.
+     */
+    bool add_datasharing_writer(
+            const GUID_t& writer_guid,
+            bool is_volatile);
+
+    /**
+     * Stop reading the changes of a data-sharing writer.
+     * The writer's segment is kept mapped while the reader references any of its payloads.
+     *
+     * @param writer_guid  GUID of the unmatched writer.
+     *
+     * @return true if the writer was matched through data-sharing, false otherwise.
+     */
+    bool remove_datasharing_writer(
+            const GUID_t& writer_guid);
+
+    /**
+     * Check whether a payload owner is the pool of the change being delivered by this listener.
+     * Used by the reader to reference the payload in place instead of copying it.
+     */
+    bool is_delivering(
+            const IPayloadPool* pool) const
+    {
+        return pool != nullptr && pool == delivering_pool_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    void run();
+
+    void process_new_data();
+
+    void purge_retired_pools_nts();
+
+    RTPSReader* reader_;
+
+    DataSharingNotification notification_;
+
+    std::atomic<bool> is_running_;
+
+    std::thread listening_thread_;
+
+    //! Protects writer_pools_ and retired_pools_
+    mutable std::mutex writers_mutex_;
+
+    //! Pools of the currently matched writers
+    std::vector<std::shared_ptr<ReaderPool>> writer_pools_;
+
+    //! Pools of unmatched writers still referenced by changes of the reader
+    std::vector<std::shared_ptr<ReaderPool>> retired_pools_;
+
+    //! Pool of the change being delivered to the reader
+    std::atomic<const IPayloadPool*> delivering_pool_;
+
+    //! Copy of writer_pools_ used by the listening thread, so reception is done without holding writers_mutex_
+    std::vector<std::shared_ptr<ReaderPool>> pools_to_process_;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_DATASHARINGLISTENER_HPP
@@ -0,0 +1,115 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingNotification.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingNotification.hpp>
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+DataSharingNotification::~DataSharingNotification()
+{
+    if (segment_)
+    {
+        segment_.reset();
+        if (is_owner_)
+        {
+            Segment::remove(segment_name_);
+        }
+    }
+}
+
+bool DataSharingNotification::create(
+        const GUID_t& reader_guid)
+{
+    segment_name_ = DataSharingPayloadPool::segment_name("notif", reader_guid);
+    is_owner_ = true;
+
+    try
+    {
+        uint32_t per_allocation_extra_size =
+                Segment::compute_per_allocation_extra_size(alignof(Notification), "fastdds_ds");
+
+        // Remove any segment left behind by a crashed process with the same reader GUID
+        Segment::remove(segment_name_);
+        segment_.reset(new Segment(Segment::create_only, segment_name_,
+                sizeof(Notification) + per_allocation_extra_size + Segment::EXTRA_SEGMENT_SIZE));
+
+        notification_ = segment_->get().construct<Notification>("notification")();
+        notification_->new_data.store(false);
+    }
+    catch (const std::exception& e)
+    {
+        if (segment_)
+        {
+            segment_.reset();
+            Segment::remove(segment_name_);
+        }
+        notification_ = nullptr;
+
+        logError(RTPS_READER, "Failed to create data-sharing notification " << segment_name_ << ": " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool DataSharingNotification::open(
+        const GUID_t& reader_guid)
+{
+    segment_name_ = DataSharingPayloadPool::segment_name("notif", reader_guid);
+    is_owner_ = false;
+
+    try
+    {
+        segment_.reset(new Segment(Segment::open_only, segment_name_));
+        notification_ = segment_->get().find<Notification>("notification").first;
+    }
+    catch (const std::exception& e)
+    {
+        segment_.reset();
+        notification_ = nullptr;
+
+        logWarning(RTPS_WRITER, "Failed to open data-sharing notification " << segment_name_ << ": " << e.what());
+        return false;
+    }
+
+    return notification_ != nullptr;
+}
+
+void DataSharingNotification::notify()
+{
+    // Only the first notification after the reader checked needs to wake it up
+    if (!notification_->new_data.exchange(true))
+    {
+        // Taking the mutex ensures the reader is either before checking new_data or already waiting
+        {
+            std::lock_guard<Segment::mutex> lock(notification_->notification_mutex);
+        }
+        notification_->notification_cv.notify_all();
+    }
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
@@ -0,0 +1,103 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingNotification.hpp
+ */
+
+#ifndef RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP
+#define RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/Guid.h>
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Notification channel of a data-sharing reader.
+ *
+ * Each data-sharing reader creates a small shared memory segment with a condition variable.
+ * Matched data-sharing writers open it to wake up the reader when they publish new changes.
+ */
+class DataSharingNotification
+{
+public:
+
+    using Segment = fastdds::rtps::SharedMemSegment;
+
+    //! Contents of the notification segment
+    struct Notification
+    {
+        //! Whether new changes were published since the reader last checked
+        std::atomic<bool> new_data;
+        Segment::mutex notification_mutex;
+        Segment::condition_variable notification_cv;
+    };
+
+    DataSharingNotification() = default;
+
+    ~DataSharingNotification();
+
+    /**
+     * Create the notification segment of a reader.
+     *
+     * @param reader_guid  GUID of the reader owning the segment.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool create(
+            const GUID_t& reader_guid);
+
+    /**
+     * Open the notification segment of a reader.
+     *
+     * @param reader_guid  GUID of the reader owning the segment.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool open(
+            const GUID_t& reader_guid);
+
+    /**
+     * Wake up the reader, if it was not already notified.
+     */
+    void notify();
+
+    Notification* notification() const
+    {
+        return notification_;
+    }
+
+private:
+
+    std::unique_ptr<Segment> segment_;
+    std::string segment_name_;
+    Notification* notification_ = nullptr;
+    //! Whether the segment was created by this object
+    bool is_owner_ = false;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_DATASHARINGNOTIFICATION_HPP
@@ -0,0 +1,111 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingPayloadPool.cpp
+ */
+
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+#include <rtps/DataSharing/WriterPool.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+DataSharingPayloadPool::~DataSharingPayloadPool()
+{
+}
+
+bool DataSharingPayloadPool::is_enabled(
+        const PropertyPolicy& properties)
+{
+#ifdef FASTDDS_SHM_TRANSPORT_DISABLED
+    static_cast<void>(properties);
+    return false;
+#else
+    const std::string* value = PropertyPolicyHelper::find_property(properties, property_name());
+    return value != nullptr && *value == "true";
+#endif // ifdef FASTDDS_SHM_TRANSPORT_DISABLED
+}
+
+bool DataSharingPayloadPool::is_enabled(
+        const fastdds::dds::ParameterPropertyList_t& properties)
+{
+    for (auto it = properties.begin(); it != properties.end(); ++it)
+    {
+        if (it->first() == property_name())
+        {
+            return it->second() == "true";
+        }
+    }
+    return false;
+}
+
+std::string DataSharingPayloadPool::segment_name(
+        const std::string& kind,
+        const GUID_t& guid)
+{
+    std::stringstream ss;
+    ss << "fastdds_ds_" << kind << "_" << std::hex << std::setfill('0');
+    for (octet value : guid.guidPrefix.value)
+    {
+        ss << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    for (octet value : guid.entityId.value)
+    {
+        ss << std::setw(2) << static_cast<uint32_t>(value);
+    }
+    return ss.str();
+}
+
+std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_writer_pool(
+        const PoolConfig& config)
+{
+    if (config.maximum_size == 0u || config.payload_initial_size == 0u)
+    {
+        logWarning(RTPS_WRITER, "Data-sharing needs a bounded history and a bounded payload size");
+        return nullptr;
+    }
+
+    return std::make_shared<WriterPool>(config.maximum_size, config.payload_initial_size);
+}
+
+bool DataSharingPayloadPool::is_sample_valid(
+        const CacheChange_t& change) const
+{
+    const PayloadNode* node = PayloadNode::from_data(change.serializedPayload.data);
+    return node->sequence_number.load(std::memory_order_acquire) == to_uint64(change.sequenceNumber);
+}
+
+DataSharingPayloadPool::PayloadNode* DataSharingPayloadPool::node_at(
+        uint32_t offset) const
+{
+    return static_cast<PayloadNode*>(segment_->get_address_from_offset(offset));
+}
+
+uint32_t DataSharingPayloadPool::node_offset(
+        PayloadNode* node) const
+{
+    return segment_->get_offset_from_address(node);
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
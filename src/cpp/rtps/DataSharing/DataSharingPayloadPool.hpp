@@ -0,0 +1,241 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataSharingPayloadPool.hpp
+ */
+
+#ifndef RTPS_DATASHARING_DATASHARINGPAYLOADPOOL_HPP
+#define RTPS_DATASHARING_DATASHARINGPAYLOADPOOL_HPP
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <rtps/history/ITopicPayloadPool.h>
+#include <rtps/history/PoolConfig.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class SharedMemSegment;
+
+} // namespace rtps
+} // namespace fastdds
+
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Base class of the payload pools used for data-sharing delivery.
+ *
+ * The payloads of a data-sharing writer live on a shared memory segment, together with a ring
+ * holding the sequence of published changes. Data-sharing readers on the same host map that
+ * segment, follow the ring and reference the payloads in place, without any copy.
+ */
+class DataSharingPayloadPool : public ITopicPayloadPool
+{
+public:
+
+    virtual ~DataSharingPayloadPool();
+
+    /**
+     * Name of the endpoint property used to activate data-sharing delivery.
+     * Data-sharing is enabled on an endpoint when this property is set to "true".
+     */
+    static const char* property_name()
+    {
+        return "fastdds.datasharing";
+    }
+
+    /**
+     * Check whether data-sharing has been requested on the properties of a local endpoint.
+     */
+    static bool is_enabled(
+            const PropertyPolicy& properties);
+
+    /**
+     * Check whether data-sharing has been announced on the properties of a remote endpoint.
+     */
+    static bool is_enabled(
+            const fastdds::dds::ParameterPropertyList_t& properties);
+
+    /**
+     * Get the name of a data-sharing shared memory segment.
+     *
+     * @param kind  Kind of segment ("pool" for writer payloads, "notif" for reader notifications).
+     * @param guid  GUID of the endpoint owning the segment.
+     */
+    static std::string segment_name(
+            const std::string& kind,
+            const GUID_t& guid);
+
+    /**
+     * Create a writer pool for data-sharing delivery.
+     *
+     * @param config  History requirements of the writer.
+     *
+     * @return The new pool, or nullptr when data-sharing cannot be used with the given requirements.
+     * Data-sharing needs both a bounded history and a bounded payload size.
+     */
+    static std::shared_ptr<DataSharingPayloadPool> get_writer_pool(
+            const PoolConfig& config);
+
+    /**
+     * Map the shared memory segment of a writer.
+     * Writer pools create the segment, while reader pools open the one created by the writer.
+     *
+     * @param writer_guid  GUID of the writer owning the segment.
+     *
+     * @return true on success, false otherwise.
+     */
+    virtual bool init_shared_memory(
+            const GUID_t& writer_guid) = 0;
+
+    /**
+     * Check whether the payload of a change taken from this pool is still the one of that change.
+     * Payloads of writer pools are recycled as soon as the writer removes them from its history,
+     * so readers should check a sample after using it in place.
+     */
+    bool is_sample_valid(
+            const CacheChange_t& change) const;
+
+protected:
+
+    using Segment = fastdds::rtps::SharedMemSegment;
+
+    //! Control block at the beginning of the writer's segment
+    struct PoolDescriptor
+    {
+        //! Number of entries on the history ring, which is also the number of payload nodes
+        uint32_t history_size;
+        //! Maximum size of the payloads
+        uint32_t payload_size;
+        //! Size of each payload node, including its header
+        uint32_t node_size;
+        //! Offset of the history ring on the segment
+        uint32_t history_offset;
+        //! Offset of the first payload node on the segment
+        uint32_t nodes_offset;
+        //! Number of changes ever published on the history ring
+        std::atomic<uint64_t> notified_end;
+    };
+
+    //! Entry on the history ring
+    struct HistoryEntry
+    {
+        //! Sequence number of the published change. Zero while the entry is being written.
+        std::atomic<uint64_t> sequence_number;
+        //! Offset of the payload node on the segment
+        std::atomic<uint32_t> node_offset;
+    };
+
+    /**
+     * Header of each payload node. The serialized payload follows the header.
+     *
+     * Readers may access the metadata while the writer is recycling the node, so it is only accessed
+     * atomically, and readers check sequence_number did not change after reading it.
+     */
+    struct PayloadNode
+    {
+        //! Sequence number of the change using this node. Zero when the node is not published.
+        std::atomic<uint64_t> sequence_number;
+        std::atomic<uint64_t> related_sequence_number;
+        std::atomic<int32_t> source_timestamp_seconds;
+        std::atomic<uint32_t> source_timestamp_fraction;
+        std::atomic<uint32_t> data_length;
+        std::atomic<uint16_t> encapsulation;
+        std::atomic<uint8_t> kind;
+        std::atomic<uint64_t> instance_handle[2];
+        std::atomic<uint64_t> related_writer_guid[2];
+
+        static void store_octets(
+                std::atomic<uint64_t> (& words)[2],
+                const octet* value)
+        {
+            uint64_t buffer[2];
+            memcpy(buffer, value, sizeof(buffer));
+            words[0].store(buffer[0], std::memory_order_relaxed);
+            words[1].store(buffer[1], std::memory_order_relaxed);
+        }
+
+        static void load_octets(
+                const std::atomic<uint64_t> (& words)[2],
+                octet* value)
+        {
+            uint64_t buffer[2] = {words[0].load(std::memory_order_relaxed), words[1].load(std::memory_order_relaxed)};
+            memcpy(value, buffer, sizeof(buffer));
+        }
+
+        octet* data()
+        {
+            return reinterpret_cast<octet*>(this) + sizeof(PayloadNode);
+        }
+
+        static PayloadNode* from_data(
+                const octet* data)
+        {
+            return reinterpret_cast<PayloadNode*>(const_cast<octet*>(data) - sizeof(PayloadNode));
+        }
+
+    };
+
+    static uint64_t to_uint64(
+            const SequenceNumber_t& sequence_number)
+    {
+        return (static_cast<uint64_t>(sequence_number.high) << 32) | sequence_number.low;
+    }
+
+    static SequenceNumber_t to_sequence_number(
+            uint64_t value)
+    {
+        return SequenceNumber_t(static_cast<int32_t>(value >> 32), static_cast<uint32_t>(value));
+    }
+
+    static uint32_t aligned_node_size(
+            uint32_t payload_size)
+    {
+        uint32_t size = static_cast<uint32_t>(sizeof(PayloadNode)) + payload_size;
+        return (size + alignof(PayloadNode) - 1u) & ~static_cast<uint32_t>(alignof(PayloadNode) - 1u);
+    }
+
+    PayloadNode* node_at(
+            uint32_t offset) const;
+
+    uint32_t node_offset(
+            PayloadNode* node) const;
+
+    //! Shared memory segment holding the pool
+    std::unique_ptr<Segment> segment_;
+    //! Name of the shared memory segment
+    std::string segment_name_;
+    //! Control block on the segment
+    PoolDescriptor* descriptor_ = nullptr;
+    //! History ring on the segment
+    HistoryEntry* history_ = nullptr;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_DATASHARINGPAYLOADPOOL_HPP
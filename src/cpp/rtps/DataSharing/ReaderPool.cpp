@@ -0,0 +1,201 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderPool.cpp
+ */
+
+#include <rtps/DataSharing/ReaderPool.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+#include <cassert>
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+ReaderPool::ReaderPool(
+        bool is_volatile)
+    : is_volatile_(is_volatile)
+    , outstanding_payloads_(0u)
+{
+}
+
+bool ReaderPool::init_shared_memory(
+        const GUID_t& writer_guid)
+{
+    writer_guid_ = writer_guid;
+    segment_name_ = segment_name("pool", writer_guid);
+
+    try
+    {
+        segment_.reset(new Segment(Segment::open_only, segment_name_));
+        descriptor_ = segment_->get().find<PoolDescriptor>("descriptor").first;
+    }
+    catch (const std::exception& e)
+    {
+        segment_.reset();
+        logWarning(RTPS_READER, "Failed to open data-sharing segment " << segment_name_ << ": " << e.what());
+        return false;
+    }
+
+    if (descriptor_ == nullptr)
+    {
+        segment_.reset();
+        logWarning(RTPS_READER, "Data-sharing segment " << segment_name_ << " is not initialized");
+        return false;
+    }
+
+    history_ = static_cast<HistoryEntry*>(segment_->get_address_from_offset(descriptor_->history_offset));
+
+    // Volatile readers only get the changes published from now on.
+    // Otherwise, start on the oldest change still on the ring.
+    uint64_t end = descriptor_->notified_end.load(std::memory_order_acquire);
+    if (is_volatile_ || end <= descriptor_->history_size)
+    {
+        next_read_ = is_volatile_ ? end : 0u;
+    }
+    else
+    {
+        next_read_ = end - descriptor_->history_size;
+    }
+
+    return true;
+}
+
+bool ReaderPool::get_next_unread_payload(
+        CacheChange_t& cache_change)
+{
+    if (descriptor_ == nullptr)
+    {
+        return false;
+    }
+
+    uint64_t history_size = descriptor_->history_size;
+    uint64_t end = descriptor_->notified_end.load(std::memory_order_acquire);
+    while (next_read_ < end)
+    {
+        // Changes overwritten on the ring before we could read them are lost
+        if (end - next_read_ > history_size)
+        {
+            next_read_ = end - history_size;
+        }
+
+        HistoryEntry& entry = history_[next_read_ % history_size];
+        ++next_read_;
+
+        uint64_t sequence_number = entry.sequence_number.load(std::memory_order_acquire);
+        uint32_t offset = entry.node_offset.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_number == 0u || sequence_number != entry.sequence_number.load(std::memory_order_relaxed))
+        {
+            // The writer is overwriting this entry
+            end = descriptor_->notified_end.load(std::memory_order_acquire);
+            continue;
+        }
+
+        PayloadNode* node = node_at(offset);
+        if (node->sequence_number.load(std::memory_order_acquire) != sequence_number)
+        {
+            // Already removed from the writer's history
+            continue;
+        }
+
+        cache_change.kind = static_cast<ChangeKind_t>(node->kind.load(std::memory_order_relaxed));
+        cache_change.writerGUID = writer_guid_;
+        cache_change.sequenceNumber = to_sequence_number(sequence_number);
+        cache_change.sourceTimestamp.seconds() = node->source_timestamp_seconds.load(std::memory_order_relaxed);
+        cache_change.sourceTimestamp.fraction(node->source_timestamp_fraction.load(std::memory_order_relaxed));
+        PayloadNode::load_octets(node->instance_handle, cache_change.instanceHandle.value);
+
+        SampleIdentity related;
+        octet related_writer_guid[GuidPrefix_t::size + EntityId_t::size];
+        PayloadNode::load_octets(node->related_writer_guid, related_writer_guid);
+        memcpy(related.writer_guid().guidPrefix.value, related_writer_guid, GuidPrefix_t::size);
+        memcpy(related.writer_guid().entityId.value, related_writer_guid + GuidPrefix_t::size, EntityId_t::size);
+        related.sequence_number() = to_sequence_number(node->related_sequence_number.load(std::memory_order_relaxed));
+
+        uint32_t data_length = node->data_length.load(std::memory_order_relaxed);
+        cache_change.serializedPayload.encapsulation = node->encapsulation.load(std::memory_order_relaxed);
+
+        // Check the node was not recycled while we were reading its metadata
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (node->sequence_number.load(std::memory_order_relaxed) != sequence_number)
+        {
+            continue;
+        }
+
+        if (related != SampleIdentity::unknown())
+        {
+            cache_change.write_params.sample_identity(related);
+        }
+        cache_change.write_params.related_sample_identity(related);
+
+        cache_change.serializedPayload.length = data_length;
+        cache_change.serializedPayload.max_size = data_length;
+        cache_change.serializedPayload.data = node->data();
+        cache_change.payload_owner(this);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool ReaderPool::get_payload(
+        uint32_t /*size*/,
+        CacheChange_t& /*cache_change*/)
+{
+    // Payloads of a data-sharing writer are only allocated by the writer
+    return false;
+}
+
+bool ReaderPool::get_payload(
+        SerializedPayload_t& data,
+        IPayloadPool*& data_owner,
+        CacheChange_t& cache_change)
+{
+    assert(data_owner == this);
+    static_cast<void>(data_owner);
+
+    // Reference the payload in place
+    cache_change.serializedPayload.data = data.data;
+    cache_change.serializedPayload.length = data.length;
+    cache_change.serializedPayload.max_size = data.length;
+    cache_change.serializedPayload.encapsulation = data.encapsulation;
+    cache_change.payload_owner(this);
+    ++outstanding_payloads_;
+    return true;
+}
+
+bool ReaderPool::release_payload(
+        CacheChange_t& cache_change)
+{
+    assert(cache_change.payload_owner() == this);
+
+    cache_change.serializedPayload.length = 0;
+    cache_change.serializedPayload.pos = 0;
+    cache_change.serializedPayload.max_size = 0;
+    cache_change.serializedPayload.data = nullptr;
+    cache_change.payload_owner(nullptr);
+    --outstanding_payloads_;
+    return true;
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
@@ -0,0 +1,139 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderPool.hpp
+ */
+
+#ifndef RTPS_DATASHARING_READERPOOL_HPP
+#define RTPS_DATASHARING_READERPOOL_HPP
+
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * View of a data-sharing reader on the pool of a matched writer.
+ *
+ * The pool maps the writer's segment and keeps a cursor on its history ring.
+ * Payloads are never allocated by this pool: changes taken from it reference the writer's
+ * payloads in place.
+ */
+class ReaderPool : public DataSharingPayloadPool
+{
+public:
+
+    /**
+     * @param is_volatile  When true, changes published before the pool was initialized are not read.
+     */
+    explicit ReaderPool(
+            bool is_volatile);
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override;
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override;
+
+    bool release_payload(
+            CacheChange_t& cache_change) override;
+
+    bool reserve_history(
+            const PoolConfig& /*config*/,
+            bool /*is_reader*/) override
+    {
+        return true;
+    }
+
+    bool release_history(
+            const PoolConfig& /*config*/,
+            bool /*is_reader*/) override
+    {
+        return true;
+    }
+
+    size_t payload_pool_allocated_size() const override
+    {
+        return 0u;
+    }
+
+    size_t payload_pool_available_size() const override
+    {
+        return 0u;
+    }
+
+    bool init_shared_memory(
+            const GUID_t& writer_guid) override;
+
+    /**
+     * Get the next change published by the writer not yet read through this pool.
+     * Changes overwritten on the ring, or removed by the writer before being read, are skipped.
+     *
+     * @param [out] cache_change  Change to fill. Its payload will reference the writer's segment.
+     *
+     * @return true when a change was read, false when there are no more changes to read.
+     */
+    bool get_next_unread_payload(
+            CacheChange_t& cache_change);
+
+    const GUID_t& writer() const
+    {
+        return writer_guid_;
+    }
+
+    //! Sequence number of the last change delivered from this pool
+    SequenceNumber_t last_sequence_number() const
+    {
+        return last_sequence_number_;
+    }
+
+    void last_sequence_number(
+            const SequenceNumber_t& sequence_number)
+    {
+        last_sequence_number_ = sequence_number;
+    }
+
+    //! Count for the next heartbeat notifying the reader about lost changes
+    uint32_t next_heartbeat_count()
+    {
+        return ++heartbeat_count_;
+    }
+
+    //! Whether some change of the reader still references a payload of this pool
+    bool has_outstanding_payloads() const
+    {
+        return outstanding_payloads_.load() > 0u;
+    }
+
+private:
+
+    bool is_volatile_;
+    GUID_t writer_guid_;
+    //! Position on the history ring of the next change to read
+    uint64_t next_read_ = 0u;
+    SequenceNumber_t last_sequence_number_;
+    uint32_t heartbeat_count_ = 0u;
+    std::atomic<uint32_t> outstanding_payloads_;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_READERPOOL_HPP
@@ -0,0 +1,252 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterPool.cpp
+ */
+
+#include <rtps/DataSharing/WriterPool.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <rtps/transport/shared_mem/SharedMemSegment.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <new>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+WriterPool::WriterPool(
+        uint32_t pool_size,
+        uint32_t payload_size)
+    : pool_size_(pool_size)
+    , payload_size_(payload_size)
+{
+}
+
+WriterPool::~WriterPool()
+{
+    if (segment_)
+    {
+        segment_.reset();
+        Segment::remove(segment_name_);
+    }
+}
+
+bool WriterPool::init_shared_memory(
+        const GUID_t& writer_guid)
+{
+    segment_name_ = segment_name("pool", writer_guid);
+
+    uint32_t node_size = aligned_node_size(payload_size_);
+    size_t history_bytes = static_cast<size_t>(pool_size_) * sizeof(HistoryEntry);
+    size_t nodes_bytes = static_cast<size_t>(pool_size_) * node_size;
+
+    try
+    {
+        // One named allocation for the descriptor, and two aligned ones for the ring and the nodes
+        uint32_t per_allocation_extra_size =
+                Segment::compute_per_allocation_extra_size(alignof(PayloadNode), "fastdds_ds");
+        size_t segment_size = sizeof(PoolDescriptor) + history_bytes + nodes_bytes +
+                3u * (per_allocation_extra_size + alignof(PayloadNode)) + Segment::EXTRA_SEGMENT_SIZE;
+
+        // Remove any segment left behind by a crashed process with the same writer GUID
+        Segment::remove(segment_name_);
+        segment_.reset(new Segment(Segment::create_only, segment_name_, segment_size));
+
+        descriptor_ = segment_->get().construct<PoolDescriptor>("descriptor")();
+        void* history_buffer = segment_->get().allocate_aligned(history_bytes, alignof(HistoryEntry));
+        void* nodes_buffer = segment_->get().allocate_aligned(nodes_bytes, alignof(PayloadNode));
+
+        history_ = static_cast<HistoryEntry*>(history_buffer);
+        for (uint32_t i = 0; i < pool_size_; ++i)
+        {
+            new (&history_[i]) HistoryEntry();
+        }
+
+        free_nodes_.reserve(pool_size_);
+        octet* node_address = static_cast<octet*>(nodes_buffer);
+        for (uint32_t i = 0; i < pool_size_; ++i)
+        {
+            free_nodes_.push_back(new (node_address) PayloadNode());
+            node_address += node_size;
+        }
+
+        descriptor_->history_size = pool_size_;
+        descriptor_->payload_size = payload_size_;
+        descriptor_->node_size = node_size;
+        descriptor_->history_offset = segment_->get_offset_from_address(history_buffer);
+        descriptor_->nodes_offset = segment_->get_offset_from_address(nodes_buffer);
+        descriptor_->notified_end.store(0u, std::memory_order_release);
+    }
+    catch (const std::exception& e)
+    {
+        if (segment_)
+        {
+            segment_.reset();
+            Segment::remove(segment_name_);
+        }
+        descriptor_ = nullptr;
+        history_ = nullptr;
+        free_nodes_.clear();
+
+        logError(RTPS_WRITER, "Failed to create data-sharing segment " << segment_name_ << ": " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool WriterPool::get_payload(
+        uint32_t size,
+        CacheChange_t& cache_change)
+{
+    PayloadNode* node = nullptr;
+
+    if (size <= payload_size_)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_nodes_.empty())
+        {
+            node = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+    }
+
+    if (node == nullptr)
+    {
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.payload_owner(nullptr);
+        return false;
+    }
+
+    cache_change.serializedPayload.data = node->data();
+    cache_change.serializedPayload.max_size = payload_size_;
+    cache_change.payload_owner(this);
+    return true;
+}
+
+bool WriterPool::get_payload(
+        SerializedPayload_t& data,
+        IPayloadPool*& /*data_owner*/,
+        CacheChange_t& cache_change)
+{
+    // Payloads on the segment are owned by a single change, so we always copy
+    if (get_payload(data.length, cache_change))
+    {
+        if (!cache_change.serializedPayload.copy(&data, true))
+        {
+            release_payload(cache_change);
+            return false;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+bool WriterPool::release_payload(
+        CacheChange_t& cache_change)
+{
+    assert(cache_change.payload_owner() == this);
+
+    // Readers still referencing the payload will see it is no longer valid
+    PayloadNode* node = PayloadNode::from_data(cache_change.serializedPayload.data);
+    node->sequence_number.store(0u, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_nodes_.push_back(node);
+    }
+
+    cache_change.serializedPayload.length = 0;
+    cache_change.serializedPayload.pos = 0;
+    cache_change.serializedPayload.max_size = 0;
+    cache_change.serializedPayload.data = nullptr;
+    cache_change.payload_owner(nullptr);
+    return true;
+}
+
+bool WriterPool::reserve_history(
+        const PoolConfig& config,
+        bool is_reader)
+{
+    // The pool is private to a single writer, and its size is fixed on construction
+    return !is_reader && config.maximum_size <= pool_size_;
+}
+
+bool WriterPool::release_history(
+        const PoolConfig& /*config*/,
+        bool is_reader)
+{
+    return !is_reader;
+}
+
+size_t WriterPool::payload_pool_available_size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_nodes_.size();
+}
+
+void WriterPool::add_to_shared_history(
+        const CacheChange_t* change)
+{
+    if (descriptor_ == nullptr || change->payload_owner() != this)
+    {
+        return;
+    }
+
+    PayloadNode* node = PayloadNode::from_data(change->serializedPayload.data);
+    uint64_t sequence_number = to_uint64(change->sequenceNumber);
+    if (node->sequence_number.load(std::memory_order_relaxed) == sequence_number)
+    {
+        return;
+    }
+
+    // Fill the node metadata before making it visible.
+    // The fence keeps readers still checking the previous use of the node from taking the new metadata as valid.
+    std::atomic_thread_fence(std::memory_order_release);
+    node->data_length.store(change->serializedPayload.length, std::memory_order_relaxed);
+    node->encapsulation.store(change->serializedPayload.encapsulation, std::memory_order_relaxed);
+    node->kind.store(static_cast<uint8_t>(change->kind), std::memory_order_relaxed);
+    node->source_timestamp_seconds.store(change->sourceTimestamp.seconds(), std::memory_order_relaxed);
+    node->source_timestamp_fraction.store(change->sourceTimestamp.fraction(), std::memory_order_relaxed);
+    PayloadNode::store_octets(node->instance_handle, change->instanceHandle.value);
+
+    const SampleIdentity& related = change->write_params.related_sample_identity();
+    octet related_writer_guid[GuidPrefix_t::size + EntityId_t::size];
+    memcpy(related_writer_guid, related.writer_guid().guidPrefix.value, GuidPrefix_t::size);
+    memcpy(related_writer_guid + GuidPrefix_t::size, related.writer_guid().entityId.value, EntityId_t::size);
+    PayloadNode::store_octets(node->related_writer_guid, related_writer_guid);
+    node->related_sequence_number.store(to_uint64(related.sequence_number()), std::memory_order_relaxed);
+    node->sequence_number.store(sequence_number, std::memory_order_release);
+
+    // Write the ring entry, using its sequence number as a guard for concurrent readers
+    uint64_t end = descriptor_->notified_end.load(std::memory_order_relaxed);
+    HistoryEntry& entry = history_[end % pool_size_];
+    entry.sequence_number.store(0u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.node_offset.store(node_offset(node), std::memory_order_relaxed);
+    entry.sequence_number.store(sequence_number, std::memory_order_release);
+
+    descriptor_->notified_end.store(end + 1u, std::memory_order_release);
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
@@ -0,0 +1,110 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterPool.hpp
+ */
+
+#ifndef RTPS_DATASHARING_WRITERPOOL_HPP
+#define RTPS_DATASHARING_WRITERPOOL_HPP
+
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Payload pool of a data-sharing writer.
+ *
+ * All the payloads are preallocated on a shared memory segment created by the writer.
+ * A payload node is only visible to the readers once the change using it is published
+ * with add_to_shared_history, and stops being valid as soon as it is released.
+ */
+class WriterPool : public DataSharingPayloadPool
+{
+public:
+
+    /**
+     * @param pool_size     Number of payloads on the pool.
+     * @param payload_size  Maximum size of each payload.
+     */
+    WriterPool(
+            uint32_t pool_size,
+            uint32_t payload_size);
+
+    ~WriterPool();
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override;
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override;
+
+    bool release_payload(
+            CacheChange_t& cache_change) override;
+
+    bool reserve_history(
+            const PoolConfig& config,
+            bool is_reader) override;
+
+    bool release_history(
+            const PoolConfig& config,
+            bool is_reader) override;
+
+    size_t payload_pool_allocated_size() const override
+    {
+        return pool_size_;
+    }
+
+    size_t payload_pool_available_size() const override;
+
+    bool init_shared_memory(
+            const GUID_t& writer_guid) override;
+
+    /**
+     * Publish a change on the shared history, making it available to the data-sharing readers.
+     * Publishing an already published change has no effect.
+     *
+     * @pre The caller holds the writer's mutex.
+     *
+     * @param change  Change to publish. Its payload should have been taken from this pool.
+     */
+    void add_to_shared_history(
+            const CacheChange_t* change);
+
+private:
+
+    //! Number of payloads on the pool
+    uint32_t pool_size_;
+    //! Maximum size of each payload
+    uint32_t payload_size_;
+
+    //! Payload nodes not in use
+    std::vector<PayloadNode*> free_nodes_;
+    //! Protects free_nodes_
+    mutable std::mutex mutex_;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_DATASHARING_WRITERPOOL_HPP
@@ -44,6 +44,7 @@
 #include <foonathan/memory/memory_pool.hpp>
 
 #include <rtps/builtin/data/ProxyHashTables.hpp>
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <utils/collections/node_size_helpers.hpp>
@@ -63,6 +64,28 @@ namespace rtps {
 using reader_map_helper = utilities::collections::map_size_helper<GUID_t, SubscriptionMatchedStatus>;
 using writer_map_helper = utilities::collections::map_size_helper<GUID_t, PublicationMatchedStatus>;
 
+/**
+ * Selects the proxies of the local participant among the proxies of the endpoints on a topic.
+ * @param topic_proxies Proxies of the endpoints on the topic.
+ * @param local_prefix GUID prefix of the local participant.
+ * @return Proxies of the local endpoints on the topic.
+ */
+template<typename ProxyData>
+static std::vector<ProxyData*> local_proxies(
+        const std::vector<ProxyData*>& topic_proxies,
+        const GuidPrefix_t& local_prefix)
+{
+    std::vector<ProxyData*> ret_val;
+    for (ProxyData* proxy : topic_proxies)
+    {
+        if (proxy->guid().guidPrefix == local_prefix)
+        {
+            ret_val.push_back(proxy);
+        }
+    }
+    return ret_val;
+}
+
 EDP::EDP(
         PDP* p,
         RTPSParticipantImpl* part)
@@ -146,6 +169,11 @@ bool EDP::newLocalReaderProxyData(
                 }
                 rpd->m_qos.setQos(rqos, true);
                 rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
+                if (reader->is_datasharing_compatible())
+                {
+                    rpd->properties().push_back(std::pair<std::string, std::string>(
+                                DataSharingPayloadPool::property_name(), "true"));
+                }
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
                 {
@@ -273,6 +301,11 @@ bool EDP::newLocalWriterProxyData(
                 wpd->typeMaxSerialized(writer->getTypeMaxSerialized());
                 wpd->m_qos.setQos(wqos, true);
                 wpd->userDefinedId(writer->getAttributes().getUserDefinedID());
+                if (writer->is_datasharing_compatible())
+                {
+                    wpd->properties().push_back(std::pair<std::string, std::string>(
+                                DataSharingPayloadPool::property_name(), "true"));
+                }
                 wpd->persistence_guid(writer->getAttributes().persistence_guid);
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
@@ -1001,75 +1034,73 @@ bool EDP::pairingReader(
     logInfo(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the writers on the same topic are candidates. The collection is copied, as listeners may modify it.
+    std::vector<WriterProxyData*> writers = mp_PDP->writers_on_topic(rdata.topicName());
+    for (WriterProxyData* wdatait : writers)
     {
-        for (auto& pair : *(*pit)->m_writers)
-        {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = R->getGuid();
-            const GUID_t& writer_guid = wdatait->guid();
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = R->getGuid();
+        const GUID_t& writer_guid = wdatait->guid();
 
-            if (valid)
-            {
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                        *wdatait, R->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            GUID_t remote_participant_guid(wdatait->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, remote_participant_guid,
+                    *wdatait, R->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (R->matched_writer_add(*wdatait))
+            if (R->matched_writer_add(*wdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
+                        wdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
-                            wdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, 1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, 1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
-                {
-                    R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
-                }
+                R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (R->matched_writer_is_matched(wdatait->guid())
-                        && R->matched_writer_remove(wdatait->guid()))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (R->matched_writer_is_matched(wdatait->guid())
+                    && R->matched_writer_remove(wdatait->guid()))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid());
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, -1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, -1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
             }
         }
@@ -1088,80 +1119,78 @@ bool EDP::pairingWriter(
     logInfo(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Only the readers on the same topic are candidates. The collection is copied, as listeners may modify it.
+    std::vector<ReaderProxyData*> readers = mp_PDP->readers_on_topic(wdata.topicName());
+    for (ReaderProxyData* rdatait : readers)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        const GUID_t& reader_guid = rdatait->guid();
+        if (reader_guid == c_Guid_Unknown)
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid();
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
 
-            if (valid)
-            {
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                        *rdatait, W->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            GUID_t remote_participant_guid(rdatait->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), remote_participant_guid,
+                    *rdatait, W->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-                if (W->matched_reader_add(*rdatait))
+            if (W->matched_reader_add(*rdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
+                        rdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
-                            rdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, 1);
-                        W->getListener()->onWriterMatched(W, pub_info);
-                    }
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, 1);
+                    W->getListener()->onWriterMatched(W, pub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
-                {
-                    W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
-                }
+                W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, -1);
-                        W->getListener()->onWriterMatched(W, pub_info);
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, -1);
+                    W->getListener()->onWriterMatched(W, pub_info);
 
 
-                    }
                 }
             }
         }
@@ -1177,74 +1206,81 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
 
     logInfo(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+
+    // Only the local writers on the same topic are candidates
+    std::vector<WriterProxyData*> topic_writers = local_proxies(mp_PDP->writers_on_topic(rdata->topicName()),
+                    mp_RTPSParticipant->getGuid().guidPrefix);
+    if (topic_writers.empty())
+    {
+        return true;
+    }
+
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    for (WriterProxyData* wdata : topic_writers)
     {
-        (*wit)->getMutex().lock();
-        GUID_t writerGUID = (*wit)->getGuid();
-        (*wit)->getMutex().unlock();
-        if (mp_PDP->lookupWriterProxyData(writerGUID, temp_writer_proxy_data_))
+        GUID_t writerGUID = wdata->guid();
+        RTPSWriter* writer = mp_RTPSParticipant->find_local_writer(writerGUID);
+        if (writer != nullptr)
         {
             MatchingFailureMask no_match_reason;
             fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&temp_writer_proxy_data_, rdata, no_match_reason, incompatible_qos);
+            bool valid = valid_matching(wdata, rdata, no_match_reason, incompatible_qos);
             const GUID_t& reader_guid = rdata->guid();
 
             if (valid)
             {
 #if HAVE_SECURITY
                 if (!mp_RTPSParticipant->security_manager().discovered_reader(writerGUID, participant_guid,
-                        *rdata, (*wit)->getAttributes().security_attributes()))
+                        *rdata, writer->getAttributes().security_attributes()))
                 {
                     logError(RTPS_EDP, "Security manager returns an error for writer " << writerGUID);
                 }
 #else
-                if ((*wit)->matched_reader_add(*rdata))
+                if (writer->matched_reader_add(*rdata))
                 {
                     logInfo(RTPS_EDP_MATCH,
-                            "RP:" << rdata->guid() << " match W:" << (*wit)->getGuid() << ". RLoc:" <<
+                            "RP:" << rdata->guid() << " match W:" << writer->getGuid() << ". RLoc:" <<
                             rdata->remote_locators());
                     //MATCHED AND ADDED CORRECTLY:
-                    if ((*wit)->getListener() != nullptr)
+                    if (writer->getListener() != nullptr)
                     {
                         MatchingInfo info;
                         info.status = MATCHED_MATCHING;
                         info.remoteEndpointGuid = reader_guid;
-                        (*wit)->getListener()->onWriterMatched((*wit), info);
+                        writer->getListener()->onWriterMatched(writer, info);
 
                         const PublicationMatchedStatus& pub_info =
                                 update_publication_matched_status(reader_guid, writerGUID, 1);
-                        (*wit)->getListener()->onWriterMatched((*wit), pub_info);
+                        writer->getListener()->onWriterMatched(writer, pub_info);
                     }
                 }
 #endif // if HAVE_SECURITY
             }
             else
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && (*wit)->getListener() != nullptr)
+                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && writer->getListener() != nullptr)
                 {
-                    (*wit)->getListener()->on_offered_incompatible_qos((*wit), incompatible_qos);
+                    writer->getListener()->on_offered_incompatible_qos(writer, incompatible_qos);
                 }
 
-                if ((*wit)->matched_reader_is_matched(reader_guid)
-                        && (*wit)->matched_reader_remove(reader_guid))
+                if (writer->matched_reader_is_matched(reader_guid)
+                        && writer->matched_reader_remove(reader_guid))
                 {
 #if HAVE_SECURITY
                     mp_RTPSParticipant->security_manager().remove_reader(
-                        (*wit)->getGuid(), participant_guid, reader_guid);
+                        writer->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
                     //MATCHED AND ADDED CORRECTLY:
-                    if ((*wit)->getListener() != nullptr)
+                    if (writer->getListener() != nullptr)
                     {
                         MatchingInfo info;
                         info.status = REMOVED_MATCHING;
                         info.remoteEndpointGuid = reader_guid;
-                        (*wit)->getListener()->onWriterMatched((*wit), info);
+                        writer->getListener()->onWriterMatched(writer, info);
 
                         const PublicationMatchedStatus& pub_info =
                                 update_publication_matched_status(reader_guid, writerGUID, -1);
-                        (*wit)->getListener()->onWriterMatched((*wit), pub_info);
+                        writer->getListener()->onWriterMatched(writer, pub_info);
                     }
                 }
             }
@@ -1372,75 +1408,81 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
 
     logInfo(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+
+    // Only the local readers on the same topic are candidates
+    std::vector<ReaderProxyData*> topic_readers = local_proxies(mp_PDP->readers_on_topic(wdata->topicName()),
+                    mp_RTPSParticipant->getGuid().guidPrefix);
+    if (topic_readers.empty())
+    {
+        return true;
+    }
+
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    for (ReaderProxyData* rdata : topic_readers)
     {
-        GUID_t readerGUID;
-        (*rit)->getMutex().lock();
-        readerGUID = (*rit)->getGuid();
-        (*rit)->getMutex().unlock();
-        if (mp_PDP->lookupReaderProxyData(readerGUID, temp_reader_proxy_data_))
+        GUID_t readerGUID = rdata->guid();
+        RTPSReader* reader = mp_RTPSParticipant->find_local_reader(readerGUID);
+        if (reader != nullptr)
         {
             MatchingFailureMask no_match_reason;
             fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&temp_reader_proxy_data_, wdata, no_match_reason, incompatible_qos);
+            bool valid = valid_matching(rdata, wdata, no_match_reason, incompatible_qos);
             const GUID_t& writer_guid = wdata->guid();
 
             if (valid)
             {
 #if HAVE_SECURITY
                 if (!mp_RTPSParticipant->security_manager().discovered_writer(readerGUID, participant_guid,
-                        *wdata, (*rit)->getAttributes().security_attributes()))
+                        *wdata, reader->getAttributes().security_attributes()))
                 {
                     logError(RTPS_EDP, "Security manager returns an error for reader " << readerGUID);
                 }
 #else
-                if ((*rit)->matched_writer_add(*wdata))
+                if (reader->matched_writer_add(*wdata))
                 {
                     logInfo(RTPS_EDP_MATCH,
-                            "WP:" << wdata->guid() << " match R:" << (*rit)->getGuid() << ". WLoc:" <<
+                            "WP:" << wdata->guid() << " match R:" << reader->getGuid() << ". WLoc:" <<
                             wdata->remote_locators());
                     //MATCHED AND ADDED CORRECTLY:
-                    if ((*rit)->getListener() != nullptr)
+                    if (reader->getListener() != nullptr)
                     {
                         MatchingInfo info;
                         info.status = MATCHED_MATCHING;
                         info.remoteEndpointGuid = writer_guid;
-                        (*rit)->getListener()->onReaderMatched((*rit), info);
+                        reader->getListener()->onReaderMatched(reader, info);
 
 
                         const SubscriptionMatchedStatus& sub_info =
                                 update_subscription_matched_status(readerGUID, writer_guid, 1);
-                        (*rit)->getListener()->onReaderMatched((*rit), sub_info);
+                        reader->getListener()->onReaderMatched(reader, sub_info);
                     }
                 }
 #endif // if HAVE_SECURITY
             }
             else
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && (*rit)->getListener() != nullptr)
+                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && reader->getListener() != nullptr)
                 {
-                    (*rit)->getListener()->on_requested_incompatible_qos((*rit), incompatible_qos);
+                    reader->getListener()->on_requested_incompatible_qos(reader, incompatible_qos);
                 }
 
-                if ((*rit)->matched_writer_is_matched(writer_guid)
-                        && (*rit)->matched_writer_remove(writer_guid))
+                if (reader->matched_writer_is_matched(writer_guid)
+                        && reader->matched_writer_remove(writer_guid))
                 {
 #if HAVE_SECURITY
                     mp_RTPSParticipant->security_manager().remove_writer(readerGUID, participant_guid, writer_guid);
 #endif // if HAVE_SECURITY
                     //MATCHED AND ADDED CORRECTLY:
-                    if ((*rit)->getListener() != nullptr)
+                    if (reader->getListener() != nullptr)
                     {
                         MatchingInfo info;
                         info.status = REMOVED_MATCHING;
                         info.remoteEndpointGuid = writer_guid;
-                        (*rit)->getListener()->onReaderMatched((*rit), info);
+                        reader->getListener()->onReaderMatched(reader, info);
 
                         const SubscriptionMatchedStatus& sub_info =
                                 update_subscription_matched_status(readerGUID, writer_guid, -1);
-                        (*rit)->getListener()->onReaderMatched((*rit), sub_info);
+                        reader->getListener()->onReaderMatched(reader, sub_info);
                     }
                 }
             }
@@ -77,11 +77,13 @@ class DirectMessageSender : public RTPSMessageSenderInterface
         /**
          * Send a message through this interface.
          *
-         * @param message Pointer to the buffer with the message already serialized.
+         * @param buffers List of slices with the message already serialized.
+         * @param total_bytes Sum of the sizes of all the slices.
          * @param max_blocking_time_point Future timepoint where blocking send should end.
          */
         virtual bool send(
-                CDRMessage_t* message,
+                const NetworkBuffers& buffers,
+                uint32_t total_bytes,
                 std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
 private:
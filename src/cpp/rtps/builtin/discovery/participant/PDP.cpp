@@ -60,6 +60,7 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <algorithm>
 #include <mutex>
 #include <chrono>
 
@@ -89,6 +90,37 @@ const Duration_t pdp_heartbeat_response_delay{ 0, 11 * 1000000 }; // 11 millisec
 
 const int32_t pdp_initial_reserved_caches = 20;
 
+template<typename ProxyData>
+static void index_proxy(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data)
+{
+    index[data->topicName().to_string()].push_back(data);
+}
+
+template<typename ProxyData>
+static void unindex_proxy(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data)
+{
+    auto topic = index.find(data->topicName().to_string());
+    if (topic != index.end())
+    {
+        std::vector<ProxyData*>& proxies = topic->second;
+        auto it = std::find(proxies.begin(), proxies.end(), data);
+        if (it != proxies.end())
+        {
+            *it = proxies.back();
+            proxies.pop_back();
+        }
+
+        if (proxies.empty())
+        {
+            index.erase(topic);
+        }
+    }
+}
+
 
 PDP::PDP (
         BuiltinProtocols* built,
@@ -235,10 +267,62 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
     ret_val->should_check_lease_duration = with_lease_duration;
     ret_val->m_guid = participant_guid;
     participant_proxies_.push_back(ret_val);
+    ParticipantEntry& entry = participants_by_prefix_[participant_guid.guidPrefix];
+    entry = ParticipantEntry();
+    entry.proxy = ret_val;
 
     return ret_val;
 }
 
+ParticipantProxyData* PDP::find_participant_proxy(
+        const GuidPrefix_t& guid_prefix) const
+{
+    auto it = participants_by_prefix_.find(guid_prefix);
+    return it != participants_by_prefix_.end() ? it->second.proxy : nullptr;
+}
+
+uint64_t PDP::announcement_digest(
+        const SerializedPayload_t& payload)
+{
+    uint64_t digest = 14695981039346656037ull;
+    for (uint32_t i = 0; i < payload.length; ++i)
+    {
+        digest ^= payload.data[i];
+        digest *= 1099511628211ull;
+    }
+    return digest;
+}
+
+void PDP::set_participant_announcement(
+        const GuidPrefix_t& guid_prefix,
+        uint32_t length,
+        uint64_t digest)
+{
+    auto it = participants_by_prefix_.find(guid_prefix);
+    if (it != participants_by_prefix_.end())
+    {
+        it->second.announcement_length = length;
+        it->second.announcement_digest = digest;
+    }
+}
+
+bool PDP::refresh_unchanged_participant(
+        const GUID_t& guid,
+        uint32_t length,
+        uint64_t digest)
+{
+    auto it = participants_by_prefix_.find(guid.guidPrefix);
+    if (it == participants_by_prefix_.end() || it->second.proxy->m_guid != guid ||
+            it->second.announcement_length != length || it->second.announcement_digest != digest)
+    {
+        return false;
+    }
+
+    it->second.proxy->isAlive = true;
+    it->second.proxy->assert_liveliness();
+    return true;
+}
+
 void PDP::initializeParticipantProxyData(
         ParticipantProxyData* participant_data)
 {
@@ -525,13 +609,11 @@ bool PDP::has_reader_proxy_data(
         const GUID_t& reader)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
-        {
-            ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
-            return readers.find(reader.entityId) != readers.end();
-        }
+        ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
+        return readers.find(reader.entityId) != readers.end();
     }
     return false;
 }
@@ -541,16 +623,14 @@ bool PDP::lookupReaderProxyData(
         ReaderProxyData& rdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        auto rit = pit->m_readers->find(reader.entityId);
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader.entityId);
-            if (rit != pit->m_readers->end())
-            {
-                rdata.copy(rit->second);
-                return true;
-            }
+            rdata.copy(rit->second);
+            return true;
         }
     }
     return false;
@@ -560,13 +640,11 @@ bool PDP::has_writer_proxy_data(
         const GUID_t& writer)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
-        {
-            ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
-            return writers.find(writer.entityId) != writers.end();
-        }
+        ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
+        return writers.find(writer.entityId) != writers.end();
     }
     return false;
 }
@@ -576,52 +654,79 @@ bool PDP::lookupWriterProxyData(
         WriterProxyData& wdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        auto wit = pit->m_writers->find(writer.entityId);
+        if ( wit != pit->m_writers->end())
         {
-            auto wit = pit->m_writers->find(writer.entityId);
-            if ( wit != pit->m_writers->end())
-            {
-                wdata.copy(wit->second);
-                return true;
-            }
+            wdata.copy(wit->second);
+            return true;
         }
     }
     return false;
 }
 
+const std::vector<ReaderProxyData*>& PDP::readers_on_topic(
+        const string_255& topic_name) const
+{
+    static const std::vector<ReaderProxyData*> no_readers;
+    auto it = readers_by_topic_.find(topic_name.to_string());
+    return it == readers_by_topic_.end() ? no_readers : it->second;
+}
+
+const std::vector<WriterProxyData*>& PDP::writers_on_topic(
+        const string_255& topic_name) const
+{
+    static const std::vector<WriterProxyData*> no_writers;
+    auto it = writers_by_topic_.find(topic_name.to_string());
+    return it == writers_by_topic_.end() ? no_writers : it->second;
+}
+
+void PDP::remove_from_topic_index(
+        const ParticipantProxyData& pdata)
+{
+    for (auto pit : *pdata.m_readers)
+    {
+        unindex_proxy(readers_by_topic_, pit.second);
+    }
+
+    for (auto pit : *pdata.m_writers)
+    {
+        unindex_proxy(writers_by_topic_, pit.second);
+    }
+}
+
 bool PDP::removeReaderProxyData(
         const GUID_t& reader_guid)
 {
     logInfo(RTPS_PDP, "Removing reader proxy data " << reader_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
+        auto rit = pit->m_readers->find(reader_guid.entityId);
+
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader_guid.entityId);
+            ReaderProxyData* pR = rit->second;
+            unindex_proxy(readers_by_topic_, pR);
+            mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
-            if (rit != pit->m_readers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                ReaderProxyData* pR = rit->second;
-                mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(std::move(*pR));
-                    info.status = ReaderDiscoveryInfo::REMOVED_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
-
-                // Clear reader proxy data and move to pool in order to allow reuse
-                pR->clear();
-                pit->m_readers->erase(rit);
-                reader_proxies_pool_.push_back(pR);
-                return true;
+                ReaderDiscoveryInfo info(std::move(*pR));
+                info.status = ReaderDiscoveryInfo::REMOVED_READER;
+                listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
             }
+
+            // Clear reader proxy data and move to pool in order to allow reuse
+            pR->clear();
+            pit->m_readers->erase(rit);
+            reader_proxies_pool_.push_back(pR);
+            return true;
         }
     }
 
@@ -634,32 +739,31 @@ bool PDP::removeWriterProxyData(
     logInfo(RTPS_PDP, "Removing writer proxy data " << writer_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
+        auto wit = pit->m_writers->find(writer_guid.entityId);
+
+        if (wit != pit->m_writers->end())
         {
-            auto wit = pit->m_writers->find(writer_guid.entityId);
+            WriterProxyData* pW = wit->second;
+            unindex_proxy(writers_by_topic_, pW);
+            mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
 
-            if (wit != pit->m_writers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                WriterProxyData* pW = wit->second;
-                mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(std::move(*pW));
-                    info.status = WriterDiscoveryInfo::REMOVED_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+                WriterDiscoveryInfo info(std::move(*pW));
+                info.status = WriterDiscoveryInfo::REMOVED_WRITER;
+                listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            }
 
-                // Clear writer proxy data and move to pool in order to allow reuse
-                pW->clear();
-                pit->m_writers->erase(wit);
-                writer_proxies_pool_.push_back(pW);
+            // Clear writer proxy data and move to pool in order to allow reuse
+            pW->clear();
+            pit->m_writers->erase(wit);
+            writer_proxies_pool_.push_back(pW);
 
-                return true;
-            }
+            return true;
         }
     }
 
@@ -671,13 +775,11 @@ bool PDP::lookup_participant_name(
         string_255& name)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == guid)
     {
-        if (pit->m_guid == guid)
-        {
-            name = pit->m_participantName;
-            return true;
-        }
+        name = pit->m_participantName;
+        return true;
     }
     return false;
 }
@@ -687,13 +789,11 @@ bool PDP::lookup_participant_key(
         InstanceHandle_t& key)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(participant_guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == participant_guid)
     {
-        if (pit->m_guid == participant_guid)
-        {
-            key = pit->m_key;
-            return true;
-        }
+        key = pit->m_key;
+        return true;
     }
     return false;
 }
@@ -708,68 +808,24 @@ ReaderProxyData* PDP::addReaderProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
-
-            // Check that it is not already there:
-            auto rpi = pit->m_readers->find(reader_guid.entityId);
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-            if ( rpi != pit->m_readers->end())
-            {
-                ret_val = rpi->second;
-
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(*ret_val);
-                    info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
+        // Check that it is not already there:
+        auto rpi = pit->m_readers->find(reader_guid.entityId);
 
-            // Try to take one entry from the pool
-            if (reader_proxies_pool_.empty())
-            {
-                size_t max_proxies = reader_proxies_pool_.max_size();
-                if (reader_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++reader_proxies_number_;
-                    ret_val = new ReaderProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = reader_proxies_pool_.back();
-                reader_proxies_pool_.pop_back();
-            }
-
-            // Add to ParticipantProxyData
-            (*pit->m_readers)[reader_guid.entityId] = ret_val;
+        if ( rpi != pit->m_readers->end())
+        {
+            ret_val = rpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            // The proxy is indexed again in case the update changes its topic
+            unindex_proxy(readers_by_topic_, ret_val);
+            bool updated = initializer_func(ret_val, true, *pit);
+            index_proxy(readers_by_topic_, ret_val);
+            if (!updated)
             {
                 return nullptr;
             }
@@ -778,13 +834,61 @@ ReaderProxyData* PDP::addReaderProxyData(
             if (listener)
             {
                 ReaderDiscoveryInfo info(*ret_val);
-                info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+                info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
                 listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (reader_proxies_pool_.empty())
+        {
+            size_t max_proxies = reader_proxies_pool_.max_size();
+            if (reader_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++reader_proxies_number_;
+                ret_val = new ReaderProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = reader_proxies_pool_.back();
+            reader_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        (*pit->m_readers)[reader_guid.entityId] = ret_val;
+
+        bool initialized = initializer_func(ret_val, false, *pit);
+        index_proxy(readers_by_topic_, ret_val);
+        if (!initialized)
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            ReaderDiscoveryInfo info(*ret_val);
+            info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+            listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -800,68 +904,24 @@ WriterProxyData* PDP::addWriterProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-            // Check that it is not already there:
-            auto wpi = pit->m_writers->find(writer_guid.entityId);
-
-            if (wpi != pit->m_writers->end())
-            {
-                ret_val = wpi->second;
+        // Check that it is not already there:
+        auto wpi = pit->m_writers->find(writer_guid.entityId);
 
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(*ret_val);
-                    info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
-
-            // Try to take one entry from the pool
-            if (writer_proxies_pool_.empty())
-            {
-                size_t max_proxies = writer_proxies_pool_.max_size();
-                if (writer_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++writer_proxies_number_;
-                    ret_val = new WriterProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = writer_proxies_pool_.back();
-                writer_proxies_pool_.pop_back();
-            }
-
-            // Add to ParticipantProxyData
-            (*pit->m_writers)[writer_guid.entityId] = ret_val;
+        if (wpi != pit->m_writers->end())
+        {
+            ret_val = wpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            // The proxy is indexed again in case the update changes its topic
+            unindex_proxy(writers_by_topic_, ret_val);
+            bool updated = initializer_func(ret_val, true, *pit);
+            index_proxy(writers_by_topic_, ret_val);
+            if (!updated)
             {
                 return nullptr;
             }
@@ -870,13 +930,61 @@ WriterProxyData* PDP::addWriterProxyData(
             if (listener)
             {
                 WriterDiscoveryInfo info(*ret_val);
-                info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+                info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
                 listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (writer_proxies_pool_.empty())
+        {
+            size_t max_proxies = writer_proxies_pool_.max_size();
+            if (writer_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++writer_proxies_number_;
+                ret_val = new WriterProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = writer_proxies_pool_.back();
+            writer_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        (*pit->m_writers)[writer_guid.entityId] = ret_val;
+
+        bool initialized = initializer_func(ret_val, false, *pit);
+        index_proxy(writers_by_topic_, ret_val);
+        if (!initialized)
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            WriterDiscoveryInfo info(*ret_val);
+            info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+            listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -904,6 +1012,8 @@ bool PDP::remove_remote_participant(
         {
             pdata = *pit;
             participant_proxies_.erase(pit);
+            participants_by_prefix_.erase(partGUID.guidPrefix);
+            remove_from_topic_index(*pdata);
             break;
         }
     }
@@ -968,7 +1078,7 @@ bool PDP::remove_remote_participant(
 #endif // if HAVE_SECURITY
 
         this->mp_PDPReaderHistory->getMutex()->lock();
-        for (std::vector<CacheChange_t*>::iterator it = this->mp_PDPReaderHistory->changesBegin();
+        for (ReaderHistory::iterator it = this->mp_PDPReaderHistory->changesBegin();
                 it != this->mp_PDPReaderHistory->changesEnd(); ++it)
         {
             if ((*it)->instanceHandle == pdata->m_key)
@@ -1031,15 +1141,12 @@ void PDP::assert_remote_participant_liveliness(
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* it : this->participant_proxies_)
+    ParticipantProxyData* it = find_participant_proxy(remote_guid);
+    if (it != nullptr)
     {
-        if (it->m_guid.guidPrefix == remote_guid)
-        {
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            it->isAlive = true;
-            it->assert_liveliness();
-            break;
-        }
+        // TODO Ricardo: Study if isAlive attribute is necessary.
+        it->isAlive = true;
+        it->assert_liveliness();
     }
 }
 
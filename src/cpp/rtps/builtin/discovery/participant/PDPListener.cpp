@@ -95,6 +95,17 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Periodic announcements of a known participant are usually equal to the last one processed. In that case
+        // the payload is not parsed again, and only the lease of the participant is refreshed.
+        uint32_t announcement_length = change->serializedPayload.length;
+        uint64_t announcement_digest = PDP::announcement_digest(change->serializedPayload);
+        if (parent_pdp_->refresh_unchanged_participant(guid, announcement_length, announcement_digest))
+        {
+            lock.unlock();
+            parent_pdp_->mp_PDPReaderHistory->remove_change(change);
+            return;
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -108,14 +119,10 @@ void PDPListener::onNewCacheChangeAdded(
             guid = temp_participant_data_.m_guid;
 
             // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            ParticipantProxyData* pdata = parent_pdp_->find_participant_proxy(guid.guidPrefix);
+            if (pdata != nullptr && guid != pdata->m_guid)
             {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
+                pdata = nullptr;
             }
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
@@ -127,6 +134,8 @@ void PDPListener::onNewCacheChangeAdded(
                 pdata = parent_pdp_->createParticipantProxyData(temp_participant_data_, writer_guid);
                 if (pdata != nullptr)
                 {
+                    parent_pdp_->set_participant_announcement(guid.guidPrefix, announcement_length,
+                            announcement_digest);
                     reader->getMutex().unlock();
                     lock.unlock();
 
@@ -152,6 +161,7 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 pdata->updateData(temp_participant_data_);
                 pdata->isAlive = true;
+                parent_pdp_->set_participant_announcement(guid.guidPrefix, announcement_length, announcement_digest);
                 reader->getMutex().unlock();
 
                 logInfo(RTPS_PDP_DISCOVERY, "Update participant "
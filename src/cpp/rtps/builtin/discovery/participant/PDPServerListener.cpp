@@ -271,14 +271,10 @@ void PDPServerListener::onNewCacheChangeAdded(
             std::unique_lock<std::recursive_mutex> lock(*pdp_server()->getMutex());
 
             // Check if participant proxy already exists (means the DATA(p) brings updated info)
-            ParticipantProxyData* pdata = nullptr;
-            for (ParticipantProxyData* it : pdp_server()->participant_proxies_)
+            ParticipantProxyData* pdata = pdp_server()->find_participant_proxy(guid.guidPrefix);
+            if (pdata != nullptr && guid != pdata->m_guid)
             {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
+                pdata = nullptr;
             }
 
             // Store whether the participant is new or updated
@@ -968,6 +968,19 @@ bool WLP::assert_liveliness(
         lease_duration);
 }
 
+bool WLP::assert_liveliness(
+        GUID_t writer,
+        LivelinessQosPolicyKind kind,
+        Duration_t lease_duration,
+        std::shared_ptr<LivelinessAssertion>& assertion)
+{
+    return pub_liveliness_manager_->assert_liveliness(
+        writer,
+        kind,
+        lease_duration,
+        assertion);
+}
+
 bool WLP::assert_liveliness_manual_by_participant()
 {
     if (manual_by_participant_writers_.size() > 0)
@@ -31,6 +31,7 @@ namespace rtps{
 
 class ReaderLocator;
 class ReaderProxy;
+class RTPSWriter;
 
 /**
  * Flow Controllers take a vector of cache changes (by reference) and return a filtered
@@ -50,6 +51,12 @@ class FlowController
 
         virtual void disable() = 0;
 
+        //! Called when a writer limited by this controller is created.
+        virtual void register_writer(RTPSWriter*) {}
+
+        //! Called when a writer limited by this controller is being destroyed.
+        virtual void unregister_writer(RTPSWriter*) {}
+
         virtual ~FlowController();
         FlowController();
 
@@ -17,37 +17,80 @@
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
 #include <asio.hpp>
 #include <asio/steady_timer.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <vector>
 
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+static bool get_int_property(
+        const PropertyPolicy& properties,
+        const char* name,
+        long& value)
+{
+    const std::string* str = PropertyPolicyHelper::find_property(properties, name);
+    if (nullptr == str || str->empty())
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    value = std::strtol(str->c_str(), &end, 10);
+    return *end == '\0';
+}
+
 ThroughputController::ThroughputController(
         const ThroughputControllerDescriptor& descriptor,
         RTPSWriter* associatedWriter)
-    : mBytesPerPeriod(descriptor.bytesPerPeriod)
+    : mKind(descriptor.kind)
+    , mBytesPerPeriod(descriptor.bytesPerPeriod)
     , mAccumulatedPayloadSize(0)
     , mPeriodMillisecs(descriptor.periodMillisecs)
     , mAssociatedParticipant(nullptr)
     , mAssociatedWriter(associatedWriter)
+    , mBurstBytes(descriptor.burstBytes != 0 ? descriptor.burstBytes : descriptor.bytesPerPeriod)
+    , mTokens(mBurstBytes)
+    , mTokensPerMicrosecond(static_cast<double>(descriptor.bytesPerPeriod) / (descriptor.periodMillisecs * 1000.0))
+    , mLastRefill(clock::now())
+    , mRound(0)
+    , mRefreshTimer(*FlowController::ControllerService)
+    , mRefreshScheduled(false)
 {
 }
 
 ThroughputController::ThroughputController(
         const ThroughputControllerDescriptor& descriptor,
         RTPSParticipantImpl* associatedParticipant)
-    : mBytesPerPeriod(descriptor.bytesPerPeriod)
+    : mKind(descriptor.kind)
+    , mBytesPerPeriod(descriptor.bytesPerPeriod)
     , mAccumulatedPayloadSize(0)
     , mPeriodMillisecs(descriptor.periodMillisecs)
     , mAssociatedParticipant(associatedParticipant)
     , mAssociatedWriter(nullptr)
+    , mBurstBytes(descriptor.burstBytes != 0 ? descriptor.burstBytes : descriptor.bytesPerPeriod)
+    , mTokens(mBurstBytes)
+    , mTokensPerMicrosecond(static_cast<double>(descriptor.bytesPerPeriod) / (descriptor.periodMillisecs * 1000.0))
+    , mLastRefill(clock::now())
+    , mRound(0)
+    , mRefreshTimer(*FlowController::ControllerService)
+    , mRefreshScheduled(false)
 {
 }
 
+ThroughputController::~ThroughputController()
+{
+    // The timer callback runs with the listening mutex taken, so it cannot be running after this.
+    std::unique_lock<std::recursive_mutex> listening_lock(FlowControllerMutex);
+    mRefreshTimer.cancel();
+}
+
 void ThroughputController::operator ()(
         RTPSWriterCollector<ReaderLocator*>& changesToSend)
 {
@@ -69,46 +112,185 @@ void ThroughputController::disable()
     mAssociatedParticipant = nullptr;
 }
 
+void ThroughputController::register_writer(
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    WriterState& writer_state = writer_state_nts(writer->getGuid());
+    writer_state.writer = writer;
+
+    const PropertyPolicy& properties = writer->getAttributes().properties;
+    long value = 0;
+    if (get_int_property(properties, AsyncWriterThread::priority_property_name(), value))
+    {
+        writer_state.priority = static_cast<int32_t>(value);
+    }
+    if (get_int_property(properties, weight_property_name(), value) && value > 0)
+    {
+        writer_state.weight = static_cast<uint32_t>(value);
+    }
+}
+
+void ThroughputController::unregister_writer(
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    mWriters.erase(writer->getGuid());
+}
+
+ThroughputController::WriterState& ThroughputController::writer_state_nts(
+        const GUID_t& writer_guid)
+{
+    WriterState& writer_state = mWriters[writer_guid];
+    if (writer_state.round != mRound)
+    {
+        writer_state.round = mRound;
+        writer_state.cleared = 0;
+    }
+    return writer_state;
+}
+
+bool ThroughputController::blocked_by_priority_nts(
+        const WriterState& writer_state) const
+{
+    if (PRIORITY_THROUGHPUT_CONTROLLER != mKind)
+    {
+        return false;
+    }
+
+    for (const auto& entry : mWriters)
+    {
+        if (&entry.second != &writer_state && is_waiting_nts(entry.second) &&
+                entry.second.priority > writer_state.priority)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t ThroughputController::fair_share_nts(
+        const WriterState& writer_state) const
+{
+    if (FAIR_SHARE_THROUGHPUT_CONTROLLER != mKind)
+    {
+        return UINT32_MAX;
+    }
+
+    // Bandwidth is shared among the writer and those waiting for the controller.
+    uint64_t total_weight = writer_state.weight;
+    for (const auto& entry : mWriters)
+    {
+        if (&entry.second != &writer_state && is_waiting_nts(entry.second))
+        {
+            total_weight += entry.second.weight;
+        }
+    }
+
+    return static_cast<uint32_t>(mBurstBytes * writer_state.weight / total_weight);
+}
+
+void ThroughputController::refill_nts(
+        const clock::time_point& now)
+{
+    if (FIXED_WINDOW_THROUGHPUT_CONTROLLER == mKind)
+    {
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - mLastRefill);
+    mTokens = (std::min)(mBurstBytes, mTokens + mTokensPerMicrosecond * elapsed.count());
+    mLastRefill = now;
+}
+
 template<typename Collector>
 void ThroughputController::process_nts(Collector& changesToSend)
 {
+    if (changesToSend.items().empty())
+    {
+        return;
+    }
+
+    clock::time_point now = clock::now();
+    refill_nts(now);
+
+    WriterState& writer_state = writer_state_nts(changesToSend.items().begin()->cacheChange->writerGUID);
+    uint32_t share = fair_share_nts(writer_state);
     uint32_t size_to_restore = 0;
+    uint32_t dataLength = 0;
     auto it = changesToSend.items().begin();
-    while (
-        it != changesToSend.items().end() &&
-        process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber, &size_to_restore))
+    if (!blocked_by_priority_nts(writer_state))
     {
-        ++it;
+        while (it != changesToSend.items().end())
+        {
+            CacheChange_t* change = it->cacheChange;
+            assert(change != nullptr);
+
+            dataLength = change->serializedPayload.length;
+            if (it->fragmentNumber != 0)
+            {
+                dataLength = (it->fragmentNumber + 1) != change->getFragmentCount() ?
+                        change->getFragmentSize() :
+                        change->serializedPayload.length - (it->fragmentNumber * change->getFragmentSize());
+            }
+
+            if (!process_change_nts_(writer_state, dataLength, share, &size_to_restore))
+            {
+                break;
+            }
+            ++it;
+        }
     }
 
+    writer_state.limited = it != changesToSend.items().end();
     changesToSend.items().erase(it, changesToSend.items().end());
 
     if (size_to_restore > 0)
     {
         ScheduleRefresh(size_to_restore);
     }
+
+    if (writer_state.limited && FIXED_WINDOW_THROUGHPUT_CONTROLLER != mKind)
+    {
+        // Wake the writer up when the bucket has enough tokens for the change that was held back, or after the
+        // time needed to generate them when it was limited by its share or by a writer with a higher priority.
+        double missing_tokens = (std::max)(static_cast<double>(dataLength), 1.0);
+        if (mTokens < missing_tokens && mTokens < mBurstBytes)
+        {
+            missing_tokens = (std::min)(missing_tokens, mBurstBytes) - mTokens;
+        }
+        auto wait = std::chrono::microseconds(static_cast<int64_t>(missing_tokens / mTokensPerMicrosecond) + 1);
+        schedule_nts(now + wait);
+    }
 }
 
 bool ThroughputController::process_change_nts_(
-        CacheChange_t* change,
-        const SequenceNumber_t& /*seqNum*/,
-        const FragmentNumber_t fragNum,
+        WriterState& writer_state,
+        uint32_t dataLength,
+        uint32_t share,
         uint32_t* accumulated_size)
 {
-    assert(change != nullptr);
-
-    uint32_t dataLength = change->serializedPayload.length;
-
-    if (fragNum != 0)
+    if (FIXED_WINDOW_THROUGHPUT_CONTROLLER == mKind)
     {
-        dataLength = (fragNum + 1) != change->getFragmentCount() ?
-                change->getFragmentSize() : change->serializedPayload.length - (fragNum * change->getFragmentSize());
+        if ((mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
+        {
+            mAccumulatedPayloadSize += dataLength;
+            *accumulated_size += dataLength;
+            return true;
+        }
+
+        return false;
     }
 
-    if ((mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
+    // A change larger than the bucket is allowed when the bucket is full, so it is not held back forever.
+    bool enough_tokens = mTokens >= dataLength || mTokens >= mBurstBytes;
+    // The first change of each refresh is always allowed for fair share, so every writer progresses.
+    bool within_share = 0 == writer_state.cleared || (writer_state.cleared + dataLength) <= share;
+    if (enough_tokens && within_share)
     {
-        mAccumulatedPayloadSize += dataLength;
-        *accumulated_size += dataLength;
+        mTokens -= dataLength;
+        writer_state.cleared += dataLength;
         return true;
     }
 
@@ -118,37 +300,90 @@ bool ThroughputController::process_change_nts_(
 void ThroughputController::ScheduleRefresh(
         uint32_t sizeToRestore)
 {
-    std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(
-                *FlowController::ControllerService));
-    auto refresh = [throwawayTimer, this, sizeToRestore]
-                (const asio::error_code& error)
+    clock::time_point refresh_time = clock::now() + std::chrono::milliseconds(mPeriodMillisecs);
+    mPendingRestores.emplace_back(refresh_time, sizeToRestore);
+    schedule_nts(refresh_time);
+}
+
+void ThroughputController::schedule_nts(
+        const clock::time_point& refresh_time)
+{
+    if (mRefreshScheduled && mRefreshTime <= refresh_time)
+    {
+        return;
+    }
+
+    mRefreshScheduled = true;
+    mRefreshTime = refresh_time;
+    mRefreshTimer.expires_at(refresh_time);
+    mRefreshTimer.async_wait([this](const asio::error_code& error)
+            {
+                on_refresh(error);
+            });
+}
+
+void ThroughputController::on_refresh(
+        const asio::error_code& error)
+{
+    if (error == asio::error::operation_aborted)
+    {
+        return;
+    }
+
+    std::unique_lock<std::recursive_mutex> listening_lock(FlowControllerMutex);
+    if (!FlowController::IsListening(this))
+    {
+        return;
+    }
+
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    clock::time_point now = clock::now();
+    if (mRefreshScheduled && now < mRefreshTime)
+    {
+        // Callback of a previous expiration time.
+        return;
+    }
+    mRefreshScheduled = false;
+
+    while (!mPendingRestores.empty() && mPendingRestores.front().first <= now)
+    {
+        uint32_t sizeToRestore = mPendingRestores.front().second;
+        mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ?
+                0 : mAccumulatedPayloadSize - sizeToRestore;
+        mPendingRestores.pop_front();
+    }
+    if (!mPendingRestores.empty())
+    {
+        schedule_nts(mPendingRestores.front().first);
+    }
+
+    ++mRound;
+
+    if (mAssociatedWriter)
+    {
+        mAssociatedWriter->getRTPSParticipant()->async_thread().wake_up(mAssociatedWriter);
+    }
+    else if (mAssociatedParticipant)
+    {
+        // Limited writers are woken up by decreasing priority, so they get the chance to send in that order.
+        std::vector<WriterState*> limited_writers;
+        for (auto& entry : mWriters)
+        {
+            if (entry.second.writer && is_waiting_nts(entry.second))
             {
-                if ((error != asio::error::operation_aborted) &&
-                        FlowController::IsListening(this))
+                limited_writers.push_back(&entry.second);
+            }
+        }
+        std::stable_sort(limited_writers.begin(), limited_writers.end(),
+                [](const WriterState* a, const WriterState* b)
                 {
-                    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
-                    throwawayTimer->cancel();
-                    mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ?
-                        0 : mAccumulatedPayloadSize - sizeToRestore;
-
-                    if (mAssociatedWriter)
-                    {
-                        mAssociatedWriter->getRTPSParticipant()->async_thread().wake_up(mAssociatedWriter);
-                    }
-                    else if (mAssociatedParticipant)
-                    {
-                        std::unique_lock<std::recursive_mutex> lock(*mAssociatedParticipant->getParticipantMutex());
-                        for (auto it = mAssociatedParticipant->userWritersListBegin();
-                                it != mAssociatedParticipant->userWritersListEnd(); ++it)
-                        {
-                            mAssociatedParticipant->async_thread().wake_up(*it);
-                        }
-                    }
-                }
-            };
-
-    throwawayTimer->expires_from_now(std::chrono::milliseconds(mPeriodMillisecs));
-    throwawayTimer->async_wait(refresh);
+                    return a->priority > b->priority;
+                });
+        for (WriterState* writer_state : limited_writers)
+        {
+            mAssociatedParticipant->async_thread().wake_up(writer_state->writer);
+        }
+    }
 }
 
 } // namespace rtps
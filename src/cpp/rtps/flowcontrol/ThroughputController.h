@@ -17,7 +17,13 @@
 
 #include <rtps/flowcontrol/FlowController.h>
 #include <fastdds/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+#include <fastdds/rtps/common/Guid.h>
 
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
+#include <deque>
+#include <map>
 #include <thread>
 
 namespace eprosima {
@@ -28,10 +34,18 @@ class RTPSWriter;
 class RTPSParticipantImpl;
 
 /**
- * Simple filter that only clears changes up to a certain accumulated payload size.
+ * Filter that limits the bandwidth used by the writers it controls.
+ * Depending on the kind of its descriptor it behaves as:
+ * - A fixed window, that only clears changes up to a certain accumulated payload size.
  * It refreshes after a given time in MS, in a staggered way (e.g. if it clears
  * 500kb at t=0 and 800 kb at t=10, it will refresh 500kb at t = 0 + period, and
  * then fully refresh at t = 10 + period).
+ * - A token bucket, that is continuously refilled and allows bursts up to its capacity.
+ * - A token bucket where writers with a lower priority are held while a writer with a higher priority is waiting.
+ * - A token bucket where each writer only gets a share of the capacity proportional to its weight on each refill,
+ * so the fragments of different writers are interleaved.
+ *
+ * A single timer is used to refresh the controller and wake up the writers that were limited by it.
  */
 class ThroughputController : public FlowController
 {
@@ -44,6 +58,14 @@ public:
             const ThroughputControllerDescriptor&,
             RTPSParticipantImpl* associatedParticipant);
 
+    virtual ~ThroughputController();
+
+    //! Name of the writer property with the weight of the writer on fair share controllers.
+    static const char* weight_property_name()
+    {
+        return "fastdds.flow_controller_weight";
+    }
+
     virtual void operator ()(
             RTPSWriterCollector<ReaderLocator*>& changesToSend) override;
     virtual void operator ()(
@@ -51,17 +73,74 @@ public:
 
     virtual void disable() override;
 
+    virtual void register_writer(
+            RTPSWriter* writer) override;
+
+    virtual void unregister_writer(
+            RTPSWriter* writer) override;
+
 private:
 
+    using clock = std::chrono::steady_clock;
+
+    //! Information kept for each writer limited by the controller.
+    struct WriterState
+    {
+        //! Writer to be woken up when the controller is refreshed. Unknown for writers not registered.
+        RTPSWriter* writer = nullptr;
+        //! Higher priorities are served first on priority controllers.
+        int32_t priority = 0;
+        //! Relative share of the bandwidth on fair share controllers.
+        uint32_t weight = 1;
+        //! Whether some change of the writer was held back the last time it was processed.
+        bool limited = false;
+        //! Refresh during which the writer was last processed.
+        uint64_t round = 0;
+        //! Bytes cleared for the writer during 'round'.
+        uint32_t cleared = 0;
+    };
+
     template<typename Collector>
     void process_nts(Collector& changesToSend);
 
     bool process_change_nts_(
-            CacheChange_t* change,
-            const SequenceNumber_t& seqNum,
-            const FragmentNumber_t fragNum,
+            WriterState& writer_state,
+            uint32_t dataLength,
+            uint32_t share,
             uint32_t* accumulated_size);
 
+    WriterState& writer_state_nts(
+            const GUID_t& writer_guid);
+
+    //! Whether a writer is still waiting for this controller. Writers limited before the last refresh that did not
+    //! try again are considered to have nothing left to send.
+    bool is_waiting_nts(
+            const WriterState& writer_state) const
+    {
+        return writer_state.limited && writer_state.round + 1 >= mRound;
+    }
+
+    //! Whether a writer with a higher priority than the given one is waiting for this controller.
+    bool blocked_by_priority_nts(
+            const WriterState& writer_state) const;
+
+    //! Bytes that a writer can send until the next refresh on fair share controllers.
+    uint32_t fair_share_nts(
+            const WriterState& writer_state) const;
+
+    //! Adds the tokens generated since the last time this was called.
+    void refill_nts(
+            const clock::time_point& now);
+
+    //! Arms the timer so the controller is refreshed no later than the given time.
+    void schedule_nts(
+            const clock::time_point& refresh_time);
+
+    //! Timer callback. Restores the capacity of the controller and wakes up the limited writers.
+    void on_refresh(
+            const asio::error_code& error);
+
+    ThroughputControllerKind mKind;
     uint32_t mBytesPerPeriod;
     uint32_t mAccumulatedPayloadSize;
     uint32_t mPeriodMillisecs;
@@ -70,6 +149,26 @@ private:
     RTPSParticipantImpl* mAssociatedParticipant;
     RTPSWriter* mAssociatedWriter;
 
+    //! Capacity of the token bucket.
+    double mBurstBytes;
+    //! Tokens on the bucket. Can be negative when a change larger than the bucket was cleared.
+    double mTokens;
+    //! Tokens generated per microsecond.
+    double mTokensPerMicrosecond;
+    clock::time_point mLastRefill;
+
+    //! Refreshes done, used to reset the bytes cleared for each writer on fair share controllers.
+    uint64_t mRound;
+
+    std::map<GUID_t, WriterState> mWriters;
+
+    //! Amounts of payload to be restored on fixed window controllers, in the order they are due.
+    std::deque<std::pair<clock::time_point, uint32_t>> mPendingRestores;
+
+    asio::steady_timer mRefreshTimer;
+    bool mRefreshScheduled;
+    clock::time_point mRefreshTime;
+
     /*
      * Schedules the filter to be refreshed in period ms. When it does, its capacity
      * will be partially restored, by "sizeToRestore" bytes.
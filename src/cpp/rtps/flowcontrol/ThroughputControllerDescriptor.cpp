@@ -18,11 +18,25 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(): bytesPerPeriod(UINT32_MAX), periodMillisecs(0)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(): bytesPerPeriod(UINT32_MAX), periodMillisecs(0),
+    kind(FIXED_WINDOW_THROUGHPUT_CONTROLLER), burstBytes(0)
 {
 }
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time): bytesPerPeriod(size), periodMillisecs(time)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time): bytesPerPeriod(size), periodMillisecs(time),
+    kind(FIXED_WINDOW_THROUGHPUT_CONTROLLER), burstBytes(0)
+{
+}
+
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(
+        uint32_t size,
+        uint32_t time,
+        ThroughputControllerKind controller_kind,
+        uint32_t burst)
+    : bytesPerPeriod(size)
+    , periodMillisecs(time)
+    , kind(controller_kind)
+    , burstBytes(burst)
 {
 }
 
@@ -102,7 +102,7 @@ void CacheChangePool::return_cache_to_pool(
     ch->sourceTimestamp.seconds(0);
     ch->sourceTimestamp.fraction(0);
     ch->setFragmentSize(0);
-    free_caches_.push_back(ch);
+    free_caches_.push(ch);
 }
 
 bool CacheChangePool::allocateGroup(
@@ -128,13 +128,13 @@ bool CacheChangePool::allocateGroup(
     }
 
     all_caches_.reserve(desired_size);
-    free_caches_.reserve(free_caches_.size() + group_size);
+    free_caches_.reserve(desired_size);
 
     while (current_pool_size_ < desired_size)
     {
         CacheChange_t* ch = new CacheChange_t();
         all_caches_.push_back(ch);
-        free_caches_.push_back(ch);
+        free_caches_.push(ch);
         ++current_pool_size_;
     }
 
@@ -167,6 +167,12 @@ CacheChange_t* CacheChangePool::allocateSingle()
         ch = new CacheChange_t();
         all_caches_.push_back(ch);
         added = true;
+
+        // Released caches are kept on DYNAMIC_REUSABLE_MEMORY_MODE
+        if (memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE)
+        {
+            free_caches_.reserve(all_caches_.size());
+        }
     }
 
     if (!added)
@@ -183,31 +189,33 @@ bool CacheChangePool::reserve_cache(
 {
     cache_change = nullptr;
 
-    if (free_caches_.empty())
+    if (free_caches_.pop(cache_change))
     {
-        switch (memory_mode_)
-        {
-            case PREALLOCATED_MEMORY_MODE:
-            case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-                if (!allocateGroup((uint16_t)(ceil((float)current_pool_size_ / 10) + 10)))
-                {
-                    return false;
-                }
-                break;
-
-            case DYNAMIC_RESERVE_MEMORY_MODE:
-            case DYNAMIC_REUSABLE_MEMORY_MODE:
-                cache_change = allocateSingle(); //Allocates a single, empty CacheChange
-                return cache_change != nullptr;
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
 
-            default:
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    switch (memory_mode_)
+    {
+        case PREALLOCATED_MEMORY_MODE:
+        case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+            if (!allocateGroup((uint16_t)(ceil((float)current_pool_size_ / 10) + 10)))
+            {
                 return false;
-        }
+            }
+            break;
+
+        case DYNAMIC_RESERVE_MEMORY_MODE:
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            cache_change = allocateSingle(); //Allocates a single, empty CacheChange
+            return cache_change != nullptr;
+
+        default:
+            return false;
     }
 
-    cache_change = free_caches_.back();
-    free_caches_.pop_back();
-    return true;
+    return free_caches_.pop(cache_change);
 }
 
 bool CacheChangePool::release_cache(
@@ -24,7 +24,10 @@
 #include <fastdds/rtps/resources/ResourceManagement.h>
 
 #include <rtps/history/PoolConfig.h>
+#include <rtps/history/PoolCounters.h>
+#include <utils/collections/lock_free_stack.hpp>
 
+#include <atomic>
 #include <vector>
 #include <algorithm>
 #include <cstdint>
@@ -37,6 +40,8 @@ namespace rtps {
 /**
  * Class CacheChangePool, used by the HistoryCache to pre-reserve a number of CacheChange_t to avoid dynamically
  * reserving memory in the middle of execution loops.
+ * Free caches are kept on a lock-free stack, so they can be reserved and released concurrently. Allocating new
+ * caches, and releasing them on DYNAMIC_RESERVE_MEMORY_MODE, should be serialized by the owner of the pool.
  * @ingroup COMMON_MODULE
  */
 class CacheChangePool : public IChangePool
@@ -84,15 +89,29 @@ public:
         return free_caches_.size();
     }
 
+    //!Get the usage statistics of the pool.
+    PoolCounters get_counters() const
+    {
+        PoolCounters counters;
+        counters.hits = hits_.load(std::memory_order_relaxed);
+        counters.misses = misses_.load(std::memory_order_relaxed);
+        counters.contentions = free_caches_.contentions();
+        return counters;
+    }
+
 private:
 
     uint32_t current_pool_size_ = 0;
     uint32_t max_pool_size_ = 0;
     MemoryManagementPolicy_t memory_mode_ = MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE;
 
-    std::vector<CacheChange_t*> free_caches_;
+    //! Free caches. It has capacity for all the caches in all_caches_.
+    LockFreeStack<CacheChange_t*> free_caches_;
     std::vector<CacheChange_t*> all_caches_;
 
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+
     bool allocateGroup(
             uint32_t num_caches);
 
@@ -36,8 +36,6 @@ History::History(
         const HistoryAttributes& att)
     : m_att(att)
 {
-    uint32_t initial_size = static_cast<uint32_t>(att.initialReservedCaches < 0 ? 0 : att.initialReservedCaches);
-    m_changes.reserve(static_cast<size_t>(initial_size));
 }
 
 History::~History()
@@ -238,7 +236,7 @@ namespace rtps {
 void History::print_changes_seqNum2()
 {
     std::stringstream ss;
-    for (std::vector<CacheChange_t*>::iterator it = m_changes.begin();
+    for (iterator it = m_changes.begin();
             it != m_changes.end(); ++it)
     {
         ss << (*it)->sequenceNumber << "-";
@@ -21,6 +21,7 @@
 
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <rtps/history/PoolConfig.h>
+#include <rtps/history/PoolCounters.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -86,6 +87,15 @@ public:
      */
     virtual size_t payload_pool_available_size() const = 0;
 
+    /**
+     * @brief Get the usage statistics of the pool.
+     * Pools that do not keep them return all counters as zero.
+     */
+    virtual PoolCounters payload_pool_counters() const
+    {
+        return PoolCounters();
+    }
+
 };
 
 }  // namespace rtps
@@ -0,0 +1,45 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PoolCounters.h
+ */
+
+#ifndef RTPS_HISTORY_POOLCOUNTERS_H_
+#define RTPS_HISTORY_POOLCOUNTERS_H_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Usage statistics of a pool.
+struct PoolCounters
+{
+    //! Number of requests served with an element from the free list.
+    uint64_t hits = 0;
+
+    //! Number of requests that found the free list empty.
+    uint64_t misses = 0;
+
+    //! Number of times an access to the free list was retried because another thread accessed it at the same time.
+    uint64_t contentions = 0;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* RTPS_HISTORY_POOLCOUNTERS_H_ */
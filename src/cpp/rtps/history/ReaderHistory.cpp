@@ -149,7 +149,7 @@ bool ReaderHistory::remove_changes_with_guid(
     {
         //Lock scope
         std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-        for (std::vector<CacheChange_t*>::iterator chit = m_changes.begin(); chit != m_changes.end(); ++chit)
+        for (iterator chit = m_changes.begin(); chit != m_changes.end(); ++chit)
         {
             if ((*chit)->writerGUID == a_guid)
             {
@@ -181,7 +181,7 @@ bool ReaderHistory::remove_fragmented_changes_until(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
+    iterator chit = m_changes.begin();
     while (chit != m_changes.end())
     {
         CacheChange_t* item = *chit;
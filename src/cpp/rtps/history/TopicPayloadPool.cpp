@@ -44,24 +44,30 @@ bool TopicPayloadPool::do_get_payload(
 {
     PayloadNode* payload = nullptr;
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    if (free_payloads_.pop(payload))
     {
-        payload = allocate(size); //Allocates a single payload
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Some payload may have been released while waiting for the mutex
+        if (!free_payloads_.pop(payload))
+        {
+            payload = allocate(size); //Allocates a single payload
+        }
+        lock.unlock();
+
         if (payload == nullptr)
         {
-            lock.unlock();
             cache_change.serializedPayload.data = nullptr;
             cache_change.serializedPayload.max_size = 0;
             cache_change.payload_owner(nullptr);
             return false;
         }
     }
-    else
-    {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
     // Resize if needed
     if (resizeable && size > payload->data_size())
@@ -69,8 +75,7 @@ bool TopicPayloadPool::do_get_payload(
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
-            lock.unlock();
+            free_payloads_.push(payload);
             logError(RTPS_HISTORY, "Failed to resize the payload");
 
             cache_change.serializedPayload.data = nullptr;
@@ -80,7 +85,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
     cache_change.serializedPayload.max_size = payload->data_size();
@@ -138,9 +142,10 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        // Capacity for all the payloads is reserved when they are allocated, so this cannot fail
+        bool pushed = free_payloads_.push(PayloadNode::node(cache_change.serializedPayload.data));
+        assert(pushed);
+        (void)pushed;
     }
 
     cache_change.serializedPayload.length = 0;
@@ -203,6 +208,7 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
 
     payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
     all_payloads_.push_back(payload);
+    free_payloads_.reserve(all_payloads_.size());
     return payload;
 }
 
@@ -253,7 +259,7 @@ void TopicPayloadPool::reserve (
     for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
     {
         PayloadNode* payload = do_allocate(size);
-        free_payloads_.push_back(payload);
+        free_payloads_.push(payload);
     }
 }
 
@@ -264,8 +270,12 @@ bool TopicPayloadPool::shrink (
 
     while (max_num_payloads < all_payloads_.size())
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
+        PayloadNode* payload = nullptr;
+        if (!free_payloads_.pop(payload))
+        {
+            // The free payloads were taken by other threads
+            return false;
+        }
 
         // Find data in allPayloads, remove element, then delete it
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
@@ -25,6 +25,7 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <utils/collections/lock_free_stack.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -127,6 +128,15 @@ public:
         return free_payloads_.size();
     }
 
+    PoolCounters payload_pool_counters() const override
+    {
+        PoolCounters counters;
+        counters.hits = hits_.load(std::memory_order_relaxed);
+        counters.misses = misses_.load(std::memory_order_relaxed);
+        counters.contentions = free_payloads_.contentions();
+        return counters;
+    }
+
     static std::unique_ptr<ITopicPayloadPool> get(
             const BasicPoolConfig& config);
 
@@ -150,6 +160,7 @@ protected:
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
             data_size(size);
+            info().node = this;
         }
 
         ~PayloadNode()
@@ -194,19 +205,25 @@ protected:
 
         uint32_t data_index() const
         {
-            return info().data_index;
+            return data_index_;
         }
 
         static uint32_t data_index(
                 octet* data)
         {
-            return info(data).data_index;
+            return node(data)->data_index_;
         }
 
         void data_index(
                 uint32_t index)
         {
-            info().data_index = index;
+            data_index_ = index;
+        }
+
+        static PayloadNode* node(
+                octet* data)
+        {
+            return info(data).node;
         }
 
         octet* data() const
@@ -242,12 +259,16 @@ protected:
         {
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
-            uint32_t data_index = 0;
+            PayloadNode* node = nullptr;
             octet data[1];
         };
 
         octet* buffer = nullptr;
 
+        // Kept outside the buffer, as it is updated when other payloads are removed from the pool,
+        // while the buffer may be reallocated by the thread using this payload.
+        uint32_t data_index_ = 0;
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
@@ -347,9 +368,13 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
-    std::vector<PayloadNode*> all_payloads_;  //< All payloads
+    LockFreeStack<PayloadNode*> free_payloads_; //< Payloads that are free. It has capacity for all payloads.
+    std::vector<PayloadNode*> all_payloads_;    //< All payloads
+
+    std::atomic<uint64_t> hits_{0};   //< Payloads served from free_payloads_
+    std::atomic<uint64_t> misses_{0}; //< Requests that found free_payloads_ empty
 
+    //! Protects all_payloads_ and the sizes of the pool. Free payloads are taken and returned without it.
     std::mutex mutex_;
 
 };
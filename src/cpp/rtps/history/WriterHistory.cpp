@@ -22,6 +22,7 @@
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/common/WriteParams.h>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -138,6 +139,53 @@ bool WriterHistory::matches_change(
     return inner_change->sequenceNumber == outer_change->sequenceNumber;
 }
 
+//! Orders changes by sequence number, which is how they are kept on writer histories.
+static bool lower_sequence_number(
+        const CacheChange_t* change,
+        const SequenceNumber_t& seq)
+{
+    return change->sequenceNumber < seq;
+}
+
+History::const_iterator WriterHistory::find_change_nts(
+        CacheChange_t* ch)
+{
+    if (nullptr == mp_mutex || nullptr == ch)
+    {
+        return History::find_change_nts(ch);
+    }
+
+    const_iterator it = std::lower_bound(m_changes.cbegin(), m_changes.cend(), ch->sequenceNumber,
+                    lower_sequence_number);
+    if (it != m_changes.cend() && matches_change(*it, ch))
+    {
+        return it;
+    }
+
+    return m_changes.cend();
+}
+
+History::const_iterator WriterHistory::get_change_nts(
+        const SequenceNumber_t& seq,
+        const GUID_t& guid,
+        CacheChange_t** change,
+        const_iterator hint) const
+{
+    *change = nullptr;
+    if (mp_writer == nullptr || guid != mp_writer->getGuid())
+    {
+        return m_changes.cend();
+    }
+
+    const_iterator it = std::lower_bound(hint, m_changes.cend(), seq, lower_sequence_number);
+    if (it != m_changes.cend() && (*it)->sequenceNumber == seq)
+    {
+        *change = *it;
+    }
+
+    return it;
+}
+
 History::iterator WriterHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -0,0 +1,116 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MatchedReadersIndex.cpp
+ */
+
+#include "MatchedReadersIndex.hpp"
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static void erase_reader(
+        std::vector<EntityId_t>& readers,
+        const EntityId_t& reader_id)
+{
+    readers.erase(std::remove(readers.begin(), readers.end(), reader_id), readers.end());
+}
+
+void MatchedReadersIndex::add_match(
+        const EntityId_t& reader_id,
+        const GUID_t& writer_guid)
+{
+    update([&](const Snapshot& index)
+            {
+                auto it = index.matched_readers.find(writer_guid);
+                return it == index.matched_readers.end() || !contains(it->second, reader_id);
+            },
+            [&](Snapshot& index)
+            {
+                index.matched_readers[writer_guid].push_back(reader_id);
+            });
+}
+
+void MatchedReadersIndex::remove_match(
+        const EntityId_t& reader_id,
+        const GUID_t& writer_guid)
+{
+    update([&](const Snapshot& index)
+            {
+                auto it = index.matched_readers.find(writer_guid);
+                return it != index.matched_readers.end() && contains(it->second, reader_id);
+            },
+            [&](Snapshot& index)
+            {
+                auto it = index.matched_readers.find(writer_guid);
+                erase_reader(it->second, reader_id);
+                if (it->second.empty())
+                {
+                    index.matched_readers.erase(it);
+                }
+            });
+}
+
+void MatchedReadersIndex::set_accepts_unmatched_writers(
+        const EntityId_t& reader_id,
+        bool accepts)
+{
+    // This is called on every match, so most calls do not change anything
+    update([&](const Snapshot& index)
+            {
+                return contains(index.unmatched_writers_readers, reader_id) != accepts;
+            },
+            [&](Snapshot& index)
+            {
+                if (accepts)
+                {
+                    index.unmatched_writers_readers.push_back(reader_id);
+                }
+                else
+                {
+                    erase_reader(index.unmatched_writers_readers, reader_id);
+                }
+            });
+}
+
+void MatchedReadersIndex::remove_reader(
+        const EntityId_t& reader_id)
+{
+    update([&](const Snapshot&)
+            {
+                return true;
+            },
+            [&](Snapshot& index)
+            {
+                erase_reader(index.unmatched_writers_readers, reader_id);
+                for (auto it = index.matched_readers.begin(); it != index.matched_readers.end();)
+                {
+                    erase_reader(it->second, reader_id);
+                    if (it->second.empty())
+                    {
+                        it = index.matched_readers.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            });
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,175 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MatchedReadersIndex.hpp
+ */
+
+#ifndef RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
+#define RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/Guid.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Index of the user readers of a participant that should receive the messages of a writer which are not directed
+ * to a specific reader: the readers matched with the writer, and the readers accepting messages from writers they
+ * are not matched with (i.e. those accepting unknown writers or with a trusted writer).
+ *
+ * Lookups work on an immutable snapshot, so they do not block nor copy anything. Updates, which only happen when
+ * endpoints are matched or configured, copy the snapshot and publish the new one.
+ */
+class MatchedReadersIndex
+{
+public:
+
+    //! Immutable contents of the index.
+    struct Snapshot
+    {
+        //! User readers matched with each writer.
+        std::map<GUID_t, std::vector<EntityId_t>> matched_readers;
+        //! User readers that may accept messages from writers they are not matched with.
+        std::vector<EntityId_t> unmatched_writers_readers;
+    };
+
+    MatchedReadersIndex()
+        : snapshot_(std::make_shared<Snapshot>())
+    {
+    }
+
+    /**
+     * Records that a reader has been matched with a writer.
+     * @param reader_id Entity id of the local reader.
+     * @param writer_guid GUID of the writer.
+     */
+    void add_match(
+            const EntityId_t& reader_id,
+            const GUID_t& writer_guid);
+
+    /**
+     * Records that a reader is no longer matched with a writer.
+     * @param reader_id Entity id of the local reader.
+     * @param writer_guid GUID of the writer.
+     */
+    void remove_match(
+            const EntityId_t& reader_id,
+            const GUID_t& writer_guid);
+
+    /**
+     * Sets whether a reader may accept messages from writers it is not matched with.
+     * @param reader_id Entity id of the local reader.
+     * @param accepts Whether the reader accepts unknown writers or has a trusted writer.
+     */
+    void set_accepts_unmatched_writers(
+            const EntityId_t& reader_id,
+            bool accepts);
+
+    /**
+     * Removes all the information of a reader.
+     * @param reader_id Entity id of the local reader.
+     */
+    void remove_reader(
+            const EntityId_t& reader_id);
+
+    /**
+     * Get the current contents of the index.
+     * @return A snapshot that is not modified by later updates.
+     */
+    std::shared_ptr<const Snapshot> snapshot() const
+    {
+        return std::atomic_load(&snapshot_);
+    }
+
+    /**
+     * Calls a functor once for each reader that should receive the messages of a writer not directed to a specific
+     * reader.
+     * @param writer_guid GUID of the writer.
+     * @param f Functor receiving the entity id of each reader.
+     */
+    template<typename Functor>
+    void for_each_reader(
+            const GUID_t& writer_guid,
+            const Functor& f) const
+    {
+        std::shared_ptr<const Snapshot> current = snapshot();
+
+        for (const EntityId_t& reader_id : current->unmatched_writers_readers)
+        {
+            f(reader_id);
+        }
+
+        auto it = current->matched_readers.find(writer_guid);
+        if (it != current->matched_readers.end())
+        {
+            for (const EntityId_t& reader_id : it->second)
+            {
+                // Readers accepting unmatched writers have already been informed
+                if (!contains(current->unmatched_writers_readers, reader_id))
+                {
+                    f(reader_id);
+                }
+            }
+        }
+    }
+
+private:
+
+    static bool contains(
+            const std::vector<EntityId_t>& readers,
+            const EntityId_t& reader_id)
+    {
+        return std::find(readers.begin(), readers.end(), reader_id) != readers.end();
+    }
+
+    /**
+     * Applies a modification to a copy of the current snapshot and publishes the copy.
+     * @param needed Predicate on the current snapshot telling whether the modification changes anything.
+     * @param modify Functor applying the modification.
+     */
+    template<typename Predicate, typename Modifier>
+    void update(
+            const Predicate& needed,
+            const Modifier& modify)
+    {
+        std::lock_guard<std::mutex> guard(update_mutex_);
+        if (needed(*snapshot_))
+        {
+            std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*snapshot_);
+            modify(*next);
+            std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(std::move(next)));
+        }
+    }
+
+    //! Serializes updates. Lookups never take it.
+    std::mutex update_mutex_;
+
+    std::shared_ptr<const Snapshot> snapshot_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // RTPS_MESSAGES_MATCHEDREADERSINDEX_HPP
@@ -27,6 +27,7 @@
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <mutex>
@@ -105,6 +106,7 @@ MessageReceiver::~MessageReceiver()
     logInfo(RTPS_MSG_IN, "");
     assert(associated_writers_.empty());
     assert(associated_readers_.empty());
+    assert(associated_builtin_readers_.empty());
 }
 
  #if HAVE_SECURITY
@@ -147,7 +149,7 @@ void MessageReceiver::process_data_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_with_security(
@@ -184,7 +186,7 @@ void MessageReceiver::process_data_fragment_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 #endif // if HAVE SECURITY
@@ -198,7 +200,7 @@ void MessageReceiver::process_data_message_without_security(
                 reader->processDataMsg(&change);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_without_security(
@@ -213,7 +215,7 @@ void MessageReceiver::process_data_fragment_message_without_security(
                 reader->processDataFragMsg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::associateEndpoint(
@@ -257,6 +259,11 @@ void MessageReceiver::associateEndpoint(
 
             readers->second.push_back(reader);
         }
+
+        if (reader->getGuid().is_builtin())
+        {
+            associated_builtin_readers_.push_back(reader);
+        }
     }
 }
 
@@ -295,6 +302,12 @@ void MessageReceiver::removeEndpoint(
                     break;
                 }
             }
+
+            auto builtin = std::find(associated_builtin_readers_.begin(), associated_builtin_readers_.end(), var);
+            if (builtin != associated_builtin_readers_.end())
+            {
+                associated_builtin_readers_.erase(builtin);
+            }
         }
     }
 }
@@ -633,6 +646,7 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 template<typename Functor>
 void MessageReceiver::findAllReaders(
         const EntityId_t& readerID,
+        const GUID_t& writerGUID,
         const Functor& callback)
 {
     if (readerID != c_EntityId_Unknown)
@@ -648,16 +662,31 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        // Builtin readers may accept messages from writers they are not matched with (i.e. SPDP)
+        for (const auto& it : associated_builtin_readers_)
         {
-            for (const auto& it : readers.second)
+            if (it->m_acceptMessagesToUnknownReaders)
             {
-                if (it->m_acceptMessagesToUnknownReaders)
-                {
-                    callback(it);
-                }
+                callback(it);
             }
         }
+
+        // User readers only accept messages from their matched writers, unless they accept unknown writers or
+        // have a trusted writer
+        participant_->matched_readers_index().for_each_reader(writerGUID, [&](const EntityId_t& reader_id)
+                {
+                    const auto readers = associated_readers_.find(reader_id);
+                    if (readers != associated_readers_.end())
+                    {
+                        for (const auto& it : readers->second)
+                        {
+                            if (it->m_acceptMessagesToUnknownReaders)
+                            {
+                                callback(it);
+                            }
+                        }
+                    }
+                });
     }
 }
 
@@ -1032,7 +1061,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 
     std::lock_guard<std::mutex> guard(mtx_);
     //Look for the correct reader and writers:
-    findAllReaders(readerGUID.entityId,
+    findAllReaders(readerGUID.entityId, writerGUID,
             [&writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag](RTPSReader* reader)
             {
                 reader->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
@@ -1117,7 +1146,7 @@ bool MessageReceiver::proc_Submsg_Gap(
     }
 
     std::lock_guard<std::mutex> guard(mtx_);
-    findAllReaders(readerGUID.entityId,
+    findAllReaders(readerGUID.entityId, writerGUID,
             [&writerGUID, &gapStart, &gapList](RTPSReader* reader)
             {
                 reader->processGapMsg(writerGUID, gapStart, gapList);
@@ -132,6 +132,9 @@ RTPSMessageGroup::RTPSMessageGroup(
 #endif // if HAVE_SECURITY
     , max_blocking_time_point_(max_blocking_time_point)
     , send_buffer_(participant->get_send_buffer())
+    , reference_payloads_(true)
+    , payload_bytes_(0)
+    , pending_payload_position_(0)
 {
     // Avoid warning when neither SECURITY nor DEBUG is used
     (void)participant;
@@ -152,6 +155,13 @@ RTPSMessageGroup::RTPSMessageGroup(
     {
         encrypt_msg_ = &(send_buffer_->rtpsmsg_encrypt_);
         CDRMessage::initCDRMsg(encrypt_msg_);
+
+        // Protected payloads, submessages and messages need to be encoded from a single buffer
+        const security::EndpointSecurityAttributes& security_attributes =
+                endpoint->getAttributes().security_attributes();
+        reference_payloads_ = !security_attributes.is_payload_protected &&
+                !security_attributes.is_submessage_protected &&
+                !(participant->security_attributes().is_rtps_protected && endpoint->supports_rtps_protection());
     }
 #endif // if HAVE_SECURITY
 }
@@ -176,6 +186,9 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+
+    send_buffer_->payloads_.clear();
+    payload_bytes_ = 0;
 }
 
 void RTPSMessageGroup::flush()
@@ -187,14 +200,19 @@ void RTPSMessageGroup::flush()
 
 void RTPSMessageGroup::send()
 {
-    CDRMessage_t* msgToSend = full_msg_;
-
     if (full_msg_->length > RTPSMESSAGE_HEADER_SIZE)
     {
+        NetworkBuffers& buffers = send_buffer_->buffers_;
+        uint32_t total_bytes = full_msg_->length + payload_bytes_;
+        buffers.clear();
+
 #if HAVE_SECURITY
         // TODO(Ricardo) Control message size if it will be encrypted.
         if (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection())
         {
+            // Payloads are never referenced when the whole message is protected
+            assert(send_buffer_->payloads_.empty());
+
             CDRMessage::initCDRMsg(encrypt_msg_);
             full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
             encrypt_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
@@ -208,15 +226,34 @@ void RTPSMessageGroup::send()
                 return;
             }
 
-            msgToSend = encrypt_msg_;
+            buffers.emplace_back(encrypt_msg_->buffer, encrypt_msg_->length);
+            total_bytes = encrypt_msg_->length;
         }
+        else
 #endif // if HAVE_SECURITY
+        {
+            // Interleave the referenced payloads with the slices of the message that surround them
+            uint32_t position = 0;
+            for (const std::pair<uint32_t, NetworkBuffer>& payload : send_buffer_->payloads_)
+            {
+                if (payload.first > position)
+                {
+                    buffers.emplace_back(&full_msg_->buffer[position], payload.first - position);
+                    position = payload.first;
+                }
+                if (payload.second.size > 0)
+                {
+                    buffers.push_back(payload.second);
+                }
+            }
+            buffers.emplace_back(&full_msg_->buffer[position], full_msg_->length - position);
+        }
 
-        if (!sender_.send(msgToSend, max_blocking_time_point_))
+        if (!sender_.send(buffers, total_bytes, max_blocking_time_point_))
         {
             throw timeout();
         }
-        currentBytesSent_ += msgToSend->length;
+        currentBytesSent_ += total_bytes;
     }
 }
 
@@ -232,6 +269,7 @@ void RTPSMessageGroup::check_and_maybe_flush(
         const GuidPrefix_t& destination_guid_prefix)
 {
     CDRMessage::initCDRMsg(submessage_msg_);
+    pending_payload_position_ = 0;
 
     if (sender_.destinations_have_changed())
     {
@@ -245,7 +283,7 @@ bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
         bool is_big_submessage)
 {
-    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    if (!append_submessage())
     {
         // Retry
         flush();
@@ -258,7 +296,7 @@ bool RTPSMessageGroup::insert_submessage(
             return false;
         }
 
-        if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+        if (!append_submessage())
         {
             logError(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
@@ -274,6 +312,37 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::append_submessage()
+{
+    // Referenced payloads also count for the maximum size of the message
+    uint32_t pending_bytes = pending_payload_position_ > 0 ? pending_payload_.size : 0u;
+    uint32_t message_size = full_msg_->length + payload_bytes_ + submessage_msg_->length + pending_bytes;
+    if (message_size > full_msg_->max_size)
+    {
+        // The buffer only holds the headers of referenced payloads, so the message may still be carried by the
+        // transports of the destinations when they allow bigger messages than the participant.
+        if (full_msg_->length + submessage_msg_->length > full_msg_->max_size ||
+                message_size > sender_.max_message_size())
+        {
+            return false;
+        }
+    }
+
+    uint32_t submessage_start = full_msg_->pos;
+    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    {
+        return false;
+    }
+
+    if (pending_payload_position_ > 0)
+    {
+        send_buffer_->payloads_.emplace_back(submessage_start + pending_payload_position_, pending_payload_);
+        payload_bytes_ += pending_bytes;
+    }
+
+    return true;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -393,8 +462,15 @@ bool RTPSMessageGroup::add_data(
 
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
+    uint32_t* payload_position = nullptr;
+    if (reference_payloads_ && send_buffer_->payloads_.size() < RTPSMessageGroup_t::max_number_of_payloads)
+    {
+        pending_payload_ = NetworkBuffer(change_to_add.serializedPayload.data, change_to_add.serializedPayload.length);
+        payload_position = &pending_payload_position_;
+    }
+
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inlineQos, &is_big_submessage))
+            readerId, expectsInlineQos, inlineQos, &is_big_submessage, payload_position))
     {
         logError(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
@@ -431,6 +507,26 @@ bool RTPSMessageGroup::add_data(
     return insert_submessage(is_big_submessage);
 }
 
+bool RTPSMessageGroup::fits_unfragmented(
+        const CacheChange_t& change) const
+{
+    // The payload should be referenced, as the buffers are only as big as the messages of the participant
+    if (!reference_payloads_ || send_buffer_->payloads_.size() >= RTPSMessageGroup_t::max_number_of_payloads)
+    {
+        return false;
+    }
+
+    uint32_t max_message_size = sender_.max_message_size();
+    if (max_message_size <= full_msg_->max_size)
+    {
+        return false;
+    }
+
+    uint32_t overhead = RTPSMESSAGE_HEADER_SIZE + info_submessages_size_ + data_frag_header_size_ +
+            max_inline_qos_size_ + 3;
+    return change.serializedPayload.length <= max_message_size - overhead;
+}
+
 bool RTPSMessageGroup::add_data_frag(
         const CacheChange_t& change,
         const uint32_t fragment_number,
@@ -489,9 +585,16 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    uint32_t* payload_position = nullptr;
+    if (reference_payloads_ && send_buffer_->payloads_.size() < RTPSMessageGroup_t::max_number_of_payloads)
+    {
+        pending_payload_ = NetworkBuffer(change_to_add.serializedPayload.data, change_to_add.serializedPayload.length);
+        payload_position = &pending_payload_position_;
+    }
+
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inlineQos))
+            expectsInlineQos, inlineQos, payload_position))
     {
         logError(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
@@ -24,6 +24,10 @@
 #include <fastrtps/rtps/common/CDRMessage_t.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+
+#include <utility>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -95,6 +99,9 @@ public:
     {
         CDRMessage::initCDRMsg(&rtpsmsg_fullmsg_);
         RTPSMessageCreator::addHeader(&rtpsmsg_fullmsg_, participant_guid);
+
+        payloads_.reserve(initial_number_of_payloads);
+        buffers_.reserve(2 * initial_number_of_payloads + 1);
     }
 
     CDRMessage_t rtpsmsg_submessage_;
@@ -104,6 +111,22 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Payloads not copied into rtpsmsg_fullmsg_, with the position where they should be inserted.
+    std::vector<std::pair<uint32_t, NetworkBuffer>> payloads_;
+
+    //! Slices of the message handed to the transports.
+    NetworkBuffers buffers_;
+
+    /**
+     * Maximum number of payloads referenced by a message. Further payloads are copied, so a message
+     * never has more than 64 slices, which is the most a transport gathers on a single send operation.
+     */
+    static constexpr size_t max_number_of_payloads = 31;
+
+private:
+
+    static constexpr size_t initial_number_of_payloads = 8;
 };
 
 } // namespace rtps
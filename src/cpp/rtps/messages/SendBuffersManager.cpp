@@ -17,20 +17,40 @@
  */
 
 #include "SendBuffersManager.hpp"
-#include "../participant/RTPSParticipantImpl.h"
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <chrono>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+static std::atomic<uint64_t> next_send_buffers_manager_id(1);
+
+thread_local std::array<SendBuffersManager::ThreadCacheEntry, SendBuffersManager::max_thread_caches>
+SendBuffersManager::thread_cache_entries_;
+
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing)
-    : allow_growing_(allow_growing)
+    : id_(next_send_buffers_manager_id.fetch_add(1, std::memory_order_relaxed))
+    , allow_growing_(allow_growing)
 {
     pool_.reserve(reserved_size);
 }
 
+SendBuffersManager::~SendBuffersManager()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    take_cached_buffers();
+    for (std::shared_ptr<ThreadCache>& cache : thread_caches_)
+    {
+        cache->orphaned.store(true, std::memory_order_relaxed);
+    }
+
+    assert(pool_.size() == n_created_);
+}
+
 void SendBuffersManager::init(
         const RTPSParticipantImpl* participant)
 {
@@ -76,23 +96,51 @@ void SendBuffersManager::init(
 std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant)
 {
+    ThreadCache* cache = thread_cache();
+    if (cache != nullptr)
+    {
+        RTPSMessageGroup_t* cached = cache->buffer.exchange(nullptr);
+        if (cached != nullptr)
+        {
+            thread_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+            return std::unique_ptr<RTPSMessageGroup_t>(cached);
+        }
+    }
+
     std::unique_lock<std::mutex> lock(mutex_);
 
     std::unique_ptr<RTPSMessageGroup_t> ret_val;
 
     while (pool_.empty())
     {
+        if (take_cached_buffers())
+        {
+            break;
+        }
+
         if (allow_growing_ || n_created_ < pool_.capacity())
         {
             add_one_buffer(participant);
         }
         else
         {
-            logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
-            available_cv_.wait(lock);
+            // Threads returning a buffer check the number of waiting threads after storing it on their caches, so
+            // the caches are checked again after it is increased.
+            n_waiting_.fetch_add(1);
+            if (!take_cached_buffers())
+            {
+                logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
+                auto wait_start = std::chrono::steady_clock::now();
+                available_cv_.wait(lock);
+                waits_.fetch_add(1, std::memory_order_relaxed);
+                wait_time_ns_.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - wait_start).count()), std::memory_order_relaxed);
+            }
+            n_waiting_.fetch_sub(1);
         }
     }
 
+    shared_pool_hits_.fetch_add(1, std::memory_order_relaxed);
     ret_val = std::move(pool_.back());
     pool_.pop_back();
 
@@ -102,11 +150,42 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
 void SendBuffersManager::return_buffer(
         std::unique_ptr <RTPSMessageGroup_t>&& buffer)
 {
+    ThreadCache* cache = thread_cache();
+    RTPSMessageGroup_t* expected = nullptr;
+    if (cache != nullptr && cache->buffer.compare_exchange_strong(expected, buffer.get()))
+    {
+        buffer.release();
+        if (0u == n_waiting_.load())
+        {
+            return;
+        }
+
+        // Some thread is waiting for a buffer, so it is given back to the shared pool
+        RTPSMessageGroup_t* cached = cache->buffer.exchange(nullptr);
+        if (cached == nullptr)
+        {
+            // Already taken by the waiting thread
+            return;
+        }
+        buffer.reset(cached);
+    }
+
     std::lock_guard<std::mutex> guard(mutex_);
     pool_.push_back(std::move(buffer));
     available_cv_.notify_one();
 }
 
+SendBuffersCounters SendBuffersManager::get_counters() const
+{
+    SendBuffersCounters counters;
+    counters.thread_cache_hits = thread_cache_hits_.load(std::memory_order_relaxed);
+    counters.shared_pool_hits = shared_pool_hits_.load(std::memory_order_relaxed);
+    counters.grown_buffers = grown_buffers_.load(std::memory_order_relaxed);
+    counters.waits = waits_.load(std::memory_order_relaxed);
+    counters.wait_time_ns = wait_time_ns_.load(std::memory_order_relaxed);
+    return counters;
+}
+
 void SendBuffersManager::add_one_buffer(
         const RTPSParticipantImpl* participant)
 {
@@ -117,6 +196,74 @@ void SendBuffersManager::add_one_buffer(
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
     pool_.emplace_back(new_item);
     ++n_created_;
+    grown_buffers_.fetch_add(1, std::memory_order_relaxed);
+}
+
+SendBuffersManager::ThreadCache* SendBuffersManager::thread_cache()
+{
+    ThreadCacheEntry* free_entry = nullptr;
+    for (ThreadCacheEntry& entry : thread_cache_entries_)
+    {
+        if (entry.manager_id == id_)
+        {
+            return entry.cache.get();
+        }
+
+        if (entry.cache && entry.cache->orphaned.load(std::memory_order_relaxed))
+        {
+            // The manager of this entry has been destroyed
+            entry.manager_id = 0;
+            entry.cache.reset();
+        }
+
+        if (free_entry == nullptr && entry.manager_id == 0)
+        {
+            free_entry = &entry;
+        }
+    }
+
+    if (free_entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    // Caches only referenced by the manager belong to threads that have finished, so they are reused
+    std::shared_ptr<ThreadCache> cache;
+    for (std::shared_ptr<ThreadCache>& registered : thread_caches_)
+    {
+        if (registered.use_count() == 1)
+        {
+            cache = registered;
+            break;
+        }
+    }
+
+    if (!cache)
+    {
+        cache = std::make_shared<ThreadCache>();
+        thread_caches_.push_back(cache);
+    }
+
+    free_entry->manager_id = id_;
+    free_entry->cache = cache;
+    return cache.get();
+}
+
+bool SendBuffersManager::take_cached_buffers()
+{
+    bool ret_val = false;
+    for (std::shared_ptr<ThreadCache>& cache : thread_caches_)
+    {
+        RTPSMessageGroup_t* cached = cache->buffer.exchange(nullptr);
+        if (cached != nullptr)
+        {
+            pool_.emplace_back(cached);
+            ret_val = true;
+        }
+    }
+    return ret_val;
 }
 
 } /* namespace rtps */
@@ -23,6 +23,8 @@
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 
+#include <array>               // std::array
+#include <atomic>              // std::atomic
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
 #include <mutex>               // std::mutex
@@ -35,8 +37,30 @@ namespace rtps {
 
 class RTPSParticipantImpl;
 
+//! Usage statistics of a SendBuffersManager.
+struct SendBuffersCounters
+{
+    //! Number of buffers served from the cache of the calling thread.
+    uint64_t thread_cache_hits = 0;
+
+    //! Number of buffers served from the shared pool.
+    uint64_t shared_pool_hits = 0;
+
+    //! Number of buffers created after the pool was initialized.
+    uint64_t grown_buffers = 0;
+
+    //! Number of times a thread had to wait for a buffer to be returned.
+    uint64_t waits = 0;
+
+    //! Total time spent waiting for a buffer to be returned, in nanoseconds.
+    uint64_t wait_time_ns = 0;
+};
+
 /**
  * Manages a pool of send buffers.
+ *
+ * Each thread keeps the last buffer it returned on a cache of its own, so a thread sending on its own never takes
+ * the lock of the shared pool. Buffers kept on the caches are taken back into the shared pool when it is empty.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
@@ -52,10 +76,7 @@ public:
             size_t reserved_size,
             bool allow_growing);
 
-    ~SendBuffersManager()
-    {
-        assert(pool_.size() == n_created_);
-    }
+    ~SendBuffersManager();
 
     /**
      * Initialization of pool.
@@ -80,11 +101,52 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    //! Get the usage statistics of the pool.
+    SendBuffersCounters get_counters() const;
+
 private:
 
+    //! Cache of one buffer used by a single thread.
+    struct ThreadCache
+    {
+        //! Cached buffer, owned by the manager.
+        std::atomic<RTPSMessageGroup_t*> buffer{nullptr};
+        //! Set when the manager owning the cache is destroyed.
+        std::atomic<bool> orphaned{false};
+    };
+
+    //! Cache of a thread for one of the managers it uses.
+    struct ThreadCacheEntry
+    {
+        uint64_t manager_id = 0;
+        std::shared_ptr<ThreadCache> cache;
+    };
+
+    //! Maximum number of managers for which a thread keeps a cache.
+    static constexpr size_t max_thread_caches = 4;
+
+    //! Caches of the calling thread.
+    static thread_local std::array<ThreadCacheEntry, max_thread_caches> thread_cache_entries_;
+
     void add_one_buffer(
             const RTPSParticipantImpl* participant);
 
+    /**
+     * Get the cache of the calling thread, registering a new one on first use.
+     * @return pointer to the cache, nullptr when the thread already keeps the maximum number of caches.
+     */
+    ThreadCache* thread_cache();
+
+    /**
+     * Move the buffers kept on the caches of the threads to the shared pool.
+     * Should be called with the mutex taken.
+     * @return whether any buffer was moved.
+     */
+    bool take_cached_buffers();
+
+    //!Unique identifier of the manager, so threads never mistake the cache of a destroyed manager
+    const uint64_t id_;
+
     //!Protects all data
     std::mutex mutex_;
     //!Send buffers pool
@@ -97,6 +159,16 @@ private:
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
     std::condition_variable available_cv_;
+    //!Caches of the threads using this manager
+    std::vector<std::shared_ptr<ThreadCache>> thread_caches_;
+    //!Number of threads waiting on available_cv_
+    std::atomic<uint32_t> n_waiting_{0};
+    //!Counters for SendBuffersCounters
+    std::atomic<uint64_t> thread_cache_hits_{0};
+    std::atomic<uint64_t> shared_pool_hits_{0};
+    std::atomic<uint64_t> grown_buffers_{0};
+    std::atomic<uint64_t> waits_{0};
+    std::atomic<uint64_t> wait_time_ns_{0};
 };
 
 } /* namespace rtps */
@@ -56,7 +56,8 @@ bool RTPSMessageCreator::addSubmessageData(
         const EntityId_t& readerId,
         bool expectsInlineQos,
         InlineQosWriter* inlineQos,
-        bool* is_big_submessage)
+        bool* is_big_submessage,
+        uint32_t* payload_position)
 {
     octet flags = 0x0;
     //Find out flags
@@ -179,9 +180,25 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     //Add Serialized Payload
+    uint32_t skipped_bytes = 0;
+    if (payload_position != nullptr)
+    {
+        *payload_position = 0;
+    }
+
     if (dataFlag)
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+        if (payload_position != nullptr)
+        {
+            // Payload will be inserted by the caller
+            *payload_position = msg->pos;
+            skipped_bytes = change->serializedPayload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data,
+                            change->serializedPayload.length);
+        }
     }
 
     if (keyFlag)
@@ -205,7 +222,7 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     // Align submessage to rtps alignment (4).
-    uint32_t align = (4 - msg->pos % 4) & 3;
+    uint32_t align = (4 - (msg->pos + skipped_bytes) % 4) & 3;
     for (uint32_t count = 0; count < align; ++count)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
@@ -217,7 +234,7 @@ bool RTPSMessageCreator::addSubmessageData(
         //submsgElem.length += align;
     }
 
-    uint32_t size32 = msg->pos - position_size_count_size;
+    uint32_t size32 = msg->pos + skipped_bytes - position_size_count_size;
     if (size32 <= std::numeric_limits<uint16_t>::max())
     {
         submessage_size = static_cast<uint16_t>(size32);
@@ -288,7 +305,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         TopicKind_t topicKind,
         const EntityId_t& readerId,
         bool expectsInlineQos,
-        InlineQosWriter* inlineQos)
+        InlineQosWriter* inlineQos,
+        uint32_t* payload_position)
 {
     octet flags = 0x0;
     //Find out flags
@@ -419,9 +437,24 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     }
 
     //Add Serialized Payload XXX TODO
+    uint32_t skipped_bytes = 0;
+    if (payload_position != nullptr)
+    {
+        *payload_position = 0;
+    }
+
     if (!keyFlag) // keyflag = 0 means that the serializedPayload SubmessageElement contains the serialized Data
     {
-        added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        if (payload_position != nullptr)
+        {
+            // Payload will be inserted by the caller
+            *payload_position = msg->pos;
+            skipped_bytes = payload.length;
+        }
+        else
+        {
+            added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        }
     }
     else
     {
@@ -444,7 +477,7 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
 
     // TODO(Ricardo) This should be on cachechange.
     // Align submessage to rtps alignment (4).
-    submessage_size = uint16_t(msg->pos - position_size_count_size);
+    submessage_size = uint16_t(msg->pos + skipped_bytes - position_size_count_size);
     for (; submessage_size& 3; ++submessage_size)
     {
         added_no_error &= CDRMessage::addOctet(msg, 0);
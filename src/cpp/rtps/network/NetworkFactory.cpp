@@ -193,6 +193,20 @@ bool NetworkFactory::is_local_locator(
     return false;
 }
 
+uint32_t NetworkFactory::get_max_message_size(
+        const Locator_t& locator) const
+{
+    for (auto& transport : mRegisteredTransports)
+    {
+        if (transport->IsLocatorSupported(locator))
+        {
+            return transport->get_configuration()->max_message_size();
+        }
+    }
+
+    return maxMessageSizeBetweenTransports_;
+}
+
 size_t NetworkFactory::numberOfRegisteredTransports() const
 {
     return mRegisteredTransports.size();
@@ -199,6 +199,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
 
     mp_userParticipant->mp_impl = this;
     mp_event_thr.init_thread();
+    async_thread_.init(m_att.properties);
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -588,6 +589,12 @@ bool RTPSParticipantImpl::create_writer(
         return false;
     }
 
+    async_thread().register_writer(SWriter, !m_controllers.empty());
+    for (auto& controller : m_controllers)
+    {
+        controller->register_writer(SWriter);
+    }
+
 #if HAVE_SECURITY
     if (!is_builtin)
     {
@@ -922,8 +929,8 @@ bool RTPSParticipantImpl::createReader(
 RTPSReader* RTPSParticipantImpl::find_local_reader(
         const GUID_t& reader_guid)
 {
-    // As this is only called from RTPSDomainImpl::find_local_reader, and it has
-    // the domain mutex taken, there is no need to take the participant mutex
+    // As this is only called from RTPSDomainImpl::find_local_reader, which has the domain mutex taken,
+    // and from EDP, which has the participant mutex taken, there is no need to take the participant mutex
     // std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
     for (auto reader : m_allReaderList)
@@ -940,8 +947,8 @@ RTPSReader* RTPSParticipantImpl::find_local_reader(
 RTPSWriter* RTPSParticipantImpl::find_local_writer(
         const GUID_t& writer_guid)
 {
-    // As this is only called from RTPSDomainImpl::find_local_reader, and it has
-    // the domain mutex taken, there is no need to take the participant mutex
+    // As this is only called from RTPSDomainImpl::find_local_reader, which has the domain mutex taken,
+    // and from EDP, which has the participant mutex taken, there is no need to take the participant mutex
     // std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
     for (auto writer : m_allWriterList)
@@ -1159,15 +1166,7 @@ void RTPSParticipantImpl::createReceiverResources(
         bool RegisterReceiver)
 {
     std::vector<std::shared_ptr<ReceiverResource>> newItemsBuffer;
-
-#if HAVE_SECURITY
-    // An auxilary buffer is needed in the ReceiverResource to to decrypt the message,
-    // that imposes a limit in the received messages size even if the transport allows (uint32_t) messages size.
-    uint32_t max_receiver_buffer_size =
-            is_secure() ? std::numeric_limits<uint16_t>::max() : std::numeric_limits<uint32_t>::max();
-#else
-    uint32_t max_receiver_buffer_size = std::numeric_limits<uint32_t>::max();
-#endif // if HAVE_SECURITY
+    uint32_t max_receiver_buffer_size = this->max_receiver_buffer_size();
 
     for (auto it_loc = Locator_list.begin(); it_loc != Locator_list.end(); ++it_loc)
     {
@@ -1304,6 +1303,8 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
                 mp_builtinProtocols->removeLocalReader(static_cast<RTPSReader*>(p_endpoint));
             }
 
+            matched_readers_index_.remove_reader(p_endpoint->getGuid().entityId);
+
 #if HAVE_SECURITY
             if (p_endpoint->getAttributes().security_attributes().is_submessage_protected ||
                     p_endpoint->getAttributes().security_attributes().is_payload_protected)
@@ -1318,6 +1319,36 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
     return true;
 }
 
+void RTPSParticipantImpl::add_matched_reader(
+        const GUID_t& reader_guid,
+        const GUID_t& writer_guid)
+{
+    if (!reader_guid.is_builtin())
+    {
+        matched_readers_index_.add_match(reader_guid.entityId, writer_guid);
+    }
+}
+
+void RTPSParticipantImpl::remove_matched_reader(
+        const GUID_t& reader_guid,
+        const GUID_t& writer_guid)
+{
+    if (!reader_guid.is_builtin())
+    {
+        matched_readers_index_.remove_match(reader_guid.entityId, writer_guid);
+    }
+}
+
+void RTPSParticipantImpl::set_reader_accepts_unmatched_writers(
+        const GUID_t& reader_guid,
+        bool accepts)
+{
+    if (!reader_guid.is_builtin())
+    {
+        matched_readers_index_.set_accepts_unmatched_writers(reader_guid.entityId, accepts);
+    }
+}
+
 void RTPSParticipantImpl::normalize_endpoint_locators(
         EndpointAttributes& endpoint_att)
 {
@@ -1423,20 +1454,32 @@ void RTPSParticipantImpl::assert_remote_participant_liveliness(
 }
 
 uint32_t RTPSParticipantImpl::getMaxMessageSize() const
+{
+    return (std::min)(
+        m_network_Factory.get_max_message_size_between_transports(),
+        max_receiver_buffer_size());
+}
+
+uint32_t RTPSParticipantImpl::get_max_message_size(
+        const Locator_t& locator) const
+{
+    uint32_t max_message_size = (std::min)(
+        m_network_Factory.get_max_message_size(locator),
+        max_receiver_buffer_size());
+
+    return (std::max)(max_message_size, getMaxMessageSize());
+}
+
+uint32_t RTPSParticipantImpl::max_receiver_buffer_size() const
 {
 #if HAVE_SECURITY
     // An auxilary buffer is needed in the ReceiverResource to to decrypt the message,
     // that imposes a limit in the received messages size even if the transport allows (uint32_t) messages size.
     // So the sender limits also its size.
-    uint32_t max_receiver_buffer_size =
-            is_secure() ? std::numeric_limits<uint16_t>::max() : std::numeric_limits<uint32_t>::max();
+    return is_secure() ? std::numeric_limits<uint16_t>::max() : std::numeric_limits<uint32_t>::max();
 #else
-    uint32_t max_receiver_buffer_size = std::numeric_limits<uint32_t>::max();
+    return std::numeric_limits<uint32_t>::max();
 #endif // if HAVE_SECURITY
-
-    return (std::min)(
-        m_network_Factory.get_max_message_size_between_transports(),
-        max_receiver_buffer_size);
 }
 
 uint32_t RTPSParticipantImpl::getMaxDataSize()
@@ -1596,6 +1639,11 @@ void RTPSParticipantImpl::return_send_buffer(
     send_buffers_->return_buffer(std::move(buffer));
 }
 
+SendBuffersCounters RTPSParticipantImpl::send_buffers_counters() const
+{
+    return send_buffers_->get_counters();
+}
+
 uint32_t RTPSParticipantImpl::get_domain_id() const
 {
     return domain_id_;
@@ -49,6 +49,7 @@
 
 #include "../messages/RTPSMessageGroup_t.hpp"
 #include "../messages/SendBuffersManager.hpp"
+#include "../messages/MatchedReadersIndex.hpp"
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/Endpoint.h>
@@ -248,7 +249,8 @@ public:
 
     /**
      * Send a message to several locations
-     * @param msg Message to send.
+     * @param buffers List of slices with the message to send.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param destination_locators_begin Iterator at the first destination locator.
      * @param destination_locators_end Iterator at the end destination locator.
      * @param max_blocking_time_point execution time limit timepoint.
@@ -256,7 +258,8 @@ public:
      */
     template<class LocatorIteratorT>
     bool sendSync(
-            CDRMessage_t* msg,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             const LocatorIteratorT& destination_locators_begin,
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
@@ -272,7 +275,7 @@ public:
             {
                 LocatorIteratorT locators_begin = destination_locators_begin;
                 LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                send_resource->send(buffers, total_bytes, &locators_begin, &locators_end,
                         max_blocking_time_point);
             }
         }
@@ -333,6 +336,14 @@ public:
 
     uint32_t getMaxMessageSize() const;
 
+    /**
+     * Get the maximum size of the messages sent to a locator, which depends on the transport reaching it.
+     * @param locator Destination locator.
+     * @return Maximum message size, never lower than getMaxMessageSize().
+     */
+    uint32_t get_max_message_size(
+            const Locator_t& locator) const;
+
     uint32_t getMaxDataSize();
 
     uint32_t calculateMaxDataSize(
@@ -438,6 +449,9 @@ public:
     void return_send_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    //! Get the usage statistics of the pool of send buffers.
+    SendBuffersCounters send_buffers_counters() const;
+
     uint32_t get_domain_id() const;
 
     //!Compare metatraffic locators list searching for mutations
@@ -497,6 +511,9 @@ private:
     //! Receiver resource list needs its own mutext to avoid a race condition.
     std::mutex m_receiverResourcelistMutex;
 
+    //! User readers receiving the messages of each writer not directed to a specific reader.
+    MatchedReadersIndex matched_readers_index_;
+
     //!SenderResource List
     std::timed_mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
@@ -585,6 +602,12 @@ private:
     //! Indicates whether the participant has shared-memory transport
     bool has_shm_transport_;
 
+    /**
+     * Get the limit that the participant imposes to the size of the received messages,
+     * and so to the size of the messages it sends.
+     */
+    uint32_t max_receiver_buffer_size() const;
+
     /**
      * Get persistence service from factory, using endpoint attributes (or participant
      * attributes if endpoint does not define a persistence service config)
@@ -798,6 +821,46 @@ public:
     bool deleteUserEndpoint(
             Endpoint*);
 
+    /**
+     * Records that a user reader has been matched with a writer.
+     * Messages not directed to a specific reader are only dispatched to the user readers matched with their writer
+     * and to those accepting unmatched writers. Builtin readers are not recorded, as they always receive those
+     * messages.
+     * @param reader_guid GUID of the local reader.
+     * @param writer_guid GUID of the writer.
+     */
+    void add_matched_reader(
+            const GUID_t& reader_guid,
+            const GUID_t& writer_guid);
+
+    /**
+     * Records that a user reader is no longer matched with a writer.
+     * @param reader_guid GUID of the local reader.
+     * @param writer_guid GUID of the writer.
+     */
+    void remove_matched_reader(
+            const GUID_t& reader_guid,
+            const GUID_t& writer_guid);
+
+    /**
+     * Records whether a user reader may accept messages from writers it is not matched with, i.e. because it
+     * accepts unknown writers or has a trusted writer.
+     * @param reader_guid GUID of the local reader.
+     * @param accepts Whether the reader accepts unmatched writers.
+     */
+    void set_reader_accepts_unmatched_writers(
+            const GUID_t& reader_guid,
+            bool accepts);
+
+    /**
+     * Get the index of the user readers that should receive the messages not directed to a specific reader.
+     * @return Reference to the index.
+     */
+    const MatchedReadersIndex& matched_readers_index() const
+    {
+        return matched_readers_index_;
+    }
+
     /**
      * Get the begin of the user reader list
      * @return Iterator pointing to the begin of the user reader list
@@ -0,0 +1,972 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedLogPersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/MappedLogPersistenceService.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <utils/CRC32.hpp>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+namespace {
+
+//! Identifies the segment files, and the version of their format
+const char segment_magic[8] = { 'F', 'D', 'D', 'S', 'L', 'O', 'G', '1' };
+
+const char segment_extension[] = ".seg";
+
+//! Number of hexadecimal digits of the index on the name of the segment files
+constexpr size_t segment_index_digits = 16;
+
+//! A sealed segment is compacted when its changes use less than this fraction of it
+constexpr size_t compaction_ratio = 4;
+
+struct SegmentHeader
+{
+    char magic[8];
+    uint64_t index;
+};
+
+enum RecordKind : uint32_t
+{
+    //! Space not written yet
+    RECORD_NONE = 0,
+    //! A writer change, with its payload as data
+    RECORD_CHANGE = 1,
+    //! Last sequence number of a writer
+    RECORD_WRITER_SEQUENCE = 2,
+    //! Sequence number of a writer on a reader
+    RECORD_READER_SEQUENCE = 3
+};
+
+//! Set on the record of a change when it is removed
+constexpr uint32_t record_flag_removed = 1;
+
+struct RecordHeader
+{
+    //! Only field modified after the record is written. It is not covered by the CRC.
+    uint32_t flags;
+    //! CRC of the rest of the header and the data
+    uint32_t crc;
+    uint32_t kind;
+    uint32_t data_size;
+    int64_t sequence_number;
+    //! Instance handle of a change, or GUID of the writer of a reader sequence
+    octet guid[16];
+};
+
+constexpr size_t record_alignment = 8;
+
+static_assert(sizeof(SegmentHeader) % record_alignment == 0, "Records should be aligned");
+static_assert(sizeof(RecordHeader) % record_alignment == 0, "Records should be aligned");
+
+size_t record_size(
+        size_t data_size)
+{
+    return (sizeof(RecordHeader) + data_size + record_alignment - 1) & ~(record_alignment - 1);
+}
+
+uint32_t record_crc(
+        const RecordHeader* header)
+{
+    const octet* begin = reinterpret_cast<const octet*>(&header->kind);
+    return CRC32::compute(begin, sizeof(RecordHeader) - offsetof(RecordHeader, kind) + header->data_size);
+}
+
+SequenceNumber_t to_sequence_number(
+        int64_t sn)
+{
+    return SequenceNumber_t((int32_t)((sn >> 32) & 0xFFFFFFFF), (uint32_t)(sn & 0xFFFFFFFF));
+}
+
+} // namespace
+
+/**
+ * A file of a log, mapped on memory.
+ */
+class MappedLogPersistenceService::Segment
+{
+public:
+
+    Segment(
+            const std::string& path,
+            uint64_t index,
+            octet* base,
+            size_t size)
+        : path(path)
+        , index(index)
+        , base(base)
+        , size(size)
+        , end(sizeof(SegmentHeader))
+    {
+    }
+
+    ~Segment()
+    {
+        munmap(base, size);
+    }
+
+    static std::shared_ptr<Segment> create(
+            const std::string& path,
+            uint64_t index,
+            size_t size)
+    {
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+        {
+            logError(RTPS_PERSISTENCE, "Could not create " << path << ": " << strerror(errno));
+            return nullptr;
+        }
+
+        std::shared_ptr<Segment> ret = map(fd, path, index, size);
+        ::close(fd);
+        if (ret)
+        {
+            SegmentHeader* header = reinterpret_cast<SegmentHeader*>(ret->base);
+            memcpy(header->magic, segment_magic, sizeof(segment_magic));
+            header->index = index;
+        }
+        return ret;
+    }
+
+    static std::shared_ptr<Segment> open(
+            const std::string& path,
+            uint64_t index)
+    {
+        int fd = ::open(path.c_str(), O_RDWR);
+        if (fd < 0)
+        {
+            logError(RTPS_PERSISTENCE, "Could not open " << path << ": " << strerror(errno));
+            return nullptr;
+        }
+
+        std::shared_ptr<Segment> ret;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(SegmentHeader))
+        {
+            ret = map(fd, path, index, 0);
+        }
+        ::close(fd);
+
+        if (ret && memcmp(ret->base, segment_magic, sizeof(segment_magic)) != 0)
+        {
+            ret.reset();
+        }
+        if (!ret)
+        {
+            logError(RTPS_PERSISTENCE, "Invalid log segment " << path);
+        }
+        return ret;
+    }
+
+    RecordHeader* record(
+            size_t offset) const
+    {
+        return reinterpret_cast<RecordHeader*>(base + offset);
+    }
+
+    bool fits(
+            size_t data_size) const
+    {
+        return end + record_size(data_size) <= size;
+    }
+
+    //! Writes the memory of a range of the segment to the file.
+    void sync(
+            size_t offset,
+            size_t length) const
+    {
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t first = offset & ~(page_size - 1);
+        msync(base + first, offset + length - first, MS_SYNC);
+    }
+
+    const std::string path;
+
+    const uint64_t index;
+
+    octet* const base;
+
+    const size_t size;
+
+    //! Offset where the next record will be written
+    size_t end;
+
+    //! Number of records on the index of the log pointing to this segment
+    size_t live_records = 0;
+
+    //! Size of those records
+    size_t live_bytes = 0;
+
+private:
+
+    /**
+     * Maps an open file.
+     * @param size Size of the file, which is resized when not zero.
+     */
+    static std::shared_ptr<Segment> map(
+            int fd,
+            const std::string& path,
+            uint64_t index,
+            size_t size)
+    {
+        if (size == 0)
+        {
+            struct stat st;
+            if (fstat(fd, &st) != 0)
+            {
+                return nullptr;
+            }
+            size = static_cast<size_t>(st.st_size);
+        }
+        else if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            logError(RTPS_PERSISTENCE, "Could not resize " << path << ": " << strerror(errno));
+            return nullptr;
+        }
+
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (MAP_FAILED == base)
+        {
+            logError(RTPS_PERSISTENCE, "Could not map " << path << ": " << strerror(errno));
+            return nullptr;
+        }
+
+        return std::make_shared<Segment>(path, index, static_cast<octet*>(base), size);
+    }
+
+};
+
+/**
+ * Owner of the payloads of the changes loaded from the logs.
+ *
+ * It keeps the segments of those payloads mapped until they are released, even after the segments are removed
+ * from their logs or the service is destroyed.
+ */
+class MappedLogPersistenceService::MappedPayloadPool : public IPayloadPool
+{
+public:
+
+    /**
+     * Makes the payload of a change point to the data of a record.
+     */
+    void lend(
+            const std::shared_ptr<Segment>& segment,
+            const RecordHeader* header,
+            CacheChange_t& change)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Lent& lent = lent_[segment->base];
+        lent.segment = segment;
+        ++lent.count;
+
+        change.serializedPayload.data =
+                const_cast<octet*>(reinterpret_cast<const octet*>(header)) + sizeof(RecordHeader);
+        change.serializedPayload.length = header->data_size;
+        change.serializedPayload.max_size = header->data_size;
+        change.payload_owner(this);
+    }
+
+    bool get_payload(
+            uint32_t,
+            CacheChange_t&) override
+    {
+        return false;
+    }
+
+    bool get_payload(
+            SerializedPayload_t&,
+            IPayloadPool*&,
+            CacheChange_t&) override
+    {
+        return false;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.payload_owner() == this);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = lent_.upper_bound(cache_change.serializedPayload.data);
+        if (it == lent_.begin())
+        {
+            return false;
+        }
+
+        --it;
+        if (--it->second.count == 0)
+        {
+            lent_.erase(it);
+        }
+
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.serializedPayload.length = 0;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.payload_owner(nullptr);
+
+        if (orphan_ && lent_.empty())
+        {
+            lock.unlock();
+            delete this;
+        }
+        return true;
+    }
+
+    /**
+     * Called when the service is destroyed. The pool will be deleted when the last payload is released.
+     */
+    void orphan()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        orphan_ = true;
+        if (lent_.empty())
+        {
+            lock.unlock();
+            delete this;
+        }
+    }
+
+private:
+
+    struct Lent
+    {
+        std::shared_ptr<Segment> segment;
+        size_t count = 0;
+    };
+
+    std::mutex mutex_;
+
+    //! Segments with lent payloads, by their base address
+    std::map<const octet*, Lent> lent_;
+
+    bool orphan_ = false;
+};
+
+/**
+ * Log of a writer or a reader, made of a list of segments.
+ */
+class MappedLogPersistenceService::SegmentedLog
+{
+public:
+
+    struct Location
+    {
+        Segment* segment;
+        size_t offset;
+    };
+
+    SegmentedLog(
+            const std::string& directory,
+            const std::string& persistence_guid,
+            uint32_t segment_size,
+            bool sync_on_write)
+        : directory_(directory)
+        , segment_size_(segment_size)
+        , sync_on_write_(sync_on_write)
+    {
+        // Only characters allowed on file names are kept
+        for (char c : persistence_guid)
+        {
+            prefix_ += (isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '-') ? c : '_';
+        }
+    }
+
+    /**
+     * Maps the segments of the log found on the directory, and replays their records.
+     */
+    void open()
+    {
+        DIR* dir = opendir(directory_.c_str());
+        if (nullptr == dir)
+        {
+            logError(RTPS_PERSISTENCE, "Could not open directory " << directory_ << ": " << strerror(errno));
+            return;
+        }
+
+        std::vector<uint64_t> indexes;
+        size_t name_length = prefix_.size() + 1 + segment_index_digits + sizeof(segment_extension) - 1;
+        while (struct dirent* entry = readdir(dir))
+        {
+            std::string name(entry->d_name);
+            if (name.size() == name_length && name.compare(0, prefix_.size(), prefix_) == 0 &&
+                    name[prefix_.size()] == '.' &&
+                    name.compare(name_length - sizeof(segment_extension) + 1, std::string::npos,
+                    segment_extension) == 0)
+            {
+                std::string digits = name.substr(prefix_.size() + 1, segment_index_digits);
+                char* end = nullptr;
+                uint64_t index = std::strtoull(digits.c_str(), &end, 16);
+                if (*end == '\0')
+                {
+                    indexes.push_back(index);
+                }
+            }
+        }
+        closedir(dir);
+
+        std::sort(indexes.begin(), indexes.end());
+        for (uint64_t index : indexes)
+        {
+            std::shared_ptr<Segment> segment = Segment::open(path(index), index);
+            if (segment)
+            {
+                segments_[index] = segment;
+                replay(segment.get());
+                active_ = segment.get();
+            }
+        }
+
+        std::vector<Segment*> sealed;
+        for (auto& segment : segments_)
+        {
+            sealed.push_back(segment.second.get());
+        }
+        for (Segment* segment : sealed)
+        {
+            check_segment(segment);
+        }
+    }
+
+    bool add_change(
+            const CacheChange_t& change)
+    {
+        int64_t sn = static_cast<int64_t>(change.sequenceNumber.to64long());
+        if (changes_.find(sn) != changes_.end())
+        {
+            logError(RTPS_PERSISTENCE, "Change " << change.sequenceNumber << " already stored on log " << prefix_);
+            return false;
+        }
+
+        Location location;
+        if (!append(RECORD_CHANGE, sn, change.instanceHandle.value, change.serializedPayload.data,
+                change.serializedPayload.length, &location))
+        {
+            return false;
+        }
+
+        insert_change(sn, location);
+        last_sequence_ = (std::max)(last_sequence_, sn);
+        return true;
+    }
+
+    bool remove_change(
+            const CacheChange_t& change)
+    {
+        int64_t sn = static_cast<int64_t>(change.sequenceNumber.to64long());
+        auto it = changes_.find(sn);
+        if (it == changes_.end())
+        {
+            return true;
+        }
+
+        Segment* segment = it->second.segment;
+        mark_removed(it->second);
+        release_location(it->second);
+        changes_.erase(it);
+        check_segment(segment);
+        return true;
+    }
+
+    bool set_reader_sequence(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number)
+    {
+        int64_t sn = static_cast<int64_t>(seq_number.to64long());
+        auto it = reader_sequences_.find(writer_guid);
+        if (it != reader_sequences_.end() && it->second == sn)
+        {
+            return true;
+        }
+
+        octet guid[16];
+        memcpy(guid, writer_guid.guidPrefix.value, GuidPrefix_t::size);
+        memcpy(guid + GuidPrefix_t::size, writer_guid.entityId.value, EntityId_t::size);
+        if (!append(RECORD_READER_SEQUENCE, sn, guid, nullptr, 0, nullptr))
+        {
+            return false;
+        }
+
+        reader_sequences_[writer_guid] = sn;
+        return true;
+    }
+
+    /**
+     * Fills a list with the stored changes of a writer, on increasing sequence number order.
+     */
+    void load_changes(
+            const GUID_t& writer_guid,
+            std::vector<CacheChange_t*>& changes,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            MappedPayloadPool* mapped_pool,
+            SequenceNumber_t& next_sequence) const
+    {
+        for (const auto& stored : changes_)
+        {
+            CacheChange_t* change = nullptr;
+            if (!change_pool->reserve_cache(change))
+            {
+                continue;
+            }
+
+            const RecordHeader* header = stored.second.segment->record(stored.second.offset);
+            if (nullptr == change->serializedPayload.data && nullptr == change->payload_owner())
+            {
+                mapped_pool->lend(segments_.at(stored.second.segment->index), header, *change);
+            }
+            else
+            {
+                // The pool of the writer provides the memory of the payloads
+                if (!payload_pool->get_payload(header->data_size, *change))
+                {
+                    change_pool->release_cache(change);
+                    continue;
+                }
+
+                change->serializedPayload.length = header->data_size;
+                memcpy(change->serializedPayload.data, header + 1, header->data_size);
+            }
+
+            change->kind = ALIVE;
+            change->writerGUID = writer_guid;
+            memcpy(change->instanceHandle.value, header->guid, sizeof(header->guid));
+            change->sequenceNumber = to_sequence_number(stored.first);
+            changes.push_back(change);
+        }
+
+        if (last_sequence_ > 0)
+        {
+            next_sequence = to_sequence_number(last_sequence_);
+        }
+    }
+
+    void load_reader_sequences(
+            foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t>& seq_map) const
+    {
+        for (const auto& stored : reader_sequences_)
+        {
+            seq_map[stored.first] = to_sequence_number(stored.second);
+        }
+    }
+
+private:
+
+    std::string path(
+            uint64_t index) const
+    {
+        char digits[segment_index_digits + 1];
+        snprintf(digits, sizeof(digits), "%016llx", static_cast<unsigned long long>(index));
+        return directory_ + "/" + prefix_ + "." + digits + segment_extension;
+    }
+
+    void replay(
+            Segment* segment)
+    {
+        size_t offset = sizeof(SegmentHeader);
+        while (offset + sizeof(RecordHeader) <= segment->size)
+        {
+            const RecordHeader* header = segment->record(offset);
+            if (RECORD_NONE == header->kind)
+            {
+                break;
+            }
+
+            if (header->data_size > segment->size - offset - sizeof(RecordHeader) ||
+                    header->crc != record_crc(header))
+            {
+                // Partially written when the process stopped
+                logWarning(RTPS_PERSISTENCE, "Discarding corrupted records at the end of " << segment->path);
+                break;
+            }
+
+            switch (header->kind)
+            {
+                case RECORD_CHANGE:
+                {
+                    last_sequence_ = (std::max)(last_sequence_, header->sequence_number);
+                    if (header->flags & record_flag_removed)
+                    {
+                        break;
+                    }
+
+                    // A change may be found twice when its segment was being compacted
+                    auto it = changes_.find(header->sequence_number);
+                    if (it != changes_.end())
+                    {
+                        mark_removed(it->second);
+                        release_location(it->second);
+                        changes_.erase(it);
+                    }
+                    insert_change(header->sequence_number, Location{segment, offset});
+                    break;
+                }
+                case RECORD_WRITER_SEQUENCE:
+                    last_sequence_ = (std::max)(last_sequence_, header->sequence_number);
+                    break;
+                case RECORD_READER_SEQUENCE:
+                {
+                    GUID_t guid;
+                    memcpy(guid.guidPrefix.value, header->guid, GuidPrefix_t::size);
+                    memcpy(guid.entityId.value, header->guid + GuidPrefix_t::size, EntityId_t::size);
+                    reader_sequences_[guid] = header->sequence_number;
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            offset += record_size(header->data_size);
+        }
+
+        segment->end = offset;
+    }
+
+    bool append(
+            uint32_t kind,
+            int64_t sequence_number,
+            const octet* guid,
+            const octet* data,
+            uint32_t data_size,
+            Location* location)
+    {
+        if (nullptr == active_ || !active_->fits(data_size))
+        {
+            if (!roll(data_size))
+            {
+                return false;
+            }
+        }
+
+        size_t offset = active_->end;
+        write(active_, offset, kind, sequence_number, guid, data, data_size);
+        if (nullptr != location)
+        {
+            location->segment = active_;
+            location->offset = offset;
+        }
+        return true;
+    }
+
+    void write(
+            Segment* segment,
+            size_t offset,
+            uint32_t kind,
+            int64_t sequence_number,
+            const octet* guid,
+            const octet* data,
+            uint32_t data_size)
+    {
+        RecordHeader* header = segment->record(offset);
+        header->flags = 0;
+        header->kind = kind;
+        header->data_size = data_size;
+        header->sequence_number = sequence_number;
+        if (nullptr != guid)
+        {
+            memcpy(header->guid, guid, sizeof(header->guid));
+        }
+        else
+        {
+            memset(header->guid, 0, sizeof(header->guid));
+        }
+        if (data_size > 0)
+        {
+            memcpy(header + 1, data, data_size);
+        }
+        header->crc = record_crc(header);
+
+        size_t size = record_size(data_size);
+        segment->end = offset + size;
+        if (sync_on_write_)
+        {
+            segment->sync(offset, size);
+        }
+    }
+
+    /**
+     * Starts a new segment, big enough for a record.
+     * The new segment begins with the state of the log, so previous segments are only needed for their changes.
+     */
+    bool roll(
+            uint32_t data_size)
+    {
+        size_t needed = sizeof(SegmentHeader) + record_size(0) * (1 + reader_sequences_.size()) +
+                record_size(data_size);
+        uint64_t index = (nullptr == active_) ? 0 : active_->index + 1;
+        std::shared_ptr<Segment> segment =
+                Segment::create(path(index), index, (std::max)(needed, static_cast<size_t>(segment_size_)));
+        if (!segment)
+        {
+            return false;
+        }
+
+        Segment* previous = active_;
+        segments_[index] = segment;
+        active_ = segment.get();
+
+        if (last_sequence_ > 0)
+        {
+            write(active_, active_->end, RECORD_WRITER_SEQUENCE, last_sequence_, nullptr, nullptr, 0);
+        }
+        for (const auto& stored : reader_sequences_)
+        {
+            octet guid[16];
+            memcpy(guid, stored.first.guidPrefix.value, GuidPrefix_t::size);
+            memcpy(guid + GuidPrefix_t::size, stored.first.entityId.value, EntityId_t::size);
+            write(active_, active_->end, RECORD_READER_SEQUENCE, stored.second, guid, nullptr, 0);
+        }
+
+        if (nullptr != previous)
+        {
+            check_segment(previous);
+        }
+        return true;
+    }
+
+    void insert_change(
+            int64_t sequence_number,
+            const Location& location)
+    {
+        changes_[sequence_number] = location;
+        location.segment->live_records++;
+        location.segment->live_bytes += record_size(location.segment->record(location.offset)->data_size);
+    }
+
+    void mark_removed(
+            const Location& location)
+    {
+        RecordHeader* header = location.segment->record(location.offset);
+        header->flags |= record_flag_removed;
+        if (sync_on_write_)
+        {
+            location.segment->sync(location.offset, sizeof(header->flags));
+        }
+    }
+
+    void release_location(
+            const Location& location)
+    {
+        location.segment->live_records--;
+        location.segment->live_bytes -= record_size(location.segment->record(location.offset)->data_size);
+    }
+
+    /**
+     * Removes a sealed segment when none of its changes are stored anymore, and compacts it when few are.
+     */
+    void check_segment(
+            Segment* segment)
+    {
+        if (segment == active_)
+        {
+            return;
+        }
+
+        if (segment->live_records > 0 && segment->live_bytes * compaction_ratio < segment->size)
+        {
+            compact(segment);
+        }
+
+        if (segment->live_records == 0)
+        {
+            unlink(segment->path.c_str());
+            segments_.erase(segment->index);
+        }
+    }
+
+    //! Appends again the changes still stored on a segment.
+    void compact(
+            Segment* segment)
+    {
+        size_t offset = sizeof(SegmentHeader);
+        while (offset < segment->end && segment->live_records > 0)
+        {
+            const RecordHeader* header = segment->record(offset);
+            if (RECORD_CHANGE == header->kind)
+            {
+                auto it = changes_.find(header->sequence_number);
+                if (it != changes_.end() && it->second.segment == segment && it->second.offset == offset)
+                {
+                    Location location;
+                    if (!append(RECORD_CHANGE, header->sequence_number, header->guid,
+                            reinterpret_cast<const octet*>(header + 1), header->data_size, &location))
+                    {
+                        return;
+                    }
+
+                    mark_removed(it->second);
+                    release_location(it->second);
+                    changes_.erase(it);
+                    insert_change(header->sequence_number, location);
+                }
+            }
+
+            offset += record_size(header->data_size);
+        }
+    }
+
+    std::string directory_;
+
+    std::string prefix_;
+
+    uint32_t segment_size_;
+
+    bool sync_on_write_;
+
+    //! Segments by index. Records are appended to the last one.
+    std::map<uint64_t, std::shared_ptr<Segment>> segments_;
+
+    Segment* active_ = nullptr;
+
+    //! Location of the record of each stored change, by sequence number
+    std::map<int64_t, Location> changes_;
+
+    int64_t last_sequence_ = 0;
+
+    std::map<GUID_t, int64_t> reader_sequences_;
+};
+
+IPersistenceService* create_mapped_log_persistence_service(
+        const std::string& directory,
+        uint32_t segment_size,
+        bool sync_on_write)
+{
+    struct stat st;
+    if (stat(directory.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+    {
+        logError(RTPS_PERSISTENCE, "Persistence directory " << directory << " does not exist");
+        return nullptr;
+    }
+
+    return new MappedLogPersistenceService(directory, segment_size, sync_on_write);
+}
+
+MappedLogPersistenceService::MappedLogPersistenceService(
+        const std::string& directory,
+        uint32_t segment_size,
+        bool sync_on_write)
+    : directory_(directory)
+    , segment_size_(segment_size)
+    , sync_on_write_(sync_on_write)
+    , payload_pool_(new MappedPayloadPool())
+{
+}
+
+MappedLogPersistenceService::~MappedLogPersistenceService()
+{
+    logInfo(RTPS_PERSISTENCE, "Closing mapped log persistence on " << directory_);
+
+    logs_.clear();
+    payload_pool_->orphan();
+}
+
+MappedLogPersistenceService::SegmentedLog* MappedLogPersistenceService::get_log(
+        const std::string& persistence_guid)
+{
+    auto it = logs_.find(persistence_guid);
+    if (it == logs_.end())
+    {
+        std::unique_ptr<SegmentedLog> log(
+            new SegmentedLog(directory_, persistence_guid, segment_size_, sync_on_write_));
+        log->open();
+        it = logs_.emplace(persistence_guid, std::move(log)).first;
+    }
+
+    return it->second.get();
+}
+
+bool MappedLogPersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        std::vector<CacheChange_t*>& changes,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        SequenceNumber_t& next_sequence)
+{
+    logInfo(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    get_log(persistence_guid)->load_changes(writer_guid, changes, change_pool, payload_pool, payload_pool_,
+            next_sequence);
+    return true;
+}
+
+bool MappedLogPersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return get_log(persistence_guid)->add_change(change);
+}
+
+bool MappedLogPersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return get_log(persistence_guid)->remove_change(change);
+}
+
+bool MappedLogPersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t>& seq_map)
+{
+    logInfo(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    get_log(reader_guid)->load_reader_sequences(seq_map);
+    return true;
+}
+
+bool MappedLogPersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    logInfo(RTPS_PERSISTENCE,
+            "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return get_log(reader_guid)->set_reader_sequence(writer_guid, seq_number);
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,150 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedLogPersistenceService.h
+ */
+
+#ifndef MAPPEDLOGPERSISTENCESERVICE_H_
+#define MAPPEDLOGPERSISTENCESERVICE_H_
+
+#include <rtps/persistence/PersistenceService.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Create a new persistence service storing data on memory-mapped log files
+ * @param directory Directory where the log files are stored. It should exist.
+ * @param segment_size Size of each file of the logs.
+ * @param sync_on_write Whether each record is synchronized to disk before returning.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+IPersistenceService* create_mapped_log_persistence_service(
+        const std::string& directory,
+        uint32_t segment_size,
+        bool sync_on_write);
+
+/**
+ * Persistence service implementation over append-only memory-mapped log files.
+ *
+ * Each writer or reader stores its data on a log made of fixed-size segment files. Records are appended to the
+ * last segment, and carry a CRC, so a record partially written when the process stopped is discarded when the log
+ * is replayed. Removing a change only sets a flag on its record. Segments whose changes have all been removed are
+ * deleted, and segments with few changes left are compacted by appending those changes again to the last segment.
+ *
+ * Payloads of loaded writer changes point directly to the mapped segments, so restarting does not copy them.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class MappedLogPersistenceService : public IPersistenceService
+{
+public:
+
+    //! Default size of the segment files
+    static constexpr uint32_t default_segment_size = 16u * 1024u * 1024u;
+
+    MappedLogPersistenceService(
+            const std::string& directory,
+            uint32_t segment_size,
+            bool sync_on_write);
+
+    virtual ~MappedLogPersistenceService() override;
+
+    /**
+     * Get all data stored for a writer.
+     * @param writer_guid GUID of the writer to load.
+     * @return True if operation was successful.
+     */
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            std::vector<CacheChange_t*>& changes,
+            const std::shared_ptr<IChangePool>& change_pool,
+            const std::shared_ptr<IPayloadPool>& payload_pool,
+            SequenceNumber_t& next_sequence) final;
+
+    /**
+     * Add a change to storage.
+     * @param change The cache change to add.
+     * @return True if operation was successful.
+     */
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    /**
+     * Remove a change from storage.
+     * @param change The cache change to remove.
+     * @return True if operation was successful.
+     */
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    /**
+     * Get all data stored for a reader.
+     * @param reader_guid GUID of the reader to load.
+     * @return True if operation was successful.
+     */
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    /**
+     * Update the sequence number associated to a writer on a reader.
+     * @param reader_guid GUID of the reader to update.
+     * @param writer_guid GUID of the associated writer to update.
+     * @param seq_number New sequence number value to set for the associated writer.
+     * @return True if operation was successful.
+     */
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+private:
+
+    class Segment;
+    class SegmentedLog;
+    class MappedPayloadPool;
+
+    //! Get the log of an endpoint, replaying it the first time. Should be called with mutex_ taken.
+    SegmentedLog* get_log(
+            const std::string& persistence_guid);
+
+    std::string directory_;
+
+    uint32_t segment_size_;
+
+    bool sync_on_write_;
+
+    std::mutex mutex_;
+
+    std::map<std::string, std::unique_ptr<SegmentedLog>> logs_;
+
+    //! Owner of the payloads of loaded changes. It is released when the last of them is returned.
+    MappedPayloadPool* payload_pool_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* MAPPEDLOGPERSISTENCESERVICE_H_ */
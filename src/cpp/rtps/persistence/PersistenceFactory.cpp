@@ -23,12 +23,44 @@
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #endif // if HAVE_SQLITE3
 
+#ifndef _WIN32
+#include <rtps/persistence/MappedLogPersistenceService.h>
+#endif // ifndef _WIN32
+
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cstdlib>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+#if HAVE_SQLITE3 || !defined(_WIN32)
+static bool get_unsigned_property(
+        const PropertyPolicy& property_policy,
+        const char* name,
+        unsigned long& value)
+{
+    const std::string* str = PropertyPolicyHelper::find_property(property_policy, name);
+    if (nullptr == str)
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    value = std::strtoul(str->c_str(), &end, 10);
+    if (str->empty() || *end != '\0')
+    {
+        logError(RTPS_PERSISTENCE, "Invalid value '" << *str << "' for property " << name);
+        return false;
+    }
+
+    return true;
+}
+
+#endif // if HAVE_SQLITE3 || !defined(_WIN32)
+
 IPersistenceService* PersistenceFactory::create_persistence_service(
         const PropertyPolicy& property_policy)
 {
@@ -53,9 +85,55 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             {
                 update_schema = true;
             }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+
+            SQLite3GroupCommitAttributes group_commit;
+            const std::string* group_commit_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.sqlite3.group_commit");
+            if (group_commit_value != nullptr &&
+                    ((group_commit_value->compare("TRUE") == 0) ||
+                    (group_commit_value->compare("true") == 0)))
+            {
+                group_commit.enabled = true;
+            }
+            unsigned long value = 0;
+            if (get_unsigned_property(property_policy, "dds.persistence.sqlite3.flush_period_ms", value))
+            {
+                group_commit.flush_period = std::chrono::milliseconds(value);
+            }
+            if (get_unsigned_property(property_policy, "dds.persistence.sqlite3.max_queued_operations", value))
+            {
+                group_commit.max_queued_operations = static_cast<size_t>(value);
+            }
+
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, group_commit);
         }
 #endif // if HAVE_SQLITE3
+#ifndef _WIN32
+        if (plugin_property->compare("builtin.MAPPED_LOG") == 0)
+        {
+            const std::string* directory_property = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.mapped_log.directory");
+            const char* directory = (directory_property == nullptr) ?
+                    "." : directory_property->c_str();
+            uint32_t segment_size = MappedLogPersistenceService::default_segment_size;
+            unsigned long value = 0;
+            if (get_unsigned_property(property_policy, "dds.persistence.mapped_log.segment_size", value))
+            {
+                segment_size = static_cast<uint32_t>(value);
+            }
+            bool sync_on_write = false;
+            const std::string* sync_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.mapped_log.sync_on_write");
+            if (sync_value != nullptr &&
+                    ((sync_value->compare("TRUE") == 0) ||
+                    (sync_value->compare("true") == 0)))
+            {
+                sync_on_write = true;
+            }
+
+            ret_val = create_mapped_log_persistence_service(directory, segment_size, sync_on_write);
+        }
+#endif // ifndef _WIN32
     }
 
     return ret_val;
@@ -168,14 +168,16 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        const SQLite3GroupCommitAttributes& group_commit)
 {
     sqlite3* db = open_or_create_database(filename, update_schema);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, group_commit);
 }
 
 SQLite3PersistenceService::SQLite3PersistenceService(
-        sqlite3* db)
+        sqlite3* db,
+        const SQLite3GroupCommitAttributes& group_commit)
     : db_(db)
     , load_writer_stmt_(NULL)
     , add_writer_change_stmt_(NULL)
@@ -184,9 +186,11 @@ SQLite3PersistenceService::SQLite3PersistenceService(
     , update_writer_last_seq_num_stmt_(NULL)
     , load_reader_stmt_(NULL)
     , update_reader_stmt_(NULL)
+    , group_commit_(group_commit)
 {
     // Prepare writer statements
-    sqlite3_prepare_v3(db_, "SELECT seq_num,instance,payload FROM writers_histories WHERE guid=?;", -1,
+    sqlite3_prepare_v3(db_,
+            "SELECT seq_num,instance,payload FROM writers_histories WHERE guid=? ORDER BY seq_num ASC;", -1,
             SQLITE_PREPARE_PERSISTENT,
             &load_writer_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT INTO writers_histories VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
@@ -196,18 +200,49 @@ SQLite3PersistenceService::SQLite3PersistenceService(
 
     sqlite3_prepare_v3(db_, "SELECT last_seq_num FROM writers_states WHERE guid=?;", -1, SQLITE_PREPARE_PERSISTENT,
             &load_writer_last_seq_num_stmt_, NULL);
-    sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO writers_states VALUES(?,?);", -1, SQLITE_PREPARE_PERSISTENT,
-            &update_writer_last_seq_num_stmt_, NULL);
+    // Updating the row in place avoids the foreign key checks on writers_histories done when replacing it
+    sqlite3_prepare_v3(db_,
+            "INSERT INTO writers_states VALUES(?,?) "
+            "ON CONFLICT(guid) DO UPDATE SET last_seq_num=excluded.last_seq_num;",
+            -1, SQLITE_PREPARE_PERSISTENT, &update_writer_last_seq_num_stmt_, NULL);
 
     // Prepare reader statements
     sqlite3_prepare_v3(db_, "SELECT writer_guid_prefix,writer_guid_entity,seq_num FROM readers WHERE guid=?;", -1,
             SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &update_reader_stmt_, NULL);
+
+    if (group_commit_.enabled)
+    {
+        // Batches are appended to the write-ahead log, so readers of the database are not blocked by them
+        if (sqlite3_exec(db_, "PRAGMA journal_mode=WAL;", 0, 0, 0) != SQLITE_OK)
+        {
+            logWarning(RTPS_PERSISTENCE, "Could not enable WAL journal mode on persistence database");
+        }
+
+        if (group_commit_.max_queued_operations == 0)
+        {
+            group_commit_.max_queued_operations = 1;
+        }
+
+        queued_operations_.reserve(group_commit_.max_queued_operations);
+        running_ = true;
+        commit_thread_ = std::thread(&SQLite3PersistenceService::run_commit_thread, this);
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (commit_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            running_ = false;
+        }
+        commit_cv_.notify_one();
+        commit_thread_.join();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
@@ -248,6 +283,9 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    flush();
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -284,7 +322,7 @@ bool SQLite3PersistenceService::load_writer_from_storage(
             change->serializedPayload.length = size;
             memcpy(change->serializedPayload.data, sqlite3_column_blob(load_writer_stmt_, 2), size);
 
-            changes.insert(changes.begin(), change);
+            changes.push_back(change);
         }
 
         sqlite3_reset(load_writer_last_seq_num_stmt_);
@@ -312,28 +350,53 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    if (!group_commit_.enabled)
+    {
+        return store_writer_change(persistence_guid, change.sequenceNumber, change.instanceHandle,
+                       change.serializedPayload.data, change.serializedPayload.length);
+    }
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    wait_for_queue_space(lock);
+    queued_operations_.emplace_back();
+    WriterOperation& operation = queued_operations_.back();
+    operation.is_add = true;
+    operation.persistence_guid = persistence_guid;
+    operation.sequence_number = change.sequenceNumber;
+    operation.instance_handle = change.instanceHandle;
+    operation.payload.assign(change.serializedPayload.data,
+            change.serializedPayload.data + change.serializedPayload.length);
+    return true;
+}
+
+bool SQLite3PersistenceService::store_writer_change(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number,
+        const InstanceHandle_t& instance_handle,
+        const octet* payload,
+        uint32_t payload_length)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         //First add the last seq number, it is needed for the foreign key on writers_histories
         sqlite3_reset(update_writer_last_seq_num_stmt_);
         sqlite3_bind_text(update_writer_last_seq_num_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, sequence_number.to64long());
 
         if (sqlite3_step(update_writer_last_seq_num_stmt_) == SQLITE_DONE)
         {
             sqlite3_reset(add_writer_change_stmt_);
             sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-            if (change.instanceHandle.isDefined())
+            sqlite3_bind_int64(add_writer_change_stmt_, 2, sequence_number.to64long());
+            if (instance_handle.isDefined())
             {
-                sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+                sqlite3_bind_blob(add_writer_change_stmt_, 3, instance_handle.value, 16, SQLITE_STATIC);
             }
             else
             {
                 sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
             }
-            sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data,
-                    change.serializedPayload.length, SQLITE_STATIC);
+            sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
 
             return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
         }
@@ -353,11 +416,30 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
+    if (!group_commit_.enabled)
+    {
+        return delete_writer_change(persistence_guid, change.sequenceNumber);
+    }
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    wait_for_queue_space(lock);
+    queued_operations_.emplace_back();
+    WriterOperation& operation = queued_operations_.back();
+    operation.is_add = false;
+    operation.persistence_guid = persistence_guid;
+    operation.sequence_number = change.sequenceNumber;
+    return true;
+}
+
+bool SQLite3PersistenceService::delete_writer_change(
+        const std::string& persistence_guid,
+        const SequenceNumber_t& sequence_number)
+{
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, sequence_number.to64long());
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
@@ -375,6 +457,9 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    flush();
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -409,6 +494,22 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     logInfo(RTPS_PERSISTENCE,
             "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (!group_commit_.enabled)
+    {
+        return store_writer_seq(reader_guid, writer_guid, seq_number);
+    }
+
+    // Only the last value set before the next commit is stored
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    queued_reader_sequences_[std::make_pair(reader_guid, writer_guid)] = seq_number;
+    return true;
+}
+
+bool SQLite3PersistenceService::store_writer_seq(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
@@ -422,6 +523,126 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     return false;
 }
 
+void SQLite3PersistenceService::flush()
+{
+    if (!group_commit_.enabled)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    if (queued_operations_.empty() && queued_reader_sequences_.empty() && !committing_)
+    {
+        return;
+    }
+
+    flush_requested_ = true;
+    commit_cv_.notify_one();
+    queue_cv_.wait(lock, [this]()
+            {
+                return queued_operations_.empty() && queued_reader_sequences_.empty() && !committing_;
+            });
+}
+
+void SQLite3PersistenceService::wait_for_queue_space(
+        std::unique_lock<std::mutex>& lock)
+{
+    if (queued_operations_.size() >= group_commit_.max_queued_operations)
+    {
+        // A full queue is committed right away
+        flush_requested_ = true;
+        commit_cv_.notify_one();
+        queue_cv_.wait(lock, [this]()
+                {
+                    return queued_operations_.size() < group_commit_.max_queued_operations;
+                });
+    }
+}
+
+void SQLite3PersistenceService::run_commit_thread()
+{
+    std::vector<WriterOperation> operations;
+    operations.reserve(group_commit_.max_queued_operations);
+    ReaderSequences reader_sequences;
+
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (running_ || !queued_operations_.empty() || !queued_reader_sequences_.empty())
+    {
+        if (running_ && !flush_requested_)
+        {
+            commit_cv_.wait_for(lock, group_commit_.flush_period, [this]()
+                    {
+                        return !running_ || flush_requested_;
+                    });
+        }
+
+        flush_requested_ = false;
+        if (queued_operations_.empty() && queued_reader_sequences_.empty())
+        {
+            continue;
+        }
+
+        // Callers can keep queueing operations while the batch is being committed
+        operations.swap(queued_operations_);
+        reader_sequences.swap(queued_reader_sequences_);
+        committing_ = true;
+        queue_cv_.notify_all();
+        lock.unlock();
+
+        commit(operations, reader_sequences);
+        operations.clear();
+        reader_sequences.clear();
+
+        lock.lock();
+        committing_ = false;
+        queue_cv_.notify_all();
+    }
+}
+
+void SQLite3PersistenceService::commit(
+        const std::vector<WriterOperation>& operations,
+        const ReaderSequences& reader_sequences)
+{
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+
+    bool in_transaction = sqlite3_exec(db_, "BEGIN;", 0, 0, 0) == SQLITE_OK;
+    if (!in_transaction)
+    {
+        logWarning(RTPS_PERSISTENCE, "Could not begin transaction. Operations will be committed one by one");
+    }
+
+    for (const WriterOperation& operation : operations)
+    {
+        bool ret = operation.is_add ?
+                store_writer_change(operation.persistence_guid, operation.sequence_number,
+                operation.instance_handle, operation.payload.data(),
+                static_cast<uint32_t>(operation.payload.size())) :
+                delete_writer_change(operation.persistence_guid, operation.sequence_number);
+        if (!ret)
+        {
+            logError(RTPS_PERSISTENCE, "Writer " << operation.persistence_guid << " could not "
+                                                 << (operation.is_add ? "store" : "remove")
+                                                 << " change for seq " << operation.sequence_number);
+        }
+    }
+
+    for (const auto& reader_sequence : reader_sequences)
+    {
+        if (!store_writer_seq(reader_sequence.first.first, reader_sequence.first.second, reader_sequence.second))
+        {
+            logError(RTPS_PERSISTENCE, "Reader " << reader_sequence.first.first << " could not set seq for writer "
+                                                 << reader_sequence.first.second);
+        }
+    }
+
+    if (in_transaction && sqlite3_exec(db_, "COMMIT;", 0, 0, 0) != SQLITE_OK)
+    {
+        logError(RTPS_PERSISTENCE, "Could not commit " << operations.size() << " writer operations and "
+                                                       << reader_sequences.size() << " reader updates");
+        sqlite3_exec(db_, "ROLLBACK;", 0, 0, 0);
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
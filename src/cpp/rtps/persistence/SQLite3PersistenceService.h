@@ -22,17 +22,46 @@
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/persistence/sqlite3.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Configuration of the group commit mode of the SQLite3 persistence service.
+ *
+ * When enabled, changes are stored by a background thread, which commits them in batched transactions over a
+ * database in WAL journal mode. Callers are only blocked when the queue of pending operations is full.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+struct SQLite3GroupCommitAttributes
+{
+    //! Whether the group commit mode is used
+    bool enabled = false;
+
+    //! Maximum time an operation waits on the queue before being committed
+    std::chrono::milliseconds flush_period = std::chrono::milliseconds(50);
+
+    //! Maximum number of writer operations waiting to be committed
+    size_t max_queued_operations = 1024;
+};
+
 /**
  * Create a new SQLite3 implementation of persistence service
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        const SQLite3GroupCommitAttributes& group_commit = SQLite3GroupCommitAttributes());
 
 
 /**
@@ -44,7 +73,8 @@ class SQLite3PersistenceService : public IPersistenceService
 public:
 
     SQLite3PersistenceService(
-            sqlite3* db);
+            sqlite3* db,
+            const SQLite3GroupCommitAttributes& group_commit = SQLite3GroupCommitAttributes());
     virtual ~SQLite3PersistenceService() override;
 
     /**
@@ -99,10 +129,57 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) final;
 
+    /**
+     * Wait until all the queued operations have been committed.
+     * Does nothing when the group commit mode is not enabled.
+     */
+    void flush();
+
 private:
 
+    //! Writer operation waiting to be committed
+    struct WriterOperation
+    {
+        bool is_add;
+        std::string persistence_guid;
+        SequenceNumber_t sequence_number;
+        InstanceHandle_t instance_handle;
+        std::vector<octet> payload;
+    };
+
+    using ReaderSequences = std::map<std::pair<std::string, GUID_t>, SequenceNumber_t>;
+
+    bool store_writer_change(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number,
+            const InstanceHandle_t& instance_handle,
+            const octet* payload,
+            uint32_t payload_length);
+
+    bool delete_writer_change(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number);
+
+    bool store_writer_seq(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number);
+
+    //! Waits for room on the queue. Should be called with queue_mutex_ taken.
+    void wait_for_queue_space(
+            std::unique_lock<std::mutex>& lock);
+
+    void run_commit_thread();
+
+    void commit(
+            const std::vector<WriterOperation>& operations,
+            const ReaderSequences& reader_sequences);
+
     sqlite3* db_;
 
+    //! Protects the use of the database connection between the commit thread and the callers
+    std::mutex db_mutex_;
+
     sqlite3_stmt* load_writer_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
@@ -112,6 +189,30 @@ private:
 
     sqlite3_stmt* load_reader_stmt_;
     sqlite3_stmt* update_reader_stmt_;
+
+    SQLite3GroupCommitAttributes group_commit_;
+
+    //! Protects the queued operations and the state of the commit thread
+    std::mutex queue_mutex_;
+
+    //! Notified to wake up the commit thread
+    std::condition_variable commit_cv_;
+
+    //! Notified by the commit thread when it takes the queued operations and when it finishes a commit
+    std::condition_variable queue_cv_;
+
+    std::vector<WriterOperation> queued_operations_;
+
+    //! Last sequence number set for each pair of reader and writer, so repeated updates are coalesced
+    ReaderSequences queued_reader_sequences_;
+
+    bool committing_ = false;
+
+    bool flush_requested_ = false;
+
+    bool running_ = false;
+
+    std::thread commit_thread_;
 };
 
 } /* namespace rtps */
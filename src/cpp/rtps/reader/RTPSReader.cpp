@@ -25,6 +25,8 @@
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
 
+#include <rtps/DataSharing/DataSharingListener.hpp>
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -114,6 +116,16 @@ void RTPSReader::init(
     mp_history->mp_reader = this;
     mp_history->mp_mutex = &mp_mutex;
 
+    if (DataSharingPayloadPool::is_enabled(m_att.properties))
+    {
+        datasharing_listener_.reset(new DataSharingListener(this));
+        if (!datasharing_listener_->start())
+        {
+            logWarning(RTPS_READER, "Could not enable data-sharing on reader " << m_guid);
+            datasharing_listener_.reset();
+        }
+    }
+
     logInfo(RTPS_READER, "RTPSReader created correctly");
 }
 
@@ -171,6 +183,59 @@ void RTPSReader::releaseCache(
     change_pool_->release_cache(change);
 }
 
+bool RTPSReader::is_datasharing_compatible() const
+{
+    return static_cast<bool>(datasharing_listener_);
+}
+
+bool RTPSReader::is_datasharing_compatible_with(
+        const WriterProxyData& wdata) const
+{
+    return datasharing_listener_ &&
+           m_guid.is_on_same_host_as(wdata.guid()) &&
+           !m_guid.is_on_same_process_as(wdata.guid()) &&
+           DataSharingPayloadPool::is_enabled(wdata.properties());
+}
+
+bool RTPSReader::is_sample_valid(
+        const CacheChange_t* change) const
+{
+    if (datasharing_listener_ && change->payload_owner() != payload_pool_.get())
+    {
+        const DataSharingPayloadPool* pool = dynamic_cast<const DataSharingPayloadPool*>(change->payload_owner());
+        return pool == nullptr || pool->is_sample_valid(*change);
+    }
+
+    return true;
+}
+
+IPayloadPool* RTPSReader::payload_pool_for(
+        IPayloadPool* payload_owner) const
+{
+    if (datasharing_listener_ && datasharing_listener_->is_delivering(payload_owner))
+    {
+        return payload_owner;
+    }
+
+    return payload_pool_.get();
+}
+
+void RTPSReader::enableMessagesFromUnkownWriters(
+        bool enable)
+{
+    m_acceptMessagesFromUnkownWriters = enable;
+    mp_RTPSParticipant->set_reader_accepts_unmatched_writers(m_guid,
+            m_acceptMessagesFromUnkownWriters || m_trustedWriterEntityId != c_EntityId_Unknown);
+}
+
+void RTPSReader::setTrustedWriter(
+        const EntityId_t& writer)
+{
+    m_acceptMessagesFromUnkownWriters = false;
+    m_trustedWriterEntityId = writer;
+    mp_RTPSParticipant->set_reader_accepts_unmatched_writers(m_guid, m_trustedWriterEntityId != c_EntityId_Unknown);
+}
+
 ReaderListener* RTPSReader::getListener() const
 {
     return mp_listener;
@@ -311,6 +376,21 @@ bool RTPSReader::wait_for_unread_cache(
     return false;
 }
 
+void RTPSReader::end_sample_access_nts(
+        CacheChange_t* change,
+        WriterProxy*& /*wp*/,
+        bool mark_as_read)
+{
+    if (mark_as_read && !change->isRead)
+    {
+        change->isRead = true;
+        if (0 < total_unread_)
+        {
+            --total_unread_;
+        }
+    }
+}
+
 uint64_t RTPSReader::get_unread_count() const
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/reader/WriterProxy.h>
 #include <fastrtps/utils/TimeConversion.h>
@@ -46,6 +47,12 @@ StatefulReader::~StatefulReader()
 {
     logInfo(RTPS_READER, "StatefulReader destructor.");
 
+    // Data-sharing reception uses this object, so it should be stopped first
+    if (datasharing_listener_)
+    {
+        datasharing_listener_->stop();
+    }
+
     // Only is_alive_ assignment needs to be protected, as
     // matched_writers_ and matched_writers_pool_ are only used
     // when is_alive_ is true
@@ -201,9 +208,10 @@ bool StatefulReader::matched_writer_add(
     add_persistence_guid(wdata.guid(), wdata.persistence_guid());
     initial_sequence = get_last_notified(wdata.guid());
 
-    wp->start(wdata, initial_sequence);
+    wp->start(wdata, initial_sequence, is_datasharing_compatible_with(wdata));
 
     matched_writers_.push_back(wp);
+    mp_RTPSParticipant->add_matched_reader(m_guid, wdata.guid());
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -221,6 +229,15 @@ bool StatefulReader::matched_writer_add(
         }
     }
 
+    if (is_datasharing_compatible_with(wdata))
+    {
+        if (!datasharing_listener_->add_datasharing_writer(wdata.guid(),
+                m_att.durabilityKind == VOLATILE))
+        {
+            logError(RTPS_READER, "Could not open data-sharing pool of writer " << wdata.guid());
+        }
+    }
+
     logInfo(RTPS_READER, "Writer Proxy " << wp->guid() << " added to " << m_guid.entityId);
     return true;
 }
@@ -263,7 +280,12 @@ bool StatefulReader::matched_writer_remove(
 
                 wproxy = *it;
                 matched_writers_.erase(it);
+                mp_RTPSParticipant->remove_matched_reader(m_guid, writer_guid);
                 remove_persistence_guid(wproxy->guid(), wproxy->persistence_guid(), removed_by_lease);
+                if (datasharing_listener_)
+                {
+                    datasharing_listener_->remove_datasharing_writer(writer_guid);
+                }
                 break;
             }
         }
@@ -362,10 +384,21 @@ bool StatefulReader::processDataMsg(
             auto wlp = this->mp_RTPSParticipant->wlp();
             if (wlp != nullptr)
             {
-                wlp->sub_liveliness_manager_->assert_liveliness(
-                    change->writerGUID,
-                    liveliness_kind_,
-                    liveliness_lease_duration_);
+                if (pWP != nullptr)
+                {
+                    wlp->sub_liveliness_manager_->assert_liveliness(
+                        change->writerGUID,
+                        liveliness_kind_,
+                        liveliness_lease_duration_,
+                        pWP->liveliness_assertion());
+                }
+                else
+                {
+                    wlp->sub_liveliness_manager_->assert_liveliness(
+                        change->writerGUID,
+                        liveliness_kind_,
+                        liveliness_lease_duration_);
+                }
             }
             else
             {
@@ -392,7 +425,8 @@ bool StatefulReader::processDataMsg(
 
             // Ask payload pool to copy the payload
             IPayloadPool* payload_owner = change->payload_owner();
-            if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
+            IPayloadPool* payload_pool = payload_pool_for(payload_owner);
+            if (payload_pool->get_payload(change->serializedPayload, payload_owner, *change_to_add))
             {
                 change->payload_owner(payload_owner);
             }
@@ -410,7 +444,7 @@ bool StatefulReader::processDataMsg(
             if (!change_received(change_to_add, pWP))
             {
                 logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
-                payload_pool_->release_payload(*change_to_add);
+                payload_pool->release_payload(*change_to_add);
                 change_pool_->release_cache(change_to_add);
             }
         }
@@ -447,7 +481,8 @@ bool StatefulReader::processDataFragMsg(
                 wlp->sub_liveliness_manager_->assert_liveliness(
                     incomingChange->writerGUID,
                     liveliness_kind_,
-                    liveliness_lease_duration_);
+                    liveliness_lease_duration_,
+                    pWP->liveliness_assertion());
             }
             else
             {
@@ -556,7 +591,8 @@ bool StatefulReader::processHeartbeatMsg(
                             wlp->sub_liveliness_manager_->assert_liveliness(
                                 writerGUID,
                                 liveliness_kind_,
-                                liveliness_lease_duration_);
+                                liveliness_lease_duration_,
+                                writer->liveliness_assertion());
                         }
                         else
                         {
@@ -690,6 +726,16 @@ bool StatefulReader::change_removed_by_history(
 
 
                 wp->change_removed_from_history(a_change->sequenceNumber);
+
+                // The writer may reuse the payload of a data-sharing change once it is acknowledged
+                if (wp->is_datasharing_writer())
+                {
+                    SequenceNumber_t base = datasharing_acknack_base_nts(wp);
+                    if (base > a_change->sequenceNumber)
+                    {
+                        send_acknack(wp, SequenceNumberSet_t(base), *wp, true);
+                    }
+                }
             }
             return true;
         }
@@ -828,7 +874,7 @@ bool StatefulReader::nextUntakenCache(
 
     std::vector<CacheChange_t*> toremove;
     bool takeok = false;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (ReaderHistory::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         WriterProxy* wp;
@@ -889,7 +935,7 @@ bool StatefulReader::nextUnreadCache(
 
     std::vector<CacheChange_t*> toremove;
     bool readok = false;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (ReaderHistory::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         if ((*it)->isRead)
@@ -940,6 +986,24 @@ bool StatefulReader::nextUnreadCache(
     return readok;
 }
 
+bool StatefulReader::begin_sample_access_nts(
+        CacheChange_t* change,
+        WriterProxy*& wp,
+        bool& is_future_change)
+{
+    is_future_change = false;
+
+    if (matched_writer_lookup(change->writerGUID, &wp))
+    {
+        SequenceNumber_t seq = wp->available_changes_max();
+        is_future_change = seq < change->sequenceNumber;
+        return true;
+    }
+
+    wp = nullptr;
+    return false;
+}
+
 bool StatefulReader::updateTimes(
         const ReaderTimes& ti)
 {
@@ -1039,7 +1103,8 @@ void StatefulReader::send_acknack(
         if (!missing_changes.empty() || !heartbeat_was_final)
         {
             GUID_t guid = sender.remote_guids().at(0);
-            SequenceNumberSet_t sns(writer->available_changes_max() + 1);
+            SequenceNumberSet_t sns(writer->is_datasharing_writer() ?
+                    datasharing_acknack_base_nts(writer) : writer->available_changes_max() + 1);
             History::const_iterator history_iterator = mp_history->changesBegin();
 
             missing_changes.for_each(
@@ -1087,11 +1152,27 @@ void StatefulReader::send_acknack(
     }
 }
 
+SequenceNumber_t StatefulReader::datasharing_acknack_base_nts(
+        const WriterProxy* wp) const
+{
+    SequenceNumber_t base = wp->available_changes_max() + 1;
+    for (auto it = mp_history->changesBegin(); it != mp_history->changesEnd(); ++it)
+    {
+        if ((*it)->writerGUID == wp->guid() && (*it)->sequenceNumber < base)
+        {
+            base = (*it)->sequenceNumber;
+        }
+    }
+
+    return base;
+}
+
 bool StatefulReader::send_sync_nts(
-        CDRMessage_t* message,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         const Locators& locators_begin,
         const Locators& locators_end,
         std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
-    return mp_RTPSParticipant->sendSync(message, locators_begin, locators_end, max_blocking_time_point);
+    return mp_RTPSParticipant->sendSync(buffers, total_bytes, locators_begin, locators_end, max_blocking_time_point);
 }
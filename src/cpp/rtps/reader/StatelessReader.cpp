@@ -25,6 +25,7 @@
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 #include <fastdds/rtps/writer/LivelinessManager.h>
+#include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <mutex>
@@ -39,6 +40,12 @@ using namespace eprosima::fastrtps::rtps;
 StatelessReader::~StatelessReader()
 {
     logInfo(RTPS_READER, "Removing reader " << m_guid);
+
+    // Data-sharing reception uses this object, so it should be stopped first
+    if (datasharing_listener_)
+    {
+        datasharing_listener_->stop();
+    }
 }
 
 StatelessReader::StatelessReader(
@@ -99,7 +106,8 @@ bool StatelessReader::matched_writer_add(
     {
         add_persistence_guid(info.guid, info.persistence_guid);
 
-        m_acceptMessagesFromUnkownWriters = false;
+        enableMessagesFromUnkownWriters(false);
+        mp_RTPSParticipant->add_matched_reader(m_guid, info.guid);
         logInfo(RTPS_READER, "Writer " << info.guid << " added to reader " << m_guid);
 
         if (liveliness_lease_duration_ < c_TimeInfinite)
@@ -118,6 +126,15 @@ bool StatelessReader::matched_writer_add(
             }
         }
 
+        if (is_datasharing_compatible_with(wdata))
+        {
+            if (!datasharing_listener_->add_datasharing_writer(wdata.guid(),
+                    m_att.durabilityKind == VOLATILE))
+            {
+                logError(RTPS_READER, "Could not open data-sharing pool of writer " << wdata.guid());
+            }
+        }
+
         return true;
     }
 
@@ -157,6 +174,11 @@ bool StatelessReader::matched_writer_remove(
 
             remove_persistence_guid(it->guid, it->persistence_guid, removed_by_lease);
             matched_writers_.erase(it);
+            mp_RTPSParticipant->remove_matched_reader(m_guid, writer_guid);
+            if (datasharing_listener_)
+            {
+                datasharing_listener_->remove_datasharing_writer(writer_guid);
+            }
 
             return true;
         }
@@ -231,7 +253,7 @@ bool StatelessReader::nextUnreadCache(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     bool found = false;
-    std::vector<CacheChange_t*>::iterator it;
+    ReaderHistory::iterator it;
 
     for (it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
@@ -259,6 +281,16 @@ bool StatelessReader::nextUnreadCache(
     return false;
 }
 
+bool StatelessReader::begin_sample_access_nts(
+        CacheChange_t* /*change*/,
+        WriterProxy*& wp,
+        bool& is_future_change)
+{
+    wp = nullptr;
+    is_future_change = false;
+    return true;
+}
+
 bool StatelessReader::change_removed_by_history(
         CacheChange_t* ch,
         WriterProxy* /*prox*/)
@@ -300,7 +332,8 @@ bool StatelessReader::processDataMsg(
 
         // Ask payload pool to copy the payload
         IPayloadPool* payload_owner = change->payload_owner();
-        if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
+        IPayloadPool* payload_pool = payload_pool_for(payload_owner);
+        if (payload_pool->get_payload(change->serializedPayload, payload_owner, *change_to_add))
         {
             change->payload_owner(payload_owner);
         }
@@ -318,7 +351,7 @@ bool StatelessReader::processDataMsg(
         if (!change_received(change_to_add))
         {
             logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
-            payload_pool_->release_payload(*change_to_add);
+            payload_pool->release_payload(*change_to_add);
             change_pool_->release_cache(change_to_add);
         }
     }
@@ -492,6 +525,19 @@ void StatelessReader::assert_writer_liveliness(
         auto wlp = mp_RTPSParticipant->wlp();
         if (wlp != nullptr)
         {
+            for (RemoteWriterInfo_t& writer : matched_writers_)
+            {
+                if (writer.guid == guid)
+                {
+                    wlp->sub_liveliness_manager_->assert_liveliness(
+                        guid,
+                        liveliness_kind_,
+                        liveliness_lease_duration_,
+                        writer.liveliness_assertion);
+                    return;
+                }
+            }
+
             wlp->sub_liveliness_manager_->assert_liveliness(
                 guid,
                 liveliness_kind_,
@@ -84,6 +84,7 @@ WriterProxy::WriterProxy(
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , guid_prefix_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , is_on_same_process_(false)
+    , is_datasharing_writer_(false)
     , ownership_strength_(0)
     , liveliness_kind_(AUTOMATIC_LIVELINESS_QOS)
     , locators_entry_(loc_alloc.max_unicast_locators, loc_alloc.max_multicast_locators)
@@ -110,7 +111,8 @@ WriterProxy::WriterProxy(
 
 void WriterProxy::start(
         const WriterProxyData& attributes,
-        const SequenceNumber_t& initial_sequence)
+        const SequenceNumber_t& initial_sequence,
+        bool is_datasharing)
 {
 #ifdef SHOULD_DEBUG_LINUX
     assert(get_mutex_owner() == get_thread_id());
@@ -125,6 +127,7 @@ void WriterProxy::start(
     persistence_guid_ = attributes.persistence_guid();
     is_alive_ = true;
     is_on_same_process_ = RTPSDomainImpl::should_intraprocess_between(reader_->getGuid(), attributes.guid());
+    is_datasharing_writer_ = is_datasharing;
     ownership_strength_ = attributes.m_qos.m_ownershipStrength.value;
     liveliness_kind_ = attributes.m_qos.m_liveliness.kind;
     locators_entry_.unicast = attributes.remote_locators().unicast;
@@ -167,6 +170,8 @@ void WriterProxy::clear()
     guid_prefix_as_vector_.clear();
     changes_received_.clear();
     is_on_same_process_ = false;
+    is_datasharing_writer_ = false;
+    liveliness_assertion_.reset();
     loaded_from_storage(SequenceNumber_t());
 }
 
@@ -569,7 +574,8 @@ void WriterProxy::update_heartbeat_response_interval(
 }
 
 bool WriterProxy::send(
-        CDRMessage_t* message,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     if (is_on_same_process_)
@@ -579,7 +585,7 @@ bool WriterProxy::send(
 
     const ResourceLimitedVector<Locator_t>& remote_locators = remote_locators_shrinked();
 
-    return reader_->send_sync_nts(message,
+    return reader_->send_sync_nts(buffers, total_bytes,
                    Locators(remote_locators.begin()),
                    Locators(remote_locators.end()),
                    max_blocking_time_point);
@@ -33,6 +33,7 @@
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <memory>
 #include <set>
 
 // Testing purpose
@@ -48,6 +49,7 @@ class RTPSParticipantImpl;
 class StatefulReader;
 class RTPSMessageGroup_t;
 class TimedEvent;
+struct LivelinessAssertion;
 
 /**
  * Class WriterProxy that contains the state of each matched writer for a specific reader.
@@ -75,10 +77,12 @@ public:
      * Activate this proxy associating it to a remote writer.
      * @param attributes WriterProxyData of the writer for which to keep state.
      * @param initial_sequence Sequence number of last acknowledged change.
+     * @param is_datasharing Whether the changes of the writer are received through data-sharing.
      */
     void start(
             const WriterProxyData& attributes,
-            const SequenceNumber_t& initial_sequence);
+            const SequenceNumber_t& initial_sequence,
+            bool is_datasharing = false);
 
     /**
      * Update information on the remote writer.
@@ -177,6 +181,15 @@ public:
         return liveliness_kind_;
     }
 
+    /**
+     * Get the assertion used to assert the liveliness of the writer represented by this proxy without locking.
+     * @return reference to the assertion, filled by the liveliness manager on the first assertion.
+     */
+    inline std::shared_ptr<LivelinessAssertion>& liveliness_assertion()
+    {
+        return liveliness_assertion_;
+    }
+
     /**
      * Get the ownership strength of the writer represented by this proxy.
      * @return ownership strength of the writer represented by this proxy.
@@ -309,11 +322,13 @@ public:
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices with the message already serialized.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     virtual bool send(
-            CDRMessage_t* message,
+            const NetworkBuffers& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
     bool is_on_same_process() const
@@ -321,6 +336,17 @@ public:
         return is_on_same_process_;
     }
 
+    /**
+     * Check if the changes of the writer are received through data-sharing.
+     * The payloads of those changes are referenced in place on the writer's pool, so they are only acknowledged
+     * once the reader has removed them from its history.
+     * @return true if the writer is a data-sharing writer.
+     */
+    bool is_datasharing_writer() const
+    {
+        return is_datasharing_writer_;
+    }
+
 private:
 
     /**
@@ -370,10 +396,14 @@ private:
     ResourceLimitedVector<GuidPrefix_t> guid_prefix_as_vector_;
     //! Is the writer on the same process
     bool is_on_same_process_;
+    //! Are the changes of the writer received through data-sharing
+    bool is_datasharing_writer_;
     //! Taken from QoS
     uint32_t ownership_strength_;
     //! Taken from QoS
     LivelinessQosPolicyKind liveliness_kind_;
+    //! Cached by the liveliness manager of the reader
+    std::shared_ptr<LivelinessAssertion> liveliness_assertion_;
     //! Taken from proxy data
     GUID_t persistence_guid_;
     //! Taken from proxy data
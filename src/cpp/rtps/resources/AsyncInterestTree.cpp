@@ -22,7 +22,7 @@ using namespace eprosima::fastrtps::rtps;
 bool AsyncInterestTree::register_interest(
         RTPSWriter* writer)
 {
-    std::unique_lock<std::timed_mutex> guard(mMutexHidden);
+    std::unique_lock<std::timed_mutex> guard(mutex_);
     return register_interest_nts(writer);
 }
 
@@ -31,9 +31,9 @@ bool AsyncInterestTree::register_interest(
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
 {
     bool ret_value = false;
-    std::unique_lock<std::timed_mutex> guard(mMutexHidden, std::defer_lock);
+    std::unique_lock<std::timed_mutex> guard(mutex_, std::defer_lock);
 
-    if(guard.try_lock_until(max_blocking_time))
+    if (guard.try_lock_until(max_blocking_time))
     {
         ret_value = register_interest_nts(writer);
     }
@@ -44,27 +44,25 @@ bool AsyncInterestTree::register_interest(
 bool AsyncInterestTree::register_interest_nts(
         RTPSWriter* writer)
 {
-    RTPSWriter *curr = hidden_front_, *prev = nullptr;
-
-    while (curr)
+    if (writer->async_queued_)
     {
-        if (writer == curr)
-        {
-            return false;
-        }
-
-        prev = curr;
-        curr = curr->next_[hidden_pos_];
+        return false;
     }
 
-    if (!prev)
+    WriterList& list = lists_[writer->async_priority_];
+    writer->async_queued_ = true;
+    writer->async_next_ = nullptr;
+    writer->async_prev_ = list.back;
+    if (list.back)
     {
-        hidden_front_ = writer;
+        list.back->async_next_ = writer;
     }
     else
     {
-        prev->next_[hidden_pos_] = writer;
+        list.front = writer;
     }
+    list.back = writer;
+    ++queued_;
 
     return true;
 }
@@ -72,81 +70,66 @@ bool AsyncInterestTree::register_interest_nts(
 bool AsyncInterestTree::unregister_interest(
         RTPSWriter* writer)
 {
-    std::unique_lock<std::timed_mutex> activeGuard(mMutexActive);
-    std::unique_lock<std::timed_mutex> hiddenGuard(mMutexHidden);
-
-    RTPSWriter *curr = active_front_, *prev = nullptr;
+    std::unique_lock<std::timed_mutex> guard(mutex_);
 
-    while (curr)
+    if (writer->async_queued_)
     {
-        if (curr == writer)
+        WriterList& list = lists_[writer->async_priority_];
+        if (writer->async_prev_)
         {
-            if (prev)
-            {
-                prev->next_[active_pos_] = curr->next_[active_pos_];
-            }
-            else
-            {
-                active_front_ = curr->next_[active_pos_];
-            }
-
-            curr->next_[active_pos_] = nullptr;
-            break;
+            writer->async_prev_->async_next_ = writer->async_next_;
         }
         else
         {
-            prev = curr;
-            curr = curr->next_[active_pos_];
+            list.front = writer->async_next_;
         }
-    }
-
-    curr = hidden_front_;
-    prev = nullptr;
 
-    while (curr)
-    {
-        if (curr == writer)
+        if (writer->async_next_)
         {
-            if (prev)
-            {
-                prev->next_[hidden_pos_] = curr->next_[hidden_pos_];
-            }
-            else
-            {
-                hidden_front_ = curr->next_[hidden_pos_];
-            }
-
-            curr->next_[hidden_pos_] = nullptr;
-            break;
+            writer->async_next_->async_prev_ = writer->async_prev_;
         }
         else
         {
-            prev = curr;
-            curr = curr->next_[hidden_pos_];
+            list.back = writer->async_prev_;
         }
+
+        writer->async_next_ = nullptr;
+        writer->async_prev_ = nullptr;
+        writer->async_queued_ = false;
+        --queued_;
     }
 
-    return (active_front_ == nullptr && hidden_front_ == nullptr);
+    return 0 == queued_;
 }
 
-void AsyncInterestTree::swap()
+void AsyncInterestTree::take_all(
+        std::vector<RTPSWriter*>& writers)
 {
-    std::unique_lock<std::timed_mutex> activeGuard(mMutexActive);
-    std::unique_lock<std::timed_mutex> hiddenGuard(mMutexHidden);
+    writers.clear();
 
-    active_front_ = hidden_front_;
-    hidden_front_ = nullptr;
-    active_pos_ = (active_pos_ + 1) & 0x1;
-    hidden_pos_ = (hidden_pos_ + 1) & 0x1;
-}
+    std::unique_lock<std::timed_mutex> guard(mutex_);
 
-RTPSWriter* AsyncInterestTree::next_active_nts()
-{
-    RTPSWriter* ret_writer = active_front_;
-    if (active_front_)
+    if (0 == queued_)
+    {
+        return;
+    }
+
+    for (auto& entry : lists_)
     {
-        active_front_ = active_front_->next_[active_pos_];
-        ret_writer->next_[active_pos_] = nullptr;
+        WriterList& list = entry.second;
+        RTPSWriter* writer = list.front;
+        while (writer)
+        {
+            RTPSWriter* next = writer->async_next_;
+            writer->async_next_ = nullptr;
+            writer->async_prev_ = nullptr;
+            writer->async_queued_ = false;
+            writers.push_back(writer);
+            writer = next;
+        }
+        list.front = nullptr;
+        list.back = nullptr;
     }
-    return ret_writer;
+
+    queued_ = 0;
 }
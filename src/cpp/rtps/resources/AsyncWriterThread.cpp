@@ -14,71 +14,174 @@
 
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/dds/log/Log.hpp>
 
 #include <mutex>
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <stdexcept>
 
 using namespace eprosima::fastrtps::rtps;
 
+//! Upper limit for the number of threads of the pool
+static constexpr uint32_t max_number_of_threads = 64;
+
+/*!
+ * @brief Reads an integer property.
+ * @return false if the property is not present or its value is not a valid integer.
+ */
+static bool get_int_property(
+        const PropertyPolicy& properties,
+        const char* name,
+        long& value)
+{
+    const std::string* str = PropertyPolicyHelper::find_property(properties, name);
+    if (nullptr == str)
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    value = std::strtol(str->c_str(), &end, 10);
+    if (str->empty() || *end != '\0')
+    {
+        logError(RTPS_WRITER, "Invalid value '" << *str << "' for property " << name);
+        return false;
+    }
+
+    return true;
+}
+
+AsyncWriterThread::AsyncWriterThread()
+    : next_thread_index_(0)
+{
+    workers_.emplace_back(new Worker());
+}
+
 AsyncWriterThread::~AsyncWriterThread()
 {
-    std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-    running_ = false;
-    run_scheduled_ = false;
-    cv_.notify_all();
-    if (thread_)
+    for (auto& worker : workers_)
     {
-        lock.unlock();
-        thread_->join();
-        lock.lock();
-        delete thread_;
-        thread_ = nullptr;
+        std::unique_lock<RecursiveTimedMutex> lock(worker->condition_variable_mutex);
+        worker->running = false;
+        worker->run_scheduled = false;
+        worker->cv.notify_all();
+        if (worker->thread)
+        {
+            lock.unlock();
+            worker->thread->join();
+            lock.lock();
+            delete worker->thread;
+            worker->thread = nullptr;
+        }
     }
 }
 
+void AsyncWriterThread::init(
+        const PropertyPolicy& participant_properties)
+{
+    long number_of_threads = 1;
+    if (get_int_property(participant_properties, threads_property_name(), number_of_threads))
+    {
+        if (number_of_threads < 1 || number_of_threads > static_cast<long>(max_number_of_threads))
+        {
+            logError(RTPS_PARTICIPANT, "Number of asynchronous writer threads should be between 1 and "
+                    << max_number_of_threads << ". Using 1 thread.");
+            number_of_threads = 1;
+        }
+    }
+
+    while (workers_.size() < static_cast<size_t>(number_of_threads))
+    {
+        workers_.emplace_back(new Worker());
+    }
+}
+
+void AsyncWriterThread::register_writer(
+        RTPSWriter* writer,
+        bool uses_participant_flow_controllers)
+{
+    const PropertyPolicy& properties = writer->getAttributes().properties;
+    uint32_t number_of_threads = static_cast<uint32_t>(workers_.size());
+
+    long value = 0;
+    if (get_int_property(properties, thread_property_name(), value) && value >= 0)
+    {
+        writer->async_thread_index_ = static_cast<uint32_t>(value) % number_of_threads;
+    }
+    else if (uses_participant_flow_controllers)
+    {
+        // The participant flow controllers are shared by all its writers, so they are served by the same thread,
+        // which keeps the order in which they are given bandwidth.
+        writer->async_thread_index_ = 0;
+    }
+    else
+    {
+        writer->async_thread_index_ = next_thread_index_.fetch_add(1) % number_of_threads;
+    }
+
+    writer->async_priority_ = 0;
+    if (get_int_property(properties, priority_property_name(), value))
+    {
+        writer->async_priority_ = static_cast<int32_t>(value);
+    }
+}
+
+AsyncWriterThread::Worker& AsyncWriterThread::worker_of(
+        RTPSWriter* writer)
+{
+    assert(writer->async_thread_index_ < workers_.size());
+    return *workers_[writer->async_thread_index_];
+}
+
 /*!
  * @brief This function removes a writer.
  * @param writer Asynchronous writer to be removed.
  * @return Result of the operation.
  */
-void AsyncWriterThread::unregister_writer(RTPSWriter* writer)
+void AsyncWriterThread::unregister_writer(
+        RTPSWriter* writer)
 {
-    if(interestTree_.unregister_interest(writer))
+    Worker& worker = worker_of(writer);
+
+    std::unique_lock<std::mutex> lock(worker.processing_mutex);
+    worker.interest_tree.unregister_interest(writer);
+
+    // Remove it from the current round, so it is not processed after being unregistered.
+    std::replace(worker.round.begin(), worker.round.end(), writer, static_cast<RTPSWriter*>(nullptr));
+
+    // Wait for the writer to be processed, in case it is being processed right now.
+    worker.processing_cv.wait(lock, [&]()
+            {
+                return worker.processing_writer != writer;
+            });
+}
+
+void AsyncWriterThread::schedule_nts(
+        Worker& worker)
+{
+    worker.run_scheduled = true;
+    // If thread not running, start it.
+    if (worker.thread == nullptr)
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        running_ = false;
-        run_scheduled_ = false;
-        cv_.notify_all();
-        if (thread_)
-        {
-            lock.unlock();
-            thread_->join();
-            lock.lock();
-            delete thread_;
-            thread_ = nullptr;
-        }
+        worker.running = true;
+        worker.thread = new std::thread(&AsyncWriterThread::run, this, &worker);
+    }
+    else
+    {
+        worker.cv.notify_all();
     }
 }
 
 void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer)
 {
-    if (interestTree_.register_interest(interested_writer))
+    Worker& worker = worker_of(interested_writer);
+    if (worker.interest_tree.register_interest(interested_writer))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        run_scheduled_ = true;
-        // If thread not running, start it.
-        if (thread_ == nullptr)
-        {
-            running_ = true;
-            thread_ = new std::thread(&AsyncWriterThread::run, this);
-        }
-        else
-        {
-            cv_.notify_all();
-        }
+        std::unique_lock<RecursiveTimedMutex> lock(worker.condition_variable_mutex);
+        schedule_nts(worker);
     }
 }
 
@@ -86,53 +189,64 @@ void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
 {
-    if (interestTree_.register_interest(interested_writer, max_blocking_time))
+    Worker& worker = worker_of(interested_writer);
+    if (worker.interest_tree.register_interest(interested_writer, max_blocking_time))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_, std::defer_lock);
+        std::unique_lock<RecursiveTimedMutex> lock(worker.condition_variable_mutex, std::defer_lock);
 
         if (lock.try_lock_until(max_blocking_time))
         {
-            run_scheduled_ = true;
-            // If thread not running, start it.
-            if (thread_ == nullptr)
-            {
-                running_ = true;
-                thread_ = new std::thread(&AsyncWriterThread::run, this);
-            }
-            else
-            {
-                cv_.notify_all();
-            }
+            schedule_nts(worker);
         }
     }
 }
 
-void AsyncWriterThread::run()
+void AsyncWriterThread::run(
+        Worker* worker)
 {
-    std::unique_lock<RecursiveTimedMutex> cond_guard(condition_variable_mutex_);
-    while(running_)
+    std::unique_lock<RecursiveTimedMutex> cond_guard(worker->condition_variable_mutex);
+    while (worker->running)
     {
-        if(run_scheduled_)
+        if (worker->run_scheduled)
         {
-            run_scheduled_ = false;
+            worker->run_scheduled = false;
             cond_guard.unlock();
-            interestTree_.swap();
-
-            interestTree_.mMutexActive.lock();
-            RTPSWriter* curr = interestTree_.next_active_nts();
 
-            while (curr)
-            {
-                curr->send_any_unsent_changes();
-                curr = interestTree_.next_active_nts();
-            }
-            interestTree_.mMutexActive.unlock();
+            process_round(*worker);
 
             cond_guard.lock();
         }
         else
         {
-            cv_.wait(cond_guard);
+            worker->cv.wait(cond_guard);
+        }
+    }
+}
+
+void AsyncWriterThread::process_round(
+        Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(worker.processing_mutex);
+    worker.interest_tree.take_all(worker.round);
+
+    // Writers are accessed by index, as unregister_writer may modify the round while a writer is processed.
+    for (size_t i = 0; i < worker.round.size(); ++i)
+    {
+        RTPSWriter* curr = worker.round[i];
+        if (nullptr == curr)
+        {
+            continue;
         }
+
+        worker.processing_writer = curr;
+        lock.unlock();
+
+        curr->send_any_unsent_changes();
+
+        lock.lock();
+        worker.processing_writer = nullptr;
+        worker.processing_cv.notify_all();
     }
+
+    worker.round.clear();
 }
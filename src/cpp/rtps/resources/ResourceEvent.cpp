@@ -22,17 +22,84 @@
 #include "TimedEventImpl.h"
 
 #include <cassert>
+#include <cstdint>
 #include <thread>
 
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
+//! Duration of a tick of the timer wheel, in nanoseconds.
+static constexpr int64_t wheel_resolution_ns = 100000;
+
+/*!
+ * @brief Calculates the number of ticks of the timer wheel between two time points.
+ * @param origin Time point corresponding to tick 0.
+ * @param time Time point to convert.
+ * @param round_up Whether a partial tick should be counted.
+ * @return Number of ticks.
+ */
+static uint64_t ticks_since(
+        const std::chrono::steady_clock::time_point& origin,
+        const std::chrono::steady_clock::time_point& time,
+        bool round_up)
 {
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
+    if (time <= origin)
+    {
+        return 0;
+    }
+
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count();
+    uint64_t ticks = static_cast<uint64_t>(elapsed / wheel_resolution_ns);
+    if (round_up && (elapsed % wheel_resolution_ns) != 0)
+    {
+        ++ticks;
+    }
+    return ticks;
+}
+
+/*!
+ * @brief Looks for the first bit set on a bitmap, starting on a given position.
+ * @param bitmap Words of the bitmap.
+ * @param num_words Number of words of the bitmap.
+ * @param from Position where the search starts.
+ * @param [out] position Position of the first bit set.
+ * @return false if no bit is set from the starting position.
+ */
+static bool find_next_bit(
+        const uint32_t* bitmap,
+        uint32_t num_words,
+        uint32_t from,
+        uint32_t& position)
+{
+    for (uint32_t word = from / 32u; word < num_words; ++word)
+    {
+        uint32_t bits = bitmap[word];
+        if (word == from / 32u)
+        {
+            bits &= ~0u << (from % 32u);
+        }
+
+        if (bits)
+        {
+            // Most modern CPUs have an instruction to count the trailing zeroes of a word.
+#if _MSC_VER
+            unsigned long bit;
+            _BitScanForward(&bit, bits);
+            uint32_t offset = static_cast<uint32_t>(bit);
+#else
+            uint32_t offset = static_cast<uint32_t>(__builtin_ctz(bits));
+#endif // if _MSC_VER
+            position = word * 32u + offset;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 ResourceEvent::~ResourceEvent()
@@ -78,24 +145,9 @@ void ResourceEvent::unregister_timer(
                 return allow_vector_manipulation_;
             });
 
-    bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
-
-    // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
-    {
-        pending_timers_.erase(it);
-        should_notify = true;
-    }
-
-    // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
-    {
-        active_timers_.erase(it);
-        should_notify = true;
-    }
+    // Remove from pending and from the timer wheel
+    bool should_notify = unregister_timer_nts(event);
+    should_notify = wheel_unlink(event) || should_notify;
 
     // Decrement counter of created timers
     --timers_count_;
@@ -138,8 +190,9 @@ void ResourceEvent::notify(
 bool ResourceEvent::register_timer_nts(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (SIZE_MAX == event->pending_index_)
     {
+        event->pending_index_ = pending_timers_.size();
         pending_timers_.push_back(event);
         return true;
     }
@@ -147,6 +200,24 @@ bool ResourceEvent::register_timer_nts(
     return false;
 }
 
+bool ResourceEvent::unregister_timer_nts(
+        TimedEventImpl* event)
+{
+    size_t index = event->pending_index_;
+    if (SIZE_MAX == index)
+    {
+        return false;
+    }
+
+    // Move the last pending event to the position being released
+    TimedEventImpl* last = pending_timers_.back();
+    pending_timers_[index] = last;
+    last->pending_index_ = index;
+    pending_timers_.pop_back();
+    event->pending_index_ = SIZE_MAX;
+    return true;
+}
+
 void ResourceEvent::event_service()
 {
     while (!stop_.load())
@@ -173,11 +244,12 @@ void ResourceEvent::event_service()
         allow_vector_manipulation_ = true;
         cv_manipulation_.notify_all();
 
-        // Wait for the first timer to be triggered
+        // Wait for the next tick on which the timer wheel has something to do
+        uint64_t next_tick = 0;
         std::chrono::steady_clock::time_point next_trigger =
-                active_timers_.empty() ?
-                current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                wheel_next_tick(next_tick) ?
+                wheel_origin_ + std::chrono::nanoseconds(static_cast<int64_t>(next_tick) * wheel_resolution_ns) :
+                current_time_ + std::chrono::seconds(1);
 
         cv_.wait_until(lock, next_trigger);
 
@@ -187,11 +259,6 @@ void ResourceEvent::event_service()
     }
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -202,67 +269,200 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
+            tp->pending_index_ = SIZE_MAX;
+
+            // Remove item from the timer wheel
+            wheel_unlink(tp);
 
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                // Timer has to be activated: add to the timer wheel
+                wheel_schedule(tp);
             }
         }
         pending_timers_.clear();
     }
 
-    // Trigger active timers
-    for (TimedEventImpl* tp : active_timers_)
+    // Collect the timers that expired since the last round
+    wheel_advance(ticks_since(wheel_origin_, current_time_, false));
+
+    // Trigger expired timers
+    for (TimedEventImpl* tp : expired_timers_)
     {
-        if (tp->next_trigger_time() <= current_time_)
+        tp->trigger(current_time_, cancel_time);
+
+        // Reschedule the timers that have been restarted
+        if (tp->next_trigger_time() < cancel_time)
         {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
+            wheel_schedule(tp);
         }
-        else
+    }
+    expired_timers_.clear();
+}
+
+void ResourceEvent::wheel_schedule(
+        TimedEventImpl* event)
+{
+    // Never schedule on a tick already processed
+    uint64_t expiration = ticks_since(wheel_origin_, event->next_trigger_time(), true);
+    event->wheel_expiration_ = (expiration > wheel_tick_) ? expiration : wheel_tick_ + 1u;
+    wheel_link(event);
+}
+
+void ResourceEvent::wheel_link(
+        TimedEventImpl* event)
+{
+    uint64_t expiration = event->wheel_expiration_;
+    TimedEventImpl** slot = &wheel_overflow_;
+
+    // Use the lowest level whose current rotation contains the expiration tick
+    for (uint32_t level = 0; level < wheel_levels_; ++level)
+    {
+        uint32_t upper_shift = (level + 1u) * wheel_slot_bits_;
+        if ((expiration >> upper_shift) == (wheel_tick_ >> upper_shift))
         {
+            uint32_t index = static_cast<uint32_t>(expiration >> (level * wheel_slot_bits_)) & (wheel_slots_ - 1u);
+            slot = &wheel_[level][index];
+            wheel_bitmap_[level][index / 32u] |= 1u << (index % 32u);
             break;
         }
     }
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    event->wheel_slot_ = slot;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = *slot;
+    if (nullptr != *slot)
+    {
+        (*slot)->wheel_prev_ = event;
+    }
+    *slot = event;
+}
+
+bool ResourceEvent::wheel_unlink(
+        TimedEventImpl* event)
+{
+    TimedEventImpl** slot = event->wheel_slot_;
+    if (nullptr == slot)
+    {
+        return false;
+    }
+
+    if (nullptr != event->wheel_prev_)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
+        event->wheel_prev_->wheel_next_ = event->wheel_next_;
+    }
+    else
+    {
+        *slot = event->wheel_next_;
+    }
+
+    if (nullptr != event->wheel_next_)
+    {
+        event->wheel_next_->wheel_prev_ = event->wheel_prev_;
+    }
+
+    // Keep the bitmap of non-empty slots up to date
+    if (nullptr == *slot && &wheel_overflow_ != slot)
+    {
+        size_t position = static_cast<size_t>(slot - &wheel_[0][0]);
+        uint32_t level = static_cast<uint32_t>(position / wheel_slots_);
+        uint32_t index = static_cast<uint32_t>(position % wheel_slots_);
+        wheel_bitmap_[level][index / 32u] &= ~(1u << (index % 32u));
+    }
+
+    event->wheel_slot_ = nullptr;
+    event->wheel_prev_ = nullptr;
+    event->wheel_next_ = nullptr;
+    return true;
+}
+
+void ResourceEvent::wheel_advance(
+        uint64_t tick)
+{
+    while (wheel_tick_ < tick)
+    {
+        // Jump directly to the next tick with some work to do
+        uint64_t next_tick = 0;
+        if (!wheel_next_tick(next_tick) || next_tick > tick)
+        {
+            wheel_tick_ = tick;
+            break;
+        }
+        wheel_tick_ = next_tick;
+
+        // When a rotation of a level is completed, the events on the next slot of the upper level are spread
+        // on the lower levels. Upper levels go first, as they may feed the slots of the lower ones.
+        for (uint32_t level = wheel_levels_; level > 0u; --level)
+        {
+            uint32_t shift = level * wheel_slot_bits_;
+            if (0u != (next_tick & ((uint64_t(1) << shift) - 1u)))
+            {
+                continue;
+            }
+
+            TimedEventImpl** slot = &wheel_overflow_;
+            if (level < wheel_levels_)
+            {
+                uint32_t index = static_cast<uint32_t>(next_tick >> shift) & (wheel_slots_ - 1u);
+                slot = &wheel_[level][index];
+                wheel_bitmap_[level][index / 32u] &= ~(1u << (index % 32u));
+            }
+
+            TimedEventImpl* event = *slot;
+            *slot = nullptr;
+            while (nullptr != event)
             {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
+                TimedEventImpl* next = event->wheel_next_;
+                wheel_link(event);
+                event = next;
+            }
+        }
+
+        // Events on the current slot of level 0 have expired
+        uint32_t index = static_cast<uint32_t>(next_tick) & (wheel_slots_ - 1u);
+        while (nullptr != wheel_[0][index])
+        {
+            TimedEventImpl* event = wheel_[0][index];
+            wheel_unlink(event);
+            expired_timers_.push_back(event);
+        }
     }
 }
 
+bool ResourceEvent::wheel_next_tick(
+        uint64_t& tick) const
+{
+    // Events on a level always expire after the ones on the lower levels
+    for (uint32_t level = 0; level < wheel_levels_; ++level)
+    {
+        uint32_t shift = level * wheel_slot_bits_;
+        uint32_t current = static_cast<uint32_t>(wheel_tick_ >> shift) & (wheel_slots_ - 1u);
+        uint32_t index = 0;
+        if (find_next_bit(wheel_bitmap_[level], wheel_slots_ / 32u, current + 1u, index))
+        {
+            uint32_t upper_shift = shift + wheel_slot_bits_;
+            tick = ((wheel_tick_ >> upper_shift) << upper_shift) | (uint64_t(index) << shift);
+            return true;
+        }
+    }
+
+    if (nullptr != wheel_overflow_)
+    {
+        // Overflowed events are spread when the last level completes its rotation
+        uint32_t shift = wheel_levels_ * wheel_slot_bits_;
+        tick = ((wheel_tick_ >> shift) + 1u) << shift;
+        return true;
+    }
+
+    return false;
+}
+
 void ResourceEvent::init_thread()
 {
     std::lock_guard<TimedMutex> lock(mutex_);
@@ -270,6 +470,9 @@ void ResourceEvent::init_thread()
     allow_vector_manipulation_ = false;
     resize_collections();
 
+    wheel_origin_ = std::chrono::steady_clock::now();
+    wheel_tick_ = 0;
+
     thread_ = std::thread(&ResourceEvent::event_service, this);
 }
 
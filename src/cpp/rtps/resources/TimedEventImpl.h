@@ -26,6 +26,7 @@
 #include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <atomic>
+#include <cstdint>
 #include <thread>
 #include <memory>
 #include <functional>
@@ -36,6 +37,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ResourceEvent;
+
 /*!
  * This class encapsulates a timer.
  * It also manages the state of the event (INACTIVE, READY, WAITING..).
@@ -43,6 +46,8 @@ namespace rtps {
  */
 class TimedEventImpl
 {
+    friend class ResourceEvent;
+
     using Callback = std::function<bool ()>;
 
 public:
@@ -167,6 +172,26 @@ private:
 
     //! Protects interval_microsec_ and next_trigger_time_
     std::mutex mutex_;
+
+    /*
+     * The following fields are owned by ResourceEvent and are protected by its mutex / execution thread.
+     * They let it keep the event on its timer wheel and pending collection without searching for it.
+     */
+
+    //! Previous event on the same slot of the timer wheel.
+    TimedEventImpl* wheel_prev_ = nullptr;
+
+    //! Next event on the same slot of the timer wheel.
+    TimedEventImpl* wheel_next_ = nullptr;
+
+    //! Head of the slot of the timer wheel holding this event. nullptr when the event is not on the wheel.
+    TimedEventImpl** wheel_slot_ = nullptr;
+
+    //! Tick of the timer wheel on which this event expires.
+    uint64_t wheel_expiration_ = 0;
+
+    //! Position of this event on the pending collection of ResourceEvent. SIZE_MAX when not pending.
+    size_t pending_index_ = SIZE_MAX;
 };
 
 } // namespace rtps
@@ -40,13 +40,26 @@ class TCPSenderResource : public fastrtps::rtps::SenderResource
                 };
 
         send_lambda_ = [this, &transport] (
-            const fastrtps::rtps::octet* data,
-            uint32_t dataSize,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point&) -> bool
                 {
-                    return transport.send(data, dataSize, channel_, destination_locators_begin, destination_locators_end);
+                    if (buffers.size() == 1)
+                    {
+                        return transport.send(buffers.front().buffer, total_bytes, channel_,
+                                       destination_locators_begin, destination_locators_end);
+                    }
+
+                    // The TCP header needs the CRC of the whole message, so it is gathered into a single buffer
+                    flat_buffer_.clear();
+                    for (const fastrtps::rtps::NetworkBuffer& buffer : buffers)
+                    {
+                        flat_buffer_.insert(flat_buffer_.end(), buffer.buffer, buffer.buffer + buffer.size);
+                    }
+                    return transport.send(flat_buffer_.data(), total_bytes, channel_, destination_locators_begin,
+                                   destination_locators_end);
                 };
     }
 
@@ -81,6 +94,8 @@ class TCPSenderResource : public fastrtps::rtps::SenderResource
         TCPSenderResource& operator=(const SenderResource&) = delete;
 
         std::shared_ptr<TCPChannelResource> channel_;
+
+        std::vector<fastrtps::rtps::octet> flat_buffer_;
 };
 
 } // namespace rtps
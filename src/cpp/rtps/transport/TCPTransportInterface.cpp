@@ -57,6 +57,7 @@ static const int s_default_keep_alive_frequency = 5000; // 5 SECONDS
 static const int s_default_keep_alive_timeout = 15000; // 15 SECONDS
 //static const int s_clean_deleted_sockets_pool_timeout = 100; // 100 MILLISECONDS
 static const int s_default_tcp_negotitation_timeout = 5000; // 5 Seconds
+static const uint32_t s_default_io_threads = 2;
 
 TCPTransportDescriptor::TCPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
@@ -66,6 +67,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , logical_port_range(20)
     , logical_port_increment(2)
     , tcp_negotiation_timeout(s_default_tcp_negotitation_timeout)
+    , io_threads(s_default_io_threads)
     , enable_tcp_nodelay(false)
     , wait_for_tcp_negotiation(false)
     , calculate_crc(true)
@@ -84,6 +86,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , logical_port_range(t.logical_port_range)
     , logical_port_increment(t.logical_port_increment)
     , tcp_negotiation_timeout(t.tcp_negotiation_timeout)
+    , io_threads(t.io_threads)
     , enable_tcp_nodelay(t.enable_tcp_nodelay)
     , wait_for_tcp_negotiation(t.wait_for_tcp_negotiation)
     , calculate_crc(t.calculate_crc)
@@ -109,6 +112,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     logical_port_range = t.logical_port_range;
     logical_port_increment = t.logical_port_increment;
     tcp_negotiation_timeout = t.tcp_negotiation_timeout;
+    io_threads = t.io_threads;
     enable_tcp_nodelay = t.enable_tcp_nodelay;
     wait_for_tcp_negotiation = t.wait_for_tcp_negotiation;
     calculate_crc = t.calculate_crc;
@@ -185,11 +189,14 @@ void TCPTransportInterface::clean()
         }
     }
 
-    if (io_service_thread_)
+    if (!io_service_threads_.empty())
     {
         io_service_.stop();
-        io_service_thread_->join();
-        io_service_thread_ = nullptr;
+        for (std::thread& io_service_thread : io_service_threads_)
+        {
+            io_service_thread.join();
+        }
+        io_service_threads_.clear();
     }
 }
 
@@ -211,12 +218,7 @@ bool TCPTransportInterface::check_crc(
         const octet* data,
         uint32_t size) const
 {
-    uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
-    {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
-    }
-    return crc == header.crc;
+    return RTCPMessageManager::addToCRC(0, data, size) == header.crc;
 }
 
 void TCPTransportInterface::calculate_crc(
@@ -224,12 +226,7 @@ void TCPTransportInterface::calculate_crc(
         const octet* data,
         uint32_t size) const
 {
-    uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
-    {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
-    }
-    header.crc = crc;
+    header.crc = RTCPMessageManager::addToCRC(0, data, size);
 }
 
 bool TCPTransportInterface::create_acceptor_socket(
@@ -397,7 +394,11 @@ bool TCPTransportInterface::init()
 #endif // if ASIO_VERSION >= 101200
                 io_service_.run();
             };
-    io_service_thread_ = std::make_shared<std::thread>(ioServiceFunction);
+    uint32_t io_threads = (std::max)(configuration()->io_threads, 1u);
+    for (uint32_t i = 0; i < io_threads; ++i)
+    {
+        io_service_threads_.emplace_back(ioServiceFunction);
+    }
 
     if (0 < configuration()->keep_alive_frequency_ms)
     {
@@ -747,33 +748,9 @@ void TCPTransportInterface::perform_listen_operation(
         std::weak_ptr<RTCPMessageManager> rtcp_manager)
 {
     Locator_t remote_locator;
-    uint16_t logicalPort(0);
-    std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-    std::shared_ptr<TCPChannelResource> channel;
-    rtcp_message_manager = rtcp_manager.lock();
-
-    // RTCP Control Message
-    if (rtcp_message_manager)
-    {
-        channel = channel_weak.lock();
+    std::shared_ptr<TCPChannelResource> channel = channel_weak.lock();
 
-        if (channel)
-        {
-            if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
-            {
-                rtcp_message_manager->sendConnectionRequest(channel);
-            }
-            else
-            {
-                channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
-            }
-        }
-
-        std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-        rtcp_message_manager.reset();
-        rtcp_message_manager_cv_.notify_one();
-    }
-    else
+    if (!begin_listen_operation(channel, rtcp_manager))
     {
         return;
     }
@@ -791,29 +768,296 @@ void TCPTransportInterface::perform_listen_operation(
         if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
         {
             // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
-            if (it != receiver_resources_.end())
+            deliver_tcp_message(channel, msg.buffer, msg.length, remote_locator);
+        }
+    }
+
+    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+bool TCPTransportInterface::begin_listen_operation(
+        std::shared_ptr<TCPChannelResource>& channel,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager)
+{
+    std::shared_ptr<RTCPMessageManager> rtcp_message_manager = rtcp_manager.lock();
+
+    // RTCP Control Message
+    if (!rtcp_message_manager)
+    {
+        return false;
+    }
+
+    if (channel)
+    {
+        if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
+        {
+            rtcp_message_manager->sendConnectionRequest(channel);
+        }
+        else
+        {
+            channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+    rtcp_message_manager.reset();
+    rtcp_message_manager_cv_.notify_one();
+    return true;
+}
+
+struct TCPTransportInterface::AsyncReceiveOperation
+{
+    std::shared_ptr<TCPChannelResource> channel;
+
+    //! Socket the operation reads from. The channel replaces its socket when it reconnects.
+    std::shared_ptr<asio::ip::tcp::socket> socket;
+
+    std::weak_ptr<RTCPMessageManager> rtcp_manager;
+
+    TCPHeader header;
+};
+
+void TCPTransportInterface::start_async_listen_operation(
+        std::shared_ptr<TCPChannelResource>& channel,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager)
+{
+    if (!begin_listen_operation(channel, rtcp_manager))
+    {
+        return;
+    }
+
+    auto operation = std::make_shared<AsyncReceiveOperation>();
+    operation->channel = channel;
+    operation->socket = static_cast<TCPChannelResourceBasic*>(channel.get())->socket();
+    operation->rtcp_manager = rtcp_manager;
+    async_read_header(operation);
+}
+
+void TCPTransportInterface::async_read_header(
+        const std::shared_ptr<AsyncReceiveOperation>& operation)
+{
+    if (!(TCPChannelResource::eConnectionStatus::eConnecting < operation->channel->connection_status()))
+    {
+        logInfo(RTCP, "End PerformListenOperation " << operation->channel->locator());
+        return;
+    }
+
+    asio::async_read(*operation->socket, asio::buffer(&operation->header, TCPHeader::size()),
+            [this, operation](const asio::error_code& ec, std::size_t bytes_received)
             {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use = true;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use = false;
-                receiver_in_use->cv.notify_one();
-            }
-            else
+                if (bytes_received != TCPHeader::size())
+                {
+                    if (bytes_received > 0)
+                    {
+                        logError(RTCP_MSG_IN, "Bad TCP header size: " << bytes_received << " (expected: : "
+                                                                      << TCPHeader::size() << ")" << ec.message());
+                    }
+                    else if (ec)
+                    {
+                        logWarning(DEBUG, "Error reading TCP header: " << ec.message());
+                    }
+
+                    close_async_receive_channel(operation);
+                    return;
+                }
+
+                const TCPHeader& tcp_header = operation->header;
+                if (tcp_header.rtcp[0] != 'R'
+                        || tcp_header.rtcp[1] != 'T'
+                        || tcp_header.rtcp[2] != 'C'
+                        || tcp_header.rtcp[3] != 'P'
+                        || tcp_header.length < TCPHeader::size())
+                {
+                    logError(RTCP_MSG_IN, "Bad RTCP header identifier, closing connection.");
+                    close_async_receive_channel(operation);
+                    return;
+                }
+
+                size_t body_size = tcp_header.length - static_cast<uint32_t>(TCPHeader::size());
+                uint32_t receive_buffer_capacity = operation->channel->message_buffer().max_size;
+
+                if (body_size > receive_buffer_capacity)
+                {
+                    logError(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                            << static_cast<uint32_t>(body_size) << " vs. " << receive_buffer_capacity << ". "
+                            << "The full message will be dropped.");
+                    async_discard_body(operation, body_size);
+                }
+                else
+                {
+                    logInfo(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << tcp_header.logical_port);
+                    async_read_body(operation);
+                }
+            });
+}
+
+void TCPTransportInterface::async_read_body(
+        const std::shared_ptr<AsyncReceiveOperation>& operation)
+{
+    CDRMessage_t& msg = operation->channel->message_buffer();
+    fastrtps::rtps::CDRMessage::initCDRMsg(&msg);
+    size_t body_size = operation->header.length - static_cast<uint32_t>(TCPHeader::size());
+
+    asio::async_read(*operation->socket, asio::buffer(msg.buffer, body_size),
+            [this, operation, body_size](const asio::error_code& ec, std::size_t bytes_received)
+            {
+                std::shared_ptr<TCPChannelResource>& channel = operation->channel;
+                CDRMessage_t& msg = channel->message_buffer();
+
+                if (ec)
+                {
+                    logWarning(RTCP, "Error reading RTCP body: " << ec.message());
+                }
+                else if (bytes_received != body_size)
+                {
+                    logError(RTCP, "Bad RTCP body size: " << bytes_received << " (expected: " << body_size << ")");
+                }
+                else
+                {
+                    msg.length = static_cast<uint32_t>(bytes_received);
+                    Locator_t remote_locator;
+
+                    try
+                    {
+                        if (process_tcp_message(operation->rtcp_manager, channel, operation->header, msg.buffer,
+                                msg.length, remote_locator) && msg.length > 0 &&
+                                TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+                        {
+                            deliver_tcp_message(channel, msg.buffer, msg.length, remote_locator);
+                        }
+                    }
+                    catch (const asio::system_error& error)
+                    {
+                        (void)error;
+                        logError(RTCP_MSG_IN, "ASIO SYSTEM_ERROR [RECEIVE]: " << error.what());
+                        close_async_receive_channel(operation);
+                        return;
+                    }
+                }
+
+                // Errors reading the body are detected again when reading the next header.
+                async_read_header(operation);
+            });
+}
+
+void TCPTransportInterface::async_discard_body(
+        const std::shared_ptr<AsyncReceiveOperation>& operation,
+        size_t remaining)
+{
+    if (remaining == 0)
+    {
+        async_read_header(operation);
+        return;
+    }
+
+    CDRMessage_t& msg = operation->channel->message_buffer();
+    size_t read_block = (std::min)(remaining, static_cast<size_t>(msg.max_size));
+
+    asio::async_read(*operation->socket, asio::buffer(msg.buffer, read_block),
+            [this, operation, remaining](const asio::error_code& ec, std::size_t bytes_received)
+            {
+                if (ec)
+                {
+                    logWarning(RTCP, "Error reading RTCP body: " << ec.message());
+                    close_async_receive_channel(operation);
+                    return;
+                }
+
+                async_discard_body(operation, remaining - bytes_received);
+            });
+}
+
+void TCPTransportInterface::close_async_receive_channel(
+        const std::shared_ptr<AsyncReceiveOperation>& operation)
+{
+    std::shared_ptr<TCPChannelResource>& channel = operation->channel;
+    if (operation->socket == static_cast<TCPChannelResourceBasic*>(channel.get())->socket())
+    {
+        close_tcp_socket(channel);
+    }
+
+    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+bool TCPTransportInterface::process_tcp_message(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        Locator_t& remote_locator)
+{
+    remote_locator = channel->locator();
+
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size);
+
+            if (responseCode != RETCODE_OK)
             {
-                logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+                close_tcp_socket(channel);
             }
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            close_tcp_socket(channel);
         }
+
+        return false;
     }
 
-    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+    IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+    logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                            << " - " << receive_buffer_size << " bytes.");
+    return true;
+}
+
+void TCPTransportInterface::deliver_tcp_message(
+        std::shared_ptr<TCPChannelResource>& channel,
+        const octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        const Locator_t& remote_locator)
+{
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use = true;
+        scopedLock.unlock();
+        receiver->OnDataReceived(receive_buffer, receive_buffer_size, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use = false;
+        receiver_in_use->cv.notify_one();
+    }
+    else
+    {
+        logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
 }
 
 bool TCPTransportInterface::read_body(
@@ -929,51 +1173,8 @@ bool TCPTransportInterface::Receive(
 
                     if (success)
                     {
-                        if (configuration()->check_crc
-                                && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                        {
-                            logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
-                        }
-
-                        if (tcp_header.logical_port == 0)
-                        {
-                            std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                            if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-
-                            {
-                                std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                                rtcp_message_manager = rtcp_manager.lock();
-                            }
-
-                            if (rtcp_message_manager)
-                            {
-                                // The channel is not going to be deleted because we lock it for reading.
-                                ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                    channel, receive_buffer, body_size);
-
-                                if (responseCode != RETCODE_OK)
-                                {
-                                    close_tcp_socket(channel);
-                                }
-                                success = false;
-
-                                std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                                rtcp_message_manager.reset();
-                                rtcp_message_manager_cv_.notify_one();
-                            }
-                            else
-                            {
-                                success = false;
-                                close_tcp_socket(channel);
-                            }
-
-                        }
-                        else
-                        {
-                            IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                            logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                    << " - " << receive_buffer_size << " bytes.");
-                        }
+                        success = process_tcp_message(rtcp_manager, channel, tcp_header, receive_buffer,
+                                        receive_buffer_size, remote_locator);
                     }
                     // Error message already shown by read_body method.
                 }
@@ -1177,10 +1378,8 @@ void TCPTransportInterface::SocketAccepted(
             }
 
             channel->set_options(configuration());
-            std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
             std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                    channel_weak_ptr, rtcp_manager_weak_ptr));
+            start_async_listen_operation(channel, rtcp_manager_weak_ptr);
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                                                           << ", remote: " << channel->remote_endpoint().address()
@@ -1270,8 +1469,16 @@ void TCPTransportInterface::SocketConnected(
                     channel->set_options(configuration());
 
                     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-                    channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                            channel_weak_ptr, rtcp_manager_weak_ptr));
+                    if (nullptr != dynamic_cast<TCPChannelResourceBasic*>(channel.get()))
+                    {
+                        start_async_listen_operation(channel, rtcp_manager_weak_ptr);
+                    }
+                    else
+                    {
+                        // Reads on TLS channels wait for handlers of io_service_, so they keep their own thread.
+                        channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
+                                channel_weak_ptr, rtcp_manager_weak_ptr));
+                    }
                 }
             }
             else
@@ -17,6 +17,15 @@
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <cerrno>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -31,15 +40,24 @@ UDPChannelResource::UDPChannelResource(
         uint32_t maxMsgSize,
         const Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        uint32_t receive_batch_size)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
     , only_multicast_purpose_(false)
     , interface_(sInterface)
     , transport_(transport)
+    , receive_batch_size_(receive_batch_size)
 {
-    thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
+    if (receive_batch_size_ > 1)
+    {
+        thread(std::thread(&UDPChannelResource::perform_batch_listen_operation, this, locator));
+    }
+    else
+    {
+        thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
+    }
 }
 
 UDPChannelResource::~UDPChannelResource()
@@ -74,6 +92,85 @@ void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
     message_receiver(nullptr);
 }
 
+void UDPChannelResource::perform_batch_listen_operation(
+        Locator_t input_locator)
+{
+#if defined(__linux__)
+    // Ring of buffers filled on each receive operation
+    std::vector<fastrtps::rtps::CDRMessage_t> buffers;
+    std::vector<struct mmsghdr> headers(receive_batch_size_);
+    std::vector<struct iovec> iovecs(receive_batch_size_);
+    std::vector<struct sockaddr_storage> addresses(receive_batch_size_);
+    buffers.reserve(receive_batch_size_);
+    for (uint32_t i = 0; i < receive_batch_size_; ++i)
+    {
+        buffers.emplace_back(message_buffer().max_size);
+        iovecs[i].iov_base = buffers[i].buffer;
+        iovecs[i].iov_len = buffers[i].max_size;
+    }
+
+    Locator_t remote_locator;
+    asio::ip::udp::endpoint sender_endpoint;
+
+    while (alive())
+    {
+        for (uint32_t i = 0; i < receive_batch_size_; ++i)
+        {
+            memset(&headers[i], 0, sizeof(struct mmsghdr));
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Blocking receive until the first datagram arrives, then take the ones already queued.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), receive_batch_size_, MSG_WAITFORONE,
+                        nullptr);
+        if (received <= 0)
+        {
+            if (received < 0 && errno != EINTR && alive())
+            {
+                logWarning(RTPS_MSG_OUT, "Error receiving data: " << strerror(errno) << " - " << message_receiver()
+                                                                  << " (" << this << ")");
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received && alive(); ++i)
+        {
+            uint32_t length = static_cast<uint32_t>(headers[i].msg_len);
+            fastrtps::rtps::octet* buffer = buffers[i].buffer;
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (length == 0 || (length == 13 && memcmp(buffer, "EPRORTPSCLOSE", 13) == 0))
+            {
+                continue;
+            }
+
+            size_t address_size = std::min(static_cast<size_t>(headers[i].msg_hdr.msg_namelen),
+                            sender_endpoint.capacity());
+            memcpy(sender_endpoint.data(), &addresses[i], address_size);
+            sender_endpoint.resize(address_size);
+            transport_->endpoint_to_locator(sender_endpoint, remote_locator);
+
+            // Processes the data through the CDR Message interface.
+            if (message_receiver() != nullptr)
+            {
+                message_receiver()->OnDataReceived(buffer, length, input_locator, remote_locator);
+            }
+            else if (alive())
+            {
+                logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        }
+    }
+
+    message_receiver(nullptr);
+#else
+    perform_listen_operation(input_locator);
+#endif // if defined(__linux__)
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -41,13 +41,13 @@ class UDPSenderResource : public fastrtps::rtps::SenderResource
                 };
 
             send_lambda_ = [this, &transport] (
-                const fastrtps::rtps::octet* data,
-                uint32_t dataSize,
+                const fastrtps::rtps::NetworkBuffers& buffers,
+                uint32_t total_bytes,
                 fastrtps::rtps::LocatorsIterator* destination_locators_begin,
                 fastrtps::rtps::LocatorsIterator* destination_locators_end,
                 const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
                     {
-                        return transport.send(data, dataSize, socket_, destination_locators_begin,
+                        return transport.send(buffers, total_bytes, socket_, send_state_, destination_locators_begin,
                                     destination_locators_end, only_multicast_purpose_, max_blocking_time_point);
                     };
         }
@@ -82,6 +82,8 @@ class UDPSenderResource : public fastrtps::rtps::SenderResource
 
         eProsimaUDPSocket socket_;
 
+        UDPTransportInterface::SocketSendState send_state_;
+
         bool only_multicast_purpose_;
 };
 
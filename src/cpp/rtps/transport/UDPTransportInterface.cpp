@@ -24,6 +24,13 @@
 #include <cstring>
 #include <algorithm>
 #include <chrono>
+#include <iterator>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cerrno>
+#endif // if defined(__linux__)
 
 using namespace std;
 using namespace asio;
@@ -41,8 +48,117 @@ using IPFinder = fastrtps::rtps::IPFinder;
 using octet = fastrtps::rtps::octet;
 using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
+using NetworkBuffers = fastrtps::rtps::NetworkBuffers;
 using Log = fastdds::dds::Log;
 
+#if defined(__linux__)
+//! Maximum number of slices of a message that can be sent with a batch
+static constexpr size_t max_batch_iovecs = 64;
+
+//! Maximum number of datagrams sent with a single system call
+static constexpr unsigned int max_batch_datagrams = 32;
+#endif // if defined(__linux__)
+
+/**
+ * Adapts a list of NetworkBuffer to the ConstBufferSequence concept of asio, so a message
+ * made of several slices is gathered by the kernel instead of being copied to a single buffer.
+ */
+class NetworkBufferSequence
+{
+public:
+
+    using value_type = asio::const_buffer;
+
+    class const_iterator
+    {
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = asio::const_buffer;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const asio::const_buffer*;
+        using reference = asio::const_buffer;
+
+        const_iterator() = default;
+
+        explicit const_iterator(
+                NetworkBuffers::const_iterator it)
+            : it_(it)
+        {
+        }
+
+        asio::const_buffer operator *() const
+        {
+            return asio::const_buffer(it_->buffer, it_->size);
+        }
+
+        const_iterator& operator ++()
+        {
+            ++it_;
+            return *this;
+        }
+
+        const_iterator operator ++(
+                int)
+        {
+            const_iterator tmp = *this;
+            ++it_;
+            return tmp;
+        }
+
+        const_iterator& operator --()
+        {
+            --it_;
+            return *this;
+        }
+
+        const_iterator operator --(
+                int)
+        {
+            const_iterator tmp = *this;
+            --it_;
+            return tmp;
+        }
+
+        bool operator ==(
+                const const_iterator& other) const
+        {
+            return it_ == other.it_;
+        }
+
+        bool operator !=(
+                const const_iterator& other) const
+        {
+            return it_ != other.it_;
+        }
+
+    private:
+
+        NetworkBuffers::const_iterator it_;
+    };
+
+    explicit NetworkBufferSequence(
+            const NetworkBuffers& buffers)
+        : buffers_(buffers)
+    {
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(buffers_.begin());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(buffers_.end());
+    }
+
+private:
+
+    const NetworkBuffers& buffers_;
+};
+
 struct MultiUniLocatorsLinkage
 {
     MultiUniLocatorsLinkage(
@@ -67,6 +183,8 @@ UDPTransportDescriptor::UDPTransportDescriptor(
         const UDPTransportDescriptor& t)
     : SocketTransportDescriptor(t)
     , m_output_udp_socket(t.m_output_udp_socket)
+    , listen_threads(t.listen_threads)
+    , receive_batch_size(t.receive_batch_size)
 {
 }
 
@@ -210,14 +328,37 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
 
+    // Sharding is only possible on unicast ports, as every socket gets a copy of multicast datagrams
+    uint32_t listen_threads = 1;
+#if defined(__linux__)
+    if (!is_multicast && configuration()->listen_threads > 1)
+    {
+        listen_threads = configuration()->listen_threads;
+    }
+#endif // if defined(__linux__)
+    bool reuse_port = listen_threads > 1;
+
     try
     {
         std::vector<std::string> vInterfaces = get_binding_interfaces_list();
         for (std::string sInterface : vInterfaces)
         {
-            UDPChannelResource* p_channel_resource;
-            p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            if (reuse_port)
+            {
+                // Binding an exclusive socket first ensures the port is not in use by anyone else, as other
+                // sockets could join the group of sockets sharing the port.
+                eProsimaUDPSocket probe = OpenAndBindInputSocket(sInterface,
+                                IPLocator::getPhysicalPort(locator), is_multicast, false);
+                getSocketPtr(probe)->close();
+            }
+
+            for (uint32_t i = 0; i < listen_threads; ++i)
+            {
+                UDPChannelResource* p_channel_resource;
+                p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize,
+                                receiver, reuse_port);
+                mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            }
         }
     }
     catch (asio::system_error const& e)
@@ -237,12 +378,13 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         const Locator_t& locator,
         bool is_multicast,
         uint32_t maxMsgSize,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        bool reuse_port)
 {
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
-                    IPLocator::getPhysicalPort(locator), is_multicast);
+                    IPLocator::getPhysicalPort(locator), is_multicast, reuse_port);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
-                    sInterface, receiver);
+                    sInterface, receiver, configuration()->receive_batch_size);
     return p_channel_resource;
 }
 
@@ -461,31 +603,39 @@ bool UDPTransportInterface::transform_remote_locator(
 }
 
 bool UDPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         eProsimaUDPSocket& socket,
+        SocketSendState& send_state,
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
+    configure_send_timeout(socket, send_state, std::chrono::duration_cast<std::chrono::microseconds>(
+                max_blocking_time_point - std::chrono::steady_clock::now()));
+
+#if defined(__linux__)
+    if (buffers.size() <= max_batch_iovecs)
+    {
+        return send_batch(buffers, total_bytes, socket, destination_locators_begin, destination_locators_end,
+                       only_multicast_purpose);
+    }
+#endif // if defined(__linux__)
+
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
     bool ret = true;
 
-    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
-        max_blocking_time_point - std::chrono::steady_clock::now());
-
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer,
-                            send_buffer_size,
+            ret &= send(buffers,
+                            total_bytes,
                             socket,
                             *it,
-                            only_multicast_purpose,
-                            time_out);
+                            only_multicast_purpose);
         }
 
         ++it;
@@ -494,15 +644,56 @@ bool UDPTransportInterface::send(
     return ret;
 }
 
+void UDPTransportInterface::configure_send_timeout(
+        eProsimaUDPSocket& socket,
+        SocketSendState& send_state,
+        std::chrono::microseconds timeout)
+{
+#ifndef _WIN32
+    // Blocking time has no effect on non-blocking sockets
+    if (configuration()->non_blocking_send)
+    {
+        return;
+    }
+
+    // Rounding down to a power of two keeps the socket below the requested blocking time, while a sequence of
+    // sends with the same deadline only needs a system call each time the remaining time is halved.
+    int64_t timeout_us = 0;
+    if (timeout.count() > 0)
+    {
+        timeout_us = 1;
+        while (timeout_us <= timeout.count() / 2)
+        {
+            timeout_us <<= 1;
+        }
+    }
+
+    if (send_state.timeout.count() != timeout_us)
+    {
+        struct timeval timeStruct;
+        timeStruct.tv_sec = static_cast<decltype(timeStruct.tv_sec)>(timeout_us / 1000000);
+        timeStruct.tv_usec = static_cast<decltype(timeStruct.tv_usec)>(timeout_us % 1000000);
+        if (0 == setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
+                reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct)))
+        {
+            send_state.timeout = std::chrono::microseconds(timeout_us);
+        }
+    }
+#else
+    (void)socket;
+    (void)send_state;
+    (void)timeout;
+#endif // ifndef _WIN32
+}
+
 bool UDPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         eProsimaUDPSocket& socket,
         const fastrtps::rtps::Locator_t& remote_locator,
-        bool only_multicast_purpose,
-        const std::chrono::microseconds& timeout)
+        bool only_multicast_purpose)
 {
-    if (send_buffer_size > configuration()->sendBufferSize)
+    if (total_bytes > configuration()->sendBufferSize)
     {
         return false;
     }
@@ -518,18 +709,17 @@ bool UDPTransportInterface::send(
 
         try
         {
-            (void)timeout;
-#ifndef _WIN32
-            struct timeval timeStruct;
-            timeStruct.tv_sec = 0;
-            timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
-            setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
-                    reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
-#endif // ifndef _WIN32
-
             asio::error_code ec;
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer,
-                            send_buffer_size), destinationEndpoint, 0, ec);
+            if (buffers.size() == 1)
+            {
+                bytesSent = getSocketPtr(socket)->send_to(asio::buffer(buffers.front().buffer,
+                                buffers.front().size), destinationEndpoint, 0, ec);
+            }
+            else
+            {
+                bytesSent = getSocketPtr(socket)->send_to(NetworkBufferSequence(buffers), destinationEndpoint, 0,
+                                ec);
+            }
             if (!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -558,6 +748,116 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+#if defined(__linux__)
+bool UDPTransportInterface::send_batch(
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        while (it != *destination_locators_end)
+        {
+            ret &= !IsLocatorSupported(*it);
+            ++it;
+        }
+        return ret;
+    }
+
+    // All the datagrams share the same payload
+    struct iovec iovecs[max_batch_iovecs];
+    size_t num_iovecs = 0;
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        iovecs[num_iovecs].iov_base = const_cast<octet*>(buffer.buffer);
+        iovecs[num_iovecs].iov_len = buffer.size;
+        ++num_iovecs;
+    }
+
+    struct sockaddr_storage addresses[max_batch_datagrams];
+    struct mmsghdr messages[max_batch_datagrams];
+    unsigned int num_messages = 0;
+    int fd = getSocketPtr(socket)->native_handle();
+
+    auto flush = [&]()
+            {
+                unsigned int sent = 0;
+                while (sent < num_messages)
+                {
+                    int result = sendmmsg(fd, &messages[sent], num_messages - sent, 0);
+                    if (0 < result)
+                    {
+                        sent += static_cast<unsigned int>(result);
+                    }
+                    else if (EINTR != errno)
+                    {
+                        // The first pending datagram failed. It is skipped and the rest are retried.
+                        if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+                        {
+                            logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                        }
+                        else
+                        {
+                            logWarning(RTPS_MSG_OUT, std::strerror(errno));
+                            ret = false;
+                        }
+                        ++sent;
+                    }
+                }
+
+                logInfo(RTPS_MSG_OUT, "UDPTransport: " << total_bytes << " bytes TO " << num_messages
+                                                       << " endpoints FROM " << getSocketPtr(socket)->local_endpoint());
+                num_messages = 0;
+            };
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            if (IPLocator::isMulticast(*it) || !only_multicast_purpose)
+            {
+                auto destinationEndpoint = generate_endpoint(*it, IPLocator::getPhysicalPort(*it));
+                memcpy(&addresses[num_messages], destinationEndpoint.data(), destinationEndpoint.size());
+
+                struct msghdr& header = messages[num_messages].msg_hdr;
+                memset(&header, 0, sizeof(header));
+                header.msg_name = &addresses[num_messages];
+                header.msg_namelen = static_cast<socklen_t>(destinationEndpoint.size());
+                header.msg_iov = iovecs;
+                header.msg_iovlen = num_iovecs;
+                messages[num_messages].msg_len = 0;
+
+                if (max_batch_datagrams == ++num_messages)
+                {
+                    flush();
+                }
+            }
+            else
+            {
+                ret = false;
+            }
+        }
+
+        ++it;
+    }
+
+    if (0 < num_messages)
+    {
+        flush();
+    }
+
+    return ret;
+}
+
+#endif // if defined(__linux__)
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -298,7 +298,8 @@ const std::string& UDPv6Transport::localhost_name()
 eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         const std::string& sIp,
         uint16_t port,
-        bool is_multicast)
+        bool is_multicast,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -316,6 +317,16 @@ eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
 #endif // if defined(__QNX__)
     }
 
+#if defined(__linux__)
+    if (reuse_port)
+    {
+        getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                    ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+    }
+#else
+    (void)reuse_port;
+#endif // if defined(__linux__)
+
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
 
     return socket;
@@ -37,13 +37,13 @@ public:
             };
 
         send_lambda_ = [&transport] (
-            const fastrtps::rtps::octet* data,
-            uint32_t dataSize,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
                 {
-                    return transport.send(data, dataSize, destination_locators_begin, destination_locators_end,
+                    return transport.send(buffers, total_bytes, destination_locators_begin, destination_locators_end,
                                     max_blocking_time_point);
                 };
 
@@ -42,6 +42,8 @@ using Locator_t = fastrtps::rtps::Locator_t;
 using LocatorList_t = fastrtps::rtps::LocatorList_t;
 using Log = dds::Log;
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
+using NetworkBuffers = fastrtps::rtps::NetworkBuffers;
 using SenderResource = fastrtps::rtps::SenderResource;
 using LocatorSelectorEntry = fastrtps::rtps::LocatorSelectorEntry;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
@@ -388,23 +390,29 @@ bool SharedMemTransport::transform_remote_locator(
 }
 
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            shared_mem_segment_->alloc_buffer(total_bytes, max_blocking_time_point);
 
-    memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
+    // Gather all the slices directly into the segment
+    octet* pos = static_cast<octet*>(shared_buffer->data());
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        memcpy(pos, buffer.buffer, buffer.size);
+        pos += buffer.size;
+    }
 
     return shared_buffer;
 }
 
 bool SharedMemTransport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
@@ -424,7 +432,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -133,17 +133,16 @@ public:
     /**
      * Blocking Send through the specified channel. In both modes, using a localLocator of 0.0.0.0 will
      * send through all whitelisted interfaces provided the channel is open.
-     * @param send_buffer Slice into the raw data to send.
-     * @param send_buffer_size Size of the raw data. It will be used as a bounds check for the previous argument.
+     * @param buffers List of slices of raw data to send. They are gathered into a single shared buffer.
+     * @param total_bytes Sum of the sizes of all the slices.
      * It must not exceed the send_buffer_size fed to this class during construction.
-     * @param socket channel we're sending from.
-     * @param remote_locator Locator describing the remote destination we're sending to.
-     * @param only_multicast_purpose
-     * @param timeout Maximum time this function will block
+     * @param destination_locators_begin pointer to destination locators iterator begin.
+     * @param destination_locators_end pointer to destination locators iterator end.
+     * @param max_blocking_time_point Maximum time this function will block
      */
     virtual bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
@@ -234,8 +233,8 @@ protected:
 private:
 
     std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const fastrtps::rtps::NetworkBuffers& buffers,
+            uint32_t total_bytes,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
     bool send(
@@ -175,6 +175,36 @@ uint32_t& RTCPMessageManager::addToCRC(
     return crc;
 }
 
+uint32_t RTCPMessageManager::addToCRC(
+        uint32_t crc,
+        const octet* data,
+        size_t size)
+{
+    // Adding octets one by one with an end-around carry is the same as adding them all on a wide accumulator and
+    // folding its high bits into the low ones, as both are congruent modulo 2^32 - 1 and only zero for zero input.
+    // Blocks are small enough to be summed on 32 bits without overflowing.
+    static constexpr size_t block_size = 1u << 24;
+    uint64_t sum = crc;
+    while (size > 0)
+    {
+        size_t count = size < block_size ? size : block_size;
+        uint32_t block_sum = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            block_sum += data[i];
+        }
+        sum += block_sum;
+        data += count;
+        size -= count;
+    }
+
+    while (sum >> 32)
+    {
+        sum = (sum & 0xffffffff) + (sum >> 32);
+    }
+    return static_cast<uint32_t>(sum);
+}
+
 void RTCPMessageManager::fillHeaders(
         TCPCPMKind kind,
         const TCPTransactionId& transaction_id,
@@ -219,35 +249,16 @@ void RTCPMessageManager::fillHeaders(
     uint32_t crc = 0;
     if (alive() && mTransport->configuration()->calculate_crc)
     {
-        octet* it = (octet*)&retCtrlHeader;
-        for (size_t i = 0; i < TCPControlMsgHeader::size(); ++i)
-        {
-            crc = addToCRC(crc, it[i]);
-        }
+        crc = addToCRC(crc, (octet*)&retCtrlHeader, TCPControlMsgHeader::size());
         if (respCode != nullptr)
         {
-            it = (octet*)respCode;
-            for (int i = 0; i < 4; ++i)
-            {
-                crc = addToCRC(crc, it[i]);
-            }
+            crc = addToCRC(crc, (octet*)respCode, 4);
         }
         if (payload != nullptr)
         {
-            octet* pay = (octet*)&(payload->encapsulation);
-            for (uint32_t i = 0; i < 2; ++i)
-            {
-                crc = addToCRC(crc, pay[i]);
-            }
-            pay = (octet*)&(payload->length);
-            for (uint32_t i = 0; i < 4; ++i)
-            {
-                crc = addToCRC(crc, pay[i]);
-            }
-            for (uint32_t i = 0; i < payload->length; ++i)
-            {
-                crc = addToCRC(crc, payload->data[i]);
-            }
+            crc = addToCRC(crc, (octet*)&(payload->encapsulation), 2);
+            crc = addToCRC(crc, (octet*)&(payload->length), 4);
+            crc = addToCRC(crc, payload->data, payload->length);
         }
     }
     header.crc = crc;
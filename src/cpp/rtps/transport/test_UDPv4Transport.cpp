@@ -29,6 +29,8 @@ using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using SubmessageHeader_t = fastrtps::rtps::SubmessageHeader_t;
 using SequenceNumber_t = fastrtps::rtps::SequenceNumber_t;
 using EntityId_t = fastrtps::rtps::EntityId_t;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
+using NetworkBuffers = fastrtps::rtps::NetworkBuffers;
 
 std::vector<std::vector<octet>> test_UDPv4Transport::test_UDPv4Transport_DropLog;
 uint32_t test_UDPv4Transport::test_UDPv4Transport_DropLogLength = 0;
@@ -136,9 +138,10 @@ void test_UDPv4Transport::get_ips(
 }
 
 bool test_UDPv4Transport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         eProsimaUDPSocket& socket,
+        SocketSendState& send_state,
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
@@ -148,18 +151,29 @@ bool test_UDPv4Transport::send(
 
     bool ret = true;
 
+    configure_send_timeout(socket, send_state, std::chrono::duration_cast<std::chrono::microseconds>(
+                max_blocking_time_point - std::chrono::steady_clock::now()));
+
+    // Filters need the whole message on a single buffer
+    std::vector<octet> flat_buffer;
+    flat_buffer.reserve(total_bytes);
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        flat_buffer.insert(flat_buffer.end(), buffer.buffer, buffer.buffer + buffer.size);
+    }
+
     while (it != *destination_locators_end)
     {
         auto now = std::chrono::steady_clock::now();
 
         if (now < max_blocking_time_point)
         {
-            ret &= send(send_buffer,
-                            send_buffer_size,
+            ret &= send(buffers,
+                            total_bytes,
+                            flat_buffer,
                             socket,
                             *it,
-                            only_multicast_purpose,
-                            std::chrono::duration_cast<std::chrono::microseconds>(now - max_blocking_time_point));
+                            only_multicast_purpose);
 
             ++it;
         }
@@ -174,22 +188,21 @@ bool test_UDPv4Transport::send(
 }
 
 bool test_UDPv4Transport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
+        const std::vector<octet>& flat_buffer,
         eProsimaUDPSocket& socket,
         const Locator_t& remote_locator,
-        bool only_multicast_purpose,
-        const std::chrono::microseconds& timeout)
+        bool only_multicast_purpose)
 {
-    if (packet_should_drop(send_buffer, send_buffer_size))
+    if (packet_should_drop(flat_buffer.data(), total_bytes))
     {
-        log_drop(send_buffer, send_buffer_size);
+        log_drop(flat_buffer.data(), total_bytes);
         return true;
     }
     else
     {
-        return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose,
-                       timeout);
+        return UDPv4Transport::send(buffers, total_bytes, socket, remote_locator, only_multicast_purpose);
     }
 }
 
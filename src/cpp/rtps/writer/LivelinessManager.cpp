@@ -2,6 +2,8 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 using namespace std::chrono;
 
@@ -18,6 +20,8 @@ LivelinessManager::LivelinessManager(
     : callback_(callback)
     , manage_automatic_(manage_automatic)
     , writers_()
+    , automatic_assertion_(std::make_shared<LivelinessAssertion>())
+    , manual_by_participant_assertion_(std::make_shared<LivelinessAssertion>())
     , mutex_()
     , timer_owner_(nullptr)
     , timer_(
@@ -60,7 +64,22 @@ bool LivelinessManager::add_writer(
             return true;
         }
     }
-    writers_.emplace_back(guid, kind, lease_duration);
+
+    LivelinessData* writer = writers_.emplace_back(guid, kind, lease_duration);
+    if (writer == nullptr)
+    {
+        return false;
+    }
+
+    // The new writer has not been asserted yet, so its group cannot be asserted without locking
+    writer->assertion = assertion_for(kind);
+    writer->assertion->all_alive.store(false);
+
+    // Adding a writer may have moved the one owning the timer
+    if (timer_owner_ != nullptr)
+    {
+        calculate_next();
+    }
     return true;
 }
 
@@ -79,41 +98,49 @@ bool LivelinessManager::remove_writer(
         {
             if (--writer.count == 0)
             {
+                LivelinessData removed = writer;
                 writers_.remove(writer);
 
+                if (removed.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+                {
+                    // Assertions cached by the caller should not be done without locking anymore
+                    removed.assertion->all_alive.store(false);
+                }
+
                 if (callback_ != nullptr)
                 {
-                    if (writer.status == LivelinessData::WriterStatus::ALIVE)
+                    if (removed.status == LivelinessData::WriterStatus::ALIVE)
                     {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
+                        callback_(removed.guid,
+                                removed.kind,
+                                removed.lease_duration,
                                 -1,
                                 0);
                     }
-                    else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
+                    else if (removed.status == LivelinessData::WriterStatus::NOT_ALIVE)
                     {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
+                        callback_(removed.guid,
+                                removed.kind,
+                                removed.lease_duration,
                                 0,
                                 -1);
                     }
                 }
 
-                if (timer_owner_ != nullptr && timer_owner_->guid == guid)
+                update_assertions();
+
+                // Removing a writer may have moved the one owning the timer
+                if (timer_owner_ != nullptr)
                 {
-                    timer_owner_ = nullptr;
+                    update_times_from_assertions();
                     if (!calculate_next())
                     {
                         timer_.cancel_timer();
                         return true;
                     }
 
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+                    timer_.cancel_timer();
+                    update_timer_interval();
                     timer_.restart_timer();
                 }
                 return true;
@@ -129,6 +156,28 @@ bool LivelinessManager::assert_liveliness(
         LivelinessQosPolicyKind kind,
         Duration_t lease_duration)
 {
+    std::shared_ptr<LivelinessAssertion> assertion;
+    return assert_liveliness(guid, kind, lease_duration, assertion);
+}
+
+bool LivelinessManager::assert_liveliness(
+        GUID_t guid,
+        LivelinessQosPolicyKind kind,
+        Duration_t lease_duration,
+        std::shared_ptr<LivelinessAssertion>& assertion)
+{
+    if (assertion && assertion->all_alive.load())
+    {
+        assertion->time_ns.store(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+
+        // The timer stops assertions without locking before checking their time, so if it is still possible
+        // the time stored above will be taken into account
+        if (assertion->all_alive.load())
+        {
+            return true;
+        }
+    }
+
     std::unique_lock<std::mutex> lock(mutex_);
 
     ResourceLimitedVector<LivelinessData>::iterator wit;
@@ -141,82 +190,171 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    timer_.cancel_timer();
+    assertion = wit->assertion;
+    return assert_liveliness_nts(*wit);
+}
+
+bool LivelinessManager::assert_liveliness(
+        LivelinessQosPolicyKind kind)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (!manage_automatic_ && kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    {
+        logWarning(RTPS_WRITER, "Liveliness manager not managing automatic writers, writer not added");
+        return false;
+    }
+
+    if (writers_.empty())
+    {
+        return true;
+    }
+
+    steady_clock::time_point now = steady_clock::now();
+    bool status_changed = false;
+    for (LivelinessData& writer: writers_)
+    {
+        if (writer.kind == kind)
+        {
+            status_changed |= assert_writer_liveliness(writer, now);
+        }
+    }
+
+    // Updates the timer owner
+    if (!restart_timer_if_needed(status_changed))
+    {
+        logInfo(RTPS_WRITER,
+                "Error when restarting liveliness timer: " << writers_.size() << " writers, liveliness " <<
+                kind);
+        return false;
+    }
+
+    return true;
+}
+
+bool LivelinessManager::assert_liveliness_nts(
+        LivelinessData& writer)
+{
+    steady_clock::time_point now = steady_clock::now();
+    bool status_changed = false;
 
-    if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-            wit->kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+            writer.kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
         for (LivelinessData& w: writers_)
         {
-            if (w.kind == wit->kind)
+            if (w.kind == writer.kind)
             {
-                assert_writer_liveliness(w);
+                status_changed |= assert_writer_liveliness(w, now);
             }
         }
     }
-    else if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    else if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
-        assert_writer_liveliness(*wit);
+        status_changed = assert_writer_liveliness(writer, now);
     }
 
     // Updates the timer owner
-    if (!calculate_next())
+    if (!restart_timer_if_needed(status_changed))
     {
         logError(RTPS_WRITER, "Error when restarting liveliness timer");
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
-
     return true;
 }
 
-bool LivelinessManager::assert_liveliness(
-        LivelinessQosPolicyKind kind)
+bool LivelinessManager::restart_timer_if_needed(
+        bool status_changed)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    if (!manage_automatic_ && kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
-    {
-        logWarning(RTPS_WRITER, "Liveliness manager not managing automatic writers, writer not added");
-        return false;
-    }
-
-    if (writers_.empty())
+    if (!status_changed && timer_owner_ != nullptr)
     {
+        // The timer is already running and, as no writer has changed its status, it cannot expire later than
+        // any of them. It will check the new expiration times when it expires.
         return true;
     }
 
     timer_.cancel_timer();
 
-    for (LivelinessData& writer: writers_)
+    if (status_changed)
     {
-        if (writer.kind == kind)
-        {
-            assert_writer_liveliness(writer);
-        }
+        update_assertions();
     }
 
-    // Updates the timer owner
+    update_times_from_assertions();
     if (!calculate_next())
     {
-        logInfo(RTPS_WRITER,
-                "Error when restarting liveliness timer: " << writers_.size() << " writers, liveliness " <<
-                kind);
         return false;
     }
 
+    update_timer_interval();
+    timer_.restart_timer();
+    return true;
+}
+
+void LivelinessManager::update_timer_interval()
+{
     // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    // Once in this situation there is not much we can do but let the timer expire inmediately
     auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
+    timer_.update_interval_millisec(duration_cast<duration<double, std::milli>>(interval).count());
+}
 
-    return true;
+void LivelinessManager::update_times_from_assertions()
+{
+    for (LivelinessData& writer : writers_)
+    {
+        if (writer.status == LivelinessData::WriterStatus::ALIVE)
+        {
+            steady_clock::time_point time(nanoseconds(writer.assertion->time_ns.load()) +
+                    nanoseconds(writer.lease_duration.to_ns()));
+            if (writer.time < time)
+            {
+                writer.time = time;
+            }
+        }
+    }
+}
+
+void LivelinessManager::update_assertions()
+{
+    std::vector<std::pair<LivelinessAssertion*, bool>> groups;
+    for (const LivelinessData& writer : writers_)
+    {
+        bool alive = writer.status == LivelinessData::WriterStatus::ALIVE;
+        auto it = std::find_if(groups.begin(), groups.end(),
+                        [&writer](const std::pair<LivelinessAssertion*, bool>& group)
+                        {
+                            return group.first == writer.assertion.get();
+                        });
+        if (it == groups.end())
+        {
+            groups.emplace_back(writer.assertion.get(), alive);
+        }
+        else
+        {
+            it->second = it->second && alive;
+        }
+    }
+
+    for (const std::pair<LivelinessAssertion*, bool>& group : groups)
+    {
+        group.first->all_alive.store(group.second);
+    }
+}
+
+std::shared_ptr<LivelinessAssertion> LivelinessManager::assertion_for(
+        LivelinessQosPolicyKind kind) const
+{
+    switch (kind)
+    {
+        case LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS:
+            return automatic_assertion_;
+        case LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS:
+            return manual_by_participant_assertion_;
+        default:
+            return std::make_shared<LivelinessAssertion>();
+    }
 }
 
 bool LivelinessManager::calculate_next()
@@ -253,22 +391,29 @@ bool LivelinessManager::timer_expired()
         return false;
     }
 
-    if (callback_ != nullptr)
+    // Assertions of the group of the timer owner are done with the lock from now on, so the time of the last
+    // assertion done without it is known
+    timer_owner_->assertion->all_alive.store(false);
+    update_times_from_assertions();
+
+    if (timer_owner_->time <= steady_clock::now())
     {
-        callback_(timer_owner_->guid,
-                timer_owner_->kind,
-                timer_owner_->lease_duration,
-                -1,
-                1);
+        if (callback_ != nullptr)
+        {
+            callback_(timer_owner_->guid,
+                    timer_owner_->kind,
+                    timer_owner_->lease_duration,
+                    -1,
+                    1);
+        }
+        timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
     }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
+
+    update_assertions();
 
     if (calculate_next())
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+        update_timer_interval();
         return true;
     }
 
@@ -309,9 +454,12 @@ bool LivelinessManager::is_any_alive(
     return false;
 }
 
-void LivelinessManager::assert_writer_liveliness(
-        LivelinessData& writer)
+bool LivelinessManager::assert_writer_liveliness(
+        LivelinessData& writer,
+        const steady_clock::time_point& now)
 {
+    bool status_changed = writer.status != LivelinessData::WriterStatus::ALIVE;
+
     if (callback_ != nullptr)
     {
         if (writer.status == LivelinessData::WriterStatus::NOT_ASSERTED)
@@ -333,7 +481,8 @@ void LivelinessManager::assert_writer_liveliness(
     }
 
     writer.status = LivelinessData::WriterStatus::ALIVE;
-    writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    writer.time = now + nanoseconds(writer.lease_duration.to_ns());
+    return status_changed;
 }
 
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
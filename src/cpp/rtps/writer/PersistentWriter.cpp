@@ -43,8 +43,10 @@ PersistentWriter::PersistentWriter(
     ss << p_guid;
     persistence_guid_ = ss.str();
 
-    persistence_->load_writer_from_storage(persistence_guid_, guid, hist->m_changes,
+    std::vector<CacheChange_t*> changes;
+    persistence_->load_writer_from_storage(persistence_guid_, guid, changes,
             change_pool, payload_pool, hist->m_lastCacheChangeSeqNum);
+    hist->m_changes.assign(changes.begin(), changes.end());
 
     // Update history state after loading from DB
     hist->m_isHistoryFull =
@@ -21,9 +21,11 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
 
+#include <rtps/DataSharing/WriterPool.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/flowcontrol/FlowController.h>
@@ -111,6 +113,19 @@ void RTPSWriter::init(
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
 
+    std::shared_ptr<WriterPool> datasharing_pool = std::dynamic_pointer_cast<WriterPool>(payload_pool);
+    if (datasharing_pool)
+    {
+        if (datasharing_pool->init_shared_memory(m_guid))
+        {
+            datasharing_pool_ = datasharing_pool;
+        }
+        else
+        {
+            logError(RTPS_WRITER, "Could not initialize data-sharing pool of writer " << m_guid);
+        }
+    }
+
     logInfo(RTPS_WRITER, "RTPSWriter created");
 }
 
@@ -341,14 +356,33 @@ const std::vector<GUID_t>& RTPSWriter::remote_guids() const
     return all_remote_readers_;
 }
 
+uint32_t RTPSWriter::max_message_size() const
+{
+    RTPSParticipantImpl* participant = getRTPSParticipant();
+    uint32_t max_size = 0;
+
+    locator_selector_.for_each([participant, &max_size](const Locator_t& locator)
+            {
+                uint32_t locator_max_size = participant->get_max_message_size(locator);
+                if (0 == max_size || locator_max_size < max_size)
+                {
+                    max_size = locator_max_size;
+                }
+            });
+
+    return max_size;
+}
+
 bool RTPSWriter::send(
-        CDRMessage_t* message,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     RTPSParticipantImpl* participant = getRTPSParticipant();
 
     return locator_selector_.selected_size() == 0 ||
-           participant->sendSync(message, locator_selector_.begin(), locator_selector_.end(), max_blocking_time_point);
+           participant->sendSync(buffers, total_bytes, locator_selector_.begin(), locator_selector_.end(),
+                   max_blocking_time_point);
 }
 
 const LivelinessQosPolicyKind& RTPSWriter::get_liveliness_kind() const
@@ -366,6 +400,20 @@ const Duration_t& RTPSWriter::get_liveliness_announcement_period() const
     return liveliness_announcement_period_;
 }
 
+bool RTPSWriter::is_datasharing_compatible() const
+{
+    return static_cast<bool>(datasharing_pool_);
+}
+
+bool RTPSWriter::is_datasharing_compatible_with(
+        const ReaderProxyData& rdata) const
+{
+    return datasharing_pool_ &&
+           m_guid.is_on_same_host_as(rdata.guid()) &&
+           !m_guid.is_on_same_process_as(rdata.guid()) &&
+           DataSharingPayloadPool::is_enabled(rdata.properties());
+}
+
 }  // namespace rtps
 }  // namespace fastrtps
 }  // namespace eprosima
@@ -23,6 +23,7 @@
 #include <fastdds/rtps/writer/StatelessWriter.h>
 #include <fastdds/rtps/common/LocatorListComparisons.hpp>
 
+#include <rtps/DataSharing/DataSharingNotification.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include "rtps/RTPSDomainImpl.hpp"
 
@@ -40,6 +41,7 @@ ReaderLocator::ReaderLocator(
     , expects_inline_qos_(false)
     , is_local_reader_(false)
     , local_reader_(nullptr)
+    , is_datasharing_reader_(false)
     , guid_prefix_as_vector_(1u)
     , guid_as_vector_(1u)
 {
@@ -49,7 +51,8 @@ bool ReaderLocator::start(
         const GUID_t& remote_guid,
         const ResourceLimitedVector<Locator_t>& unicast_locators,
         const ResourceLimitedVector<Locator_t>& multicast_locators,
-        bool expects_inline_qos)
+        bool expects_inline_qos,
+        bool is_datasharing)
 {
     if (locator_info_.remote_guid == c_Guid_Unknown)
     {
@@ -60,6 +63,24 @@ bool ReaderLocator::start(
 
         is_local_reader_ = RTPSDomainImpl::should_intraprocess_between(owner_->getGuid(), remote_guid);
         local_reader_ = nullptr;
+        is_datasharing_reader_ = false;
+
+        // Data-sharing readers are served like local ones, through the writer's shared memory pool,
+        // but reliable ones acknowledge the changes with ACKNACKs once they have consumed them.
+        // If the reader cannot be notified, fall back to sending the changes through the transports.
+        if (!is_local_reader_ && is_datasharing)
+        {
+            datasharing_notifier_ = std::make_shared<DataSharingNotification>();
+            if (datasharing_notifier_->open(remote_guid))
+            {
+                is_local_reader_ = true;
+                is_datasharing_reader_ = true;
+            }
+            else
+            {
+                datasharing_notifier_.reset();
+            }
+        }
 
         if (!is_local_reader_)
         {
@@ -119,26 +140,51 @@ bool ReaderLocator::stop(
         expects_inline_qos_ = false;
         is_local_reader_ = false;
         local_reader_ = nullptr;
+        is_datasharing_reader_ = false;
+        datasharing_notifier_.reset();
         return true;
     }
 
     return false;
 }
 
+uint32_t ReaderLocator::max_message_size() const
+{
+    uint32_t max_size = 0;
+
+    if (locator_info_.remote_guid != c_Guid_Unknown && !is_local_reader_)
+    {
+        // Same locators used by send
+        const ResourceLimitedVector<Locator_t>& locators =
+                locator_info_.unicast.size() > 0 ? locator_info_.unicast : locator_info_.multicast;
+        for (const Locator_t& locator : locators)
+        {
+            uint32_t locator_max_size = participant_owner_->get_max_message_size(locator);
+            if (0 == max_size || locator_max_size < max_size)
+            {
+                max_size = locator_max_size;
+            }
+        }
+    }
+
+    return max_size;
+}
+
 bool ReaderLocator::send(
-        CDRMessage_t* message,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     if (locator_info_.remote_guid != c_Guid_Unknown && !is_local_reader_)
     {
         if (locator_info_.unicast.size() > 0)
         {
-            return participant_owner_->sendSync(message, Locators(locator_info_.unicast.begin()),
+            return participant_owner_->sendSync(buffers, total_bytes, Locators(locator_info_.unicast.begin()),
                            Locators(locator_info_.unicast.end()), max_blocking_time_point);
         }
         else
         {
-            return participant_owner_->sendSync(message, Locators(locator_info_.multicast.begin()),
+            return participant_owner_->sendSync(buffers, total_bytes, Locators(locator_info_.multicast.begin()),
                            Locators(locator_info_.multicast.end()), max_blocking_time_point);
         }
     }
@@ -148,13 +194,21 @@ bool ReaderLocator::send(
 
 RTPSReader* ReaderLocator::local_reader()
 {
-    if (!local_reader_)
+    if (!local_reader_ && !is_datasharing_reader_)
     {
         local_reader_ = RTPSDomainImpl::find_local_reader(locator_info_.remote_guid);
     }
     return local_reader_;
 }
 
+void ReaderLocator::datasharing_notify()
+{
+    if (datasharing_notifier_)
+    {
+        datasharing_notifier_->notify();
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -106,13 +106,15 @@ ReaderProxy::~ReaderProxy()
 }
 
 void ReaderProxy::start(
-        const ReaderProxyData& reader_attributes)
+        const ReaderProxyData& reader_attributes,
+        bool is_datasharing)
 {
     locator_info_.start(
         reader_attributes.guid(),
         reader_attributes.remote_locators().unicast,
         reader_attributes.remote_locators().multicast,
-        reader_attributes.m_expectsInlineQos);
+        reader_attributes.m_expectsInlineQos,
+        is_datasharing);
 
     is_active_ = true;
     durability_kind_ = reader_attributes.m_qos.m_durability.durabilityKind();
@@ -165,6 +167,8 @@ void ReaderProxy::stop()
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
+    replay_next_ = SequenceNumber_t();
+    replay_end_ = SequenceNumber_t();
 }
 
 void ReaderProxy::disable_timers()
@@ -237,15 +241,72 @@ void ReaderProxy::add_change(
     }
 }
 
+void ReaderProxy::start_replay(
+        const SequenceNumber_t& first,
+        const SequenceNumber_t& end)
+{
+    replay_next_ = std::max(first, changes_low_mark_ + 1);
+    replay_end_ = end;
+}
+
+void ReaderProxy::add_replayed_change(
+        const ChangeForReader_t& change)
+{
+    assert(change.getSequenceNumber() >= replay_next_);
+    assert(change.getSequenceNumber() < replay_end_);
+
+    replay_next_ = change.getSequenceNumber() + 1;
+
+    // Irrelevant changes are not added to the collection
+    if (!change.isRelevant())
+    {
+        return;
+    }
+
+    // Changes added while replaying the history follow the replayed ones, so keep the collection sorted
+    ChangeIterator position = find_change(change.getSequenceNumber(), false);
+    size_t index = std::distance(changes_for_reader_.begin(), position);
+    if (changes_for_reader_.push_back(change) == nullptr)
+    {
+        // This should never happen
+        logError(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
+                                                           << " to reader proxy " << guid());
+        eprosima::fastdds::dds::Log::Flush();
+        assert(false);
+        return;
+    }
+    std::rotate(changes_for_reader_.begin() + index, changes_for_reader_.end() - 1, changes_for_reader_.end());
+}
+
+void ReaderProxy::replayed_up_to(
+        const SequenceNumber_t& seq_num)
+{
+    if (seq_num > replay_next_)
+    {
+        replay_next_ = seq_num;
+    }
+}
+
 bool ReaderProxy::has_changes() const
 {
-    return !changes_for_reader_.empty();
+    return !changes_for_reader_.empty() || replay_pending();
 }
 
 bool ReaderProxy::change_is_acked(
         const SequenceNumber_t& seq_num) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_)
+    {
+        return true;
+    }
+
+    if (replay_next_ <= seq_num && seq_num < replay_end_)
+    {
+        // Not replayed yet
+        return false;
+    }
+
+    if (changes_for_reader_.empty())
     {
         return true;
     }
@@ -368,6 +429,12 @@ void ReaderProxy::acked_changes_set(
         }
     }
     changes_low_mark_ = future_low_mark - 1;
+
+    // The reader already has the changes of the history up to the low mark
+    if (replay_next_ <= changes_low_mark_)
+    {
+        replay_next_ = changes_low_mark_ + 1;
+    }
 }
 
 bool ReaderProxy::requested_changes_set(
@@ -554,6 +621,11 @@ void ReaderProxy::change_has_been_removed(
 
 bool ReaderProxy::has_unacknowledged() const
 {
+    if (replay_pending())
+    {
+        return true;
+    }
+
     for (const ChangeForReader_t& it : changes_for_reader_)
     {
         if (it.getStatus() == UNACKNOWLEDGED)
@@ -644,9 +716,11 @@ ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
 
 bool ReaderProxy::are_there_gaps()
 {
+    // Changes pending to be replayed are not gaps
+    uint64_t pending_replay = replay_pending() ? replay_end_.to64long() - replay_next_.to64long() : 0u;
     return (0 < changes_for_reader_.size() &&
-           changes_low_mark_ + uint32_t(changes_for_reader_.size()) !=
-           changes_for_reader_.rbegin()->getSequenceNumber());
+           changes_low_mark_.to64long() + changes_for_reader_.size() + pending_replay !=
+           changes_for_reader_.rbegin()->getSequenceNumber().to64long());
 }
 
 void ReaderProxy::send_gaps(
@@ -661,24 +735,24 @@ void ReaderProxy::send_gaps(
                     (0 < changes_for_reader_.size() && next_seq != changes_for_reader_.rbegin()->getSequenceNumber()))
             {
                 RTPSGapBuilder gap_builder(group);
-                SequenceNumber_t current_seq = changes_low_mark_ + 1;
+                SequenceNumber_t current_seq = skip_pending_replay(changes_low_mark_ + 1);
 
                 for (ReaderProxy::ChangeConstIterator cit = changes_for_reader_.begin();
                         cit != changes_for_reader_.end(); ++cit)
                 {
                     SequenceNumber_t seq_num = cit->getSequenceNumber();
-                    while (current_seq != seq_num)
+                    while (current_seq < seq_num)
                     {
                         gap_builder.add(current_seq);
-                        ++current_seq;
+                        current_seq = skip_pending_replay(current_seq + 1);
                     }
-                    ++current_seq;
+                    current_seq = skip_pending_replay(seq_num + 1);
                 }
 
                 while (current_seq < next_seq)
                 {
                     gap_builder.add(current_seq);
-                    ++current_seq;
+                    current_seq = skip_pending_replay(current_seq + 1);
                 }
             }
         }
@@ -25,6 +25,7 @@
 
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/flowcontrol/FlowController.h>
+#include <rtps/DataSharing/WriterPool.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
@@ -62,11 +63,13 @@ bool send_data_or_fragments(
         RTPSMessageGroup& group,
         CacheChange_t* change,
         bool inline_qos,
-        UnaryFun sent_fun)
+        UnaryFun sent_fun,
+        bool allow_unfragmented = false)
 {
     bool sent_ok = true;
 
-    if (change->getFragmentSize() > 0)
+    // Transports allowing big messages may carry the whole change on a single DATA
+    if (change->getFragmentSize() > 0 && !(allow_unfragmented && group.fits_unfragmented(*change)))
     {
         for (FragmentNumber_t frag = 1; frag <= change->getFragmentCount(); frag++)
         {
@@ -205,6 +208,8 @@ void StatefulWriter::init(
 {
     const RTPSParticipantAttributes& part_att = pimpl->getRTPSParticipantAttributes();
 
+    late_joiner_replay_budget_ = att.late_joiner_replay_budget;
+
     periodic_hb_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
                     {
                         return send_periodic_heartbeat();
@@ -254,6 +259,11 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    for (auto& controller : mp_RTPSParticipant->getFlowControllers())
+    {
+        controller->unregister_writer(this);
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -297,12 +307,18 @@ void StatefulWriter::unsent_change_added_to_history(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    if (datasharing_pool_)
+    {
+        datasharing_pool_->add_to_shared_history(change);
+    }
+
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
         mp_RTPSParticipant->wlp()->assert_liveliness(
             getGuid(),
             liveliness_kind_,
-            liveliness_lease_duration_);
+            liveliness_lease_duration_,
+            liveliness_assertion_);
     }
 
     if (!matched_readers_.empty())
@@ -368,7 +384,9 @@ void StatefulWriter::unsent_change_added_to_history(
                                     }
                                 };
 
-                        send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
+                        // Only synchronous sending avoids fragmentation, asynchronous writers keep sending
+                        // the changes fragment by fragment
+                        send_data_or_fragments(group, change, expectsInlineQos, sent_fun, true);
                         send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
                     }
 
@@ -484,6 +502,14 @@ bool StatefulWriter::intraprocess_delivery(
         CacheChange_t* change,
         ReaderProxy* reader_proxy)
 {
+    if (reader_proxy->is_datasharing_reader())
+    {
+        // The change is already on the shared history, the reader only needs to be woken up.
+        // Reliable readers use the payload in place, so they acknowledge the change once they have consumed it.
+        reader_proxy->datasharing_notify();
+        return !reader_proxy->is_reliable();
+    }
+
     RTPSReader* reader = reader_proxy->local_reader();
     if (reader)
     {
@@ -515,6 +541,12 @@ bool StatefulWriter::intraprocess_heartbeat(
 {
     bool returned_value = false;
 
+    if (reader_proxy->is_datasharing_reader())
+    {
+        // Data-sharing readers learn the available changes from the shared history
+        return returned_value;
+    }
+
     std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
     RTPSReader* reader = RTPSDomainImpl::find_local_reader(reader_proxy->guid());
 
@@ -588,6 +620,9 @@ void StatefulWriter::send_any_unsent_changes()
     bool activateHeartbeatPeriod = false;
     SequenceNumber_t max_sequence = mp_history->next_sequence_number();
 
+    // The next batch of the history replayed to late joiners is sent along with the unsent changes
+    bool replay_pending = replay_history_to_readers();
+
     if (!m_pushMode || mp_history->getHistorySize() == 0 || matched_readers_.empty())
     {
         send_heartbeat_to_all_readers();
@@ -614,6 +649,11 @@ void StatefulWriter::send_any_unsent_changes()
         periodic_hb_event_->restart_timer();
     }
 
+    if (replay_pending)
+    {
+        mp_RTPSParticipant->async_thread().wake_up(this);
+    }
+
     // On VOLATILE writers, remove auto-acked (best effort readers) changes
     check_acked_status();
 
@@ -659,6 +699,84 @@ void StatefulWriter::send_heartbeat_to_all_readers()
     }
 }
 
+bool StatefulWriter::replay_history_to_readers()
+{
+    bool replay_pending = false;
+
+    for (ReaderProxy* reader : matched_readers_)
+    {
+        if (!reader->replay_pending())
+        {
+            continue;
+        }
+
+        SequenceNumber_t current_seq = reader->replay_next();
+        SequenceNumber_t end_seq = reader->replay_end();
+        uint32_t replayed_size = 0;
+        bool any_replayed = false;
+
+        try
+        {
+            RTPSMessageGroup group(mp_RTPSParticipant, this, reader->message_sender());
+            RTPSGapBuilder gap_builder(group);
+
+            CacheChange_t* change = nullptr;
+            History::const_iterator cit = mp_history->get_change_nts(current_seq, m_guid, &change,
+                            mp_history->changesBegin());
+            // At least one change is replayed on each turn, so the replay always progresses
+            for (; cit != mp_history->changesEnd() && (*cit)->sequenceNumber < end_seq &&
+                    (!any_replayed || replayed_size < late_joiner_replay_budget_); ++cit)
+            {
+                // This is to cover the case when there are holes in the history
+                while (current_seq != (*cit)->sequenceNumber)
+                {
+                    gap_builder.add(current_seq);
+                    ++current_seq;
+                }
+
+                ChangeForReader_t changeForReader(*cit);
+                if (!m_pushMode)
+                {
+                    changeForReader.setStatus(UNACKNOWLEDGED);
+                }
+                changeForReader.setRelevance(reader->rtps_is_relevant(*cit));
+                if (changeForReader.isRelevant())
+                {
+                    replayed_size += (*cit)->serializedPayload.length;
+                    any_replayed = true;
+                }
+                else
+                {
+                    gap_builder.add(current_seq);
+                }
+                reader->add_replayed_change(changeForReader);
+                ++current_seq;
+            }
+
+            // This is to cover the case where the last changes of the replay have been removed from the history
+            if (cit == mp_history->changesEnd() || (*cit)->sequenceNumber >= end_seq)
+            {
+                while (current_seq < end_seq)
+                {
+                    gap_builder.add(current_seq);
+                    ++current_seq;
+                }
+            }
+
+            reader->replayed_up_to(current_seq);
+            gap_builder.flush();
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+
+        replay_pending |= reader->replay_pending();
+    }
+
+    return replay_pending;
+}
+
 void StatefulWriter::send_changes_separatedly(
         SequenceNumber_t max_sequence,
         bool& activateHeartbeatPeriod)
@@ -1335,7 +1453,7 @@ bool StatefulWriter::matched_reader_add(
     }
 
     // Add info of new datareader.
-    rp->start(rdata);
+    rp->start(rdata, is_datasharing_compatible_with(rdata));
     locator_selector_.add_entry(rp->locator_selector_entry());
     matched_readers_.push_back(rp);
     update_reader_info(true);
@@ -1355,7 +1473,19 @@ bool StatefulWriter::matched_reader_add(
     SequenceNumber_t current_seq = get_seq_num_min();
     SequenceNumber_t last_seq = get_seq_num_max();
 
-    if (current_seq != SequenceNumber_t::unknown())
+    if (current_seq != SequenceNumber_t::unknown() && rp->is_remote_and_reliable() && !rp->is_datasharing_reader() &&
+            rp->durability_kind() >= TRANSIENT_LOCAL && m_att.durabilityKind >= TRANSIENT_LOCAL)
+    {
+        // The history is added to the reader in batches from the asynchronous thread, so the writer is not blocked
+        // while adding big histories
+        rp->start_replay(current_seq, next_sequence_number());
+        mp_RTPSParticipant->async_thread().wake_up(this);
+
+        // Always activate heartbeat period. We need a confirmation of the reader.
+        // The state has to be updated.
+        periodic_hb_event_->restart_timer();
+    }
+    else if (current_seq != SequenceNumber_t::unknown())
     {
         (void)last_seq;
         assert(last_seq != SequenceNumber_t::unknown());
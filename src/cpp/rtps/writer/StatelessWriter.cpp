@@ -34,6 +34,7 @@
 #include <vector>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <rtps/DataSharing/WriterPool.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/RTPSDomainImpl.hpp>
@@ -86,7 +87,7 @@ StatelessWriter::StatelessWriter(
         WriterListener* listener)
     : RTPSWriter(impl, guid, attributes, history, listener)
     , matched_readers_(attributes.matched_readers_allocation)
-    , late_joiner_guids_(attributes.matched_readers_allocation)
+    , late_joiners_(attributes.matched_readers_allocation)
     , unsent_changes_(resource_limits_from_history(history->m_att))
     , last_intraprocess_sequence_number_(0)
 {
@@ -102,7 +103,7 @@ StatelessWriter::StatelessWriter(
         WriterListener* listener)
     : RTPSWriter(impl, guid, attributes, payload_pool, history, listener)
     , matched_readers_(attributes.matched_readers_allocation)
-    , late_joiner_guids_(attributes.matched_readers_allocation)
+    , late_joiners_(attributes.matched_readers_allocation)
     , unsent_changes_(resource_limits_from_history(history->m_att))
     , last_intraprocess_sequence_number_(0)
 {
@@ -119,7 +120,7 @@ StatelessWriter::StatelessWriter(
         WriterListener* listener)
     : RTPSWriter(participant, guid, attributes, payload_pool, change_pool, history, listener)
     , matched_readers_(attributes.matched_readers_allocation)
-    , late_joiner_guids_(attributes.matched_readers_allocation)
+    , late_joiners_(attributes.matched_readers_allocation)
     , unsent_changes_(resource_limits_from_history(history->m_att))
     , last_intraprocess_sequence_number_(0)
 {
@@ -131,6 +132,7 @@ void StatelessWriter::init(
         const WriterAttributes& attributes)
 {
     get_builtin_guid();
+    late_joiner_replay_budget_ = attributes.late_joiner_replay_budget;
 
     const RemoteLocatorsAllocationAttributes& loc_alloc =
             participant->getRTPSParticipantAttributes().allocation.locators;
@@ -152,6 +154,11 @@ StatelessWriter::~StatelessWriter()
         controller->disable();
     }
 
+    for (auto& controller : mp_RTPSParticipant->getFlowControllers())
+    {
+        controller->unregister_writer(this);
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -229,18 +236,31 @@ void StatelessWriter::unsent_change_added_to_history(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    if (datasharing_pool_)
+    {
+        datasharing_pool_->add_to_shared_history(change);
+    }
+
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
         mp_RTPSParticipant->wlp()->assert_liveliness(
             getGuid(),
             liveliness_kind_,
-            liveliness_lease_duration_);
+            liveliness_lease_duration_,
+            liveliness_assertion_);
     }
 
     if (!fixed_locators_.empty() || matched_readers_.size() > 0)
     {
         if (!isAsync())
         {
+            // Late joiners receive the change when the replay of the history reaches it
+            bool replaying = !late_joiners_.empty();
+            if (replaying)
+            {
+                select_up_to_date_readers();
+            }
+
             try
             {
                 if (m_separateSendingEnabled)
@@ -248,6 +268,11 @@ void StatelessWriter::unsent_change_added_to_history(
                     std::vector<GUID_t> guids(1);
                     for (ReaderLocator& it : matched_readers_)
                     {
+                        if (replaying && is_late_joiner(it.remote_guid()))
+                        {
+                            continue;
+                        }
+
                         if (it.is_local_reader())
                         {
                             intraprocess_delivery(change, it);
@@ -257,7 +282,7 @@ void StatelessWriter::unsent_change_added_to_history(
                             RTPSMessageGroup group(mp_RTPSParticipant, this, it, max_blocking_time);
 
                             uint32_t n_fragments = change->getFragmentCount();
-                            if (n_fragments > 0)
+                            if (n_fragments > 0 && !group.fits_unfragmented(*change))
                             {
                                 for (uint32_t frag = 1; frag <= n_fragments; frag++)
                                 {
@@ -282,7 +307,7 @@ void StatelessWriter::unsent_change_added_to_history(
                 {
                     for (ReaderLocator& it : matched_readers_)
                     {
-                        if (it.is_local_reader())
+                        if (it.is_local_reader() && !(replaying && is_late_joiner(it.remote_guid())))
                         {
                             intraprocess_delivery(change, it);
                         }
@@ -293,7 +318,7 @@ void StatelessWriter::unsent_change_added_to_history(
                         RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
 
                         uint32_t n_fragments = change->getFragmentCount();
-                        if (n_fragments > 0)
+                        if (n_fragments > 0 && !group.fits_unfragmented(*change))
                         {
                             for (uint32_t frag = 1; frag <= n_fragments; frag++)
                             {
@@ -323,6 +348,11 @@ void StatelessWriter::unsent_change_added_to_history(
             {
                 logError(RTPS_WRITER, "Max blocking time reached");
             }
+
+            if (replaying)
+            {
+                select_all_readers();
+            }
         }
         else
         {
@@ -344,6 +374,13 @@ bool StatelessWriter::intraprocess_delivery(
         CacheChange_t* change,
         ReaderLocator& reader_locator)
 {
+    if (reader_locator.is_datasharing_reader())
+    {
+        // The change is already on the shared history, the reader only needs to be woken up
+        reader_locator.datasharing_notify();
+        return true;
+    }
+
     RTPSReader* reader = reader_locator.local_reader();
 
     if (reader)
@@ -384,6 +421,12 @@ bool StatelessWriter::is_acked_by_all(
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+        // Return false if change is pending to be replayed to the late joiners
+        if (is_pending_replay(change->sequenceNumber))
+        {
+            return false;
+        }
+
         // Return false if change is pending to be sent
         auto it = std::find_if(unsent_changes_.begin(),
                         unsent_changes_.end(),
@@ -419,9 +462,10 @@ bool StatelessWriter::wait_for_acknowledgement(
             {
                 return seq == unsent_change.getSequenceNumber();
             };
-    auto change_is_acknowledged = [this, change_is_unsent]()
+    auto change_is_acknowledged = [this, seq, change_is_unsent]()
             {
-                return unsent_changes_.end() ==
+                return !is_pending_replay(seq) &&
+                       unsent_changes_.end() ==
                        std::find_if(unsent_changes_.begin(), unsent_changes_.end(), change_is_unsent);
             };
     return unsent_changes_cond_.wait_until(lock, max_blocking_time_point, change_is_acknowledged);
@@ -481,91 +525,65 @@ void StatelessWriter::send_all_unsent_changes()
 
     static constexpr uint32_t implicit_flow_controller_size = RTPSMessageGroup::get_max_fragment_payload_size();
 
-    NetworkFactory& network = mp_RTPSParticipant->network_factory();
-    RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
-    bool remote_destinations = locator_selector_.selected_size() > 0 || !fixed_locators_.empty();
-    bool bHasListener = mp_listener != nullptr;
-
-    uint32_t total_sent_size = 0;
-
-    // Select late-joiners only
-    if (!late_joiner_guids_.empty())
+    // Late joiners receive the changes when the replay of the history reaches them, so the changes arrive in order
+    bool replaying = !late_joiners_.empty();
+    if (replaying)
     {
-        ignore_fixed_locators_ = true;
-        locator_selector_.reset(false);
-        for (const GUID_t& guid : late_joiner_guids_)
-        {
-            locator_selector_.enable(guid);
-        }
-        network.select_locators(locator_selector_);
-        remote_destinations = locator_selector_.selected_size() > 0 || !fixed_locators_.empty();
-        if (!has_builtin_guid())
-        {
-            compute_selected_guids();
-        }
+        select_up_to_date_readers();
     }
 
-    while (!unsent_changes_.empty() && (total_sent_size < implicit_flow_controller_size))
     {
-        ChangeForReader_t& unsentChange = unsent_changes_.front();
-        CacheChange_t* cache_change = unsentChange.getChange();
+        RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+        bool remote_destinations = locator_selector_.selected_size() > 0 || !fixed_locators_.empty();
+        bool bHasListener = mp_listener != nullptr;
 
-        total_sent_size += cache_change->serializedPayload.length;
+        uint32_t total_sent_size = 0;
 
-        // Check if we finished with late-joiners only
-        if (!late_joiner_guids_.empty() &&
-                cache_change->sequenceNumber >= first_seq_for_all_readers_)
+        while (!unsent_changes_.empty() && (total_sent_size < implicit_flow_controller_size))
         {
-            ignore_fixed_locators_ = false;
-            late_joiner_guids_.clear();
-            locator_selector_.reset(true);
-            network.select_locators(locator_selector_);
-            remote_destinations = locator_selector_.selected_size() > 0 || !fixed_locators_.empty();
-            if (!has_builtin_guid())
+            ChangeForReader_t& unsentChange = unsent_changes_.front();
+            CacheChange_t* cache_change = unsentChange.getChange();
+
+            total_sent_size += cache_change->serializedPayload.length;
+
+            uint64_t sequence_number = cache_change->sequenceNumber.to64long();
+            // Filter intraprocess unsent changes
+            if (sequence_number > last_intraprocess_sequence_number_)
             {
-                compute_selected_guids();
+                last_intraprocess_sequence_number_ = sequence_number;
+                for (ReaderLocator& it : matched_readers_)
+                {
+                    if (it.is_local_reader() && !(replaying && is_late_joiner(it.remote_guid())))
+                    {
+                        intraprocess_delivery(cache_change, it);
+                    }
+                }
             }
-        }
 
-        uint64_t sequence_number = cache_change->sequenceNumber.to64long();
-        // Filter intraprocess unsent changes
-        if (sequence_number > last_intraprocess_sequence_number_)
-        {
-            last_intraprocess_sequence_number_ = sequence_number;
-            for (ReaderLocator& it : matched_readers_)
+            if (remote_destinations)
             {
-                if (it.is_local_reader())
+                if (!add_change_to_rtps_group(group, &unsentChange, is_inline_qos_expected_))
                 {
-                    intraprocess_delivery(cache_change, it);
+                    break;
                 }
             }
-        }
 
-        if (remote_destinations)
-        {
-            if (!add_change_to_rtps_group(group, &unsentChange, is_inline_qos_expected_))
+            unsent_changes_.erase(unsent_changes_.begin());
+            if (bHasListener)
             {
-                break;
+                mp_listener->onWriterChangeReceivedByAll(this, cache_change);
             }
         }
-
-        unsent_changes_.erase(unsent_changes_.begin());
-        if (bHasListener)
-        {
-            mp_listener->onWriterChangeReceivedByAll(this, cache_change);
-        }
     }
 
-    // Restore locator selector state
-    ignore_fixed_locators_ = false;
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    if (!has_builtin_guid())
+    if (replaying)
     {
-        compute_selected_guids();
+        select_all_readers();
     }
 
-    if (!unsent_changes_.empty())
+    replay_history_to_late_joiners();
+
+    if (!unsent_changes_.empty() || !late_joiners_.empty())
     {
         mp_RTPSParticipant->async_thread().wake_up(this);
     }
@@ -578,7 +596,8 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
     // There should be remote destinations
     assert(there_are_remote_readers_ || !fixed_locators_.empty());
 
-    NetworkFactory& network = mp_RTPSParticipant->network_factory();
+    // Late joiners receive the changes when the replay of the history reaches them, so the changes arrive in order
+    bool replaying = !late_joiners_.empty();
     bool flow_controllers_limited = false;
     while (!unsent_changes_.empty() && !flow_controllers_limited)
     {
@@ -596,7 +615,7 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
                 last_intraprocess_sequence_number_ = sequence_number;
                 for (ReaderLocator& it : matched_readers_)
                 {
-                    if (it.is_local_reader())
+                    if (it.is_local_reader() && !(replaying && is_late_joiner(it.remote_guid())))
                     {
                         intraprocess_delivery(cache_change, it);
                     }
@@ -621,44 +640,19 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
 
         flow_controllers_limited = n_items != changesToSend.size();
 
+        if (replaying)
+        {
+            select_up_to_date_readers();
+        }
+
         try
         {
             RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
 
-            // Select late-joiners only
-            if (!late_joiner_guids_.empty())
-            {
-                ignore_fixed_locators_ = true;
-                locator_selector_.reset(false);
-                for (const GUID_t& guid : late_joiner_guids_)
-                {
-                    locator_selector_.enable(guid);
-                }
-                network.select_locators(locator_selector_);
-                if (!has_builtin_guid())
-                {
-                    compute_selected_guids();
-                }
-            }
-
             while (!changesToSend.empty())
             {
                 RTPSWriterCollector<ReaderLocator*>::Item changeToSend = changesToSend.pop();
 
-                // Check if we finished with late-joiners only
-                if (!late_joiner_guids_.empty() &&
-                        changeToSend.sequenceNumber >= first_seq_for_all_readers_)
-                {
-                    ignore_fixed_locators_ = false;
-                    late_joiner_guids_.clear();
-                    locator_selector_.reset(true);
-                    network.select_locators(locator_selector_);
-                    if (!has_builtin_guid())
-                    {
-                        compute_selected_guids();
-                    }
-                }
-
                 // Remove the messages selected for sending from the original list,
                 // and update those that were fragmented with the new sent index
                 update_unsent_changes(changeToSend.sequenceNumber, changeToSend.fragmentNumber);
@@ -693,18 +687,283 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
         {
             logError(RTPS_WRITER, "Max blocking time reached");
         }
+
+        if (replaying)
+        {
+            select_all_readers();
+        }
+    }
+
+    if (!flow_controllers_limited && !late_joiners_.empty())
+    {
+        // When the flow controllers limit the replay, they wake up the writer again once they allow sending more
+        if (!replay_history_with_flow_control() && !late_joiners_.empty())
+        {
+            mp_RTPSParticipant->async_thread().wake_up(this);
+        }
     }
+}
 
-    // Restore locator selector state
+bool StatelessWriter::is_late_joiner(
+        const GUID_t& reader_guid) const
+{
+    return std::any_of(late_joiners_.begin(), late_joiners_.end(),
+                   [&reader_guid](const LateJoiner& late_joiner)
+                   {
+                       return late_joiner.guid == reader_guid;
+                   });
+}
+
+bool StatelessWriter::is_late_joiner_at(
+        const GUID_t& reader_guid,
+        const SequenceNumber_t& replay_next) const
+{
+    return std::any_of(late_joiners_.begin(), late_joiners_.end(),
+                   [&reader_guid, &replay_next](const LateJoiner& late_joiner)
+                   {
+                       return late_joiner.guid == reader_guid && late_joiner.replay_next == replay_next;
+                   });
+}
+
+bool StatelessWriter::is_pending_replay(
+        const SequenceNumber_t& seq) const
+{
+    return std::any_of(late_joiners_.begin(), late_joiners_.end(),
+                   [&seq](const LateJoiner& late_joiner)
+                   {
+                       return late_joiner.replay_next <= seq;
+                   });
+}
+
+void StatelessWriter::select_up_to_date_readers()
+{
+    ignore_fixed_locators_ = false;
+    locator_selector_.reset(false);
+    for (const ReaderLocator& reader : matched_readers_)
+    {
+        if (reader.remote_guid() != c_Guid_Unknown && !is_late_joiner(reader.remote_guid()))
+        {
+            locator_selector_.enable(reader.remote_guid());
+        }
+    }
+    mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+    if (!has_builtin_guid())
+    {
+        compute_selected_guids();
+    }
+}
+
+void StatelessWriter::select_late_joiners(
+        const SequenceNumber_t& replay_next)
+{
+    ignore_fixed_locators_ = true;
+    locator_selector_.reset(false);
+    for (const LateJoiner& late_joiner : late_joiners_)
+    {
+        if (late_joiner.replay_next == replay_next)
+        {
+            locator_selector_.enable(late_joiner.guid);
+        }
+    }
+    mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+    if (!has_builtin_guid())
+    {
+        compute_selected_guids();
+    }
+}
+
+void StatelessWriter::select_all_readers()
+{
     ignore_fixed_locators_ = false;
     locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
+    mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
     if (!has_builtin_guid())
     {
         compute_selected_guids();
     }
 }
 
+void StatelessWriter::late_joiners_replayed_up_to(
+        const SequenceNumber_t& replay_next,
+        const SequenceNumber_t& new_replay_next,
+        bool finished)
+{
+    if (finished)
+    {
+        // Late joiners are up to date, so they receive the next changes as the rest of readers
+        late_joiners_.erase(std::remove_if(late_joiners_.begin(), late_joiners_.end(),
+                [&replay_next](const LateJoiner& late_joiner)
+                {
+                    return late_joiner.replay_next == replay_next;
+                }), late_joiners_.end());
+        return;
+    }
+
+    for (LateJoiner& late_joiner : late_joiners_)
+    {
+        if (late_joiner.replay_next == replay_next)
+        {
+            late_joiner.replay_next = new_replay_next;
+        }
+    }
+}
+
+void StatelessWriter::replay_history_to_late_joiners()
+{
+    if (late_joiners_.empty())
+    {
+        return;
+    }
+
+    // Serve the late joiner waiting for the longest time, and those at its same position
+    SequenceNumber_t replay_next = late_joiners_.begin()->replay_next;
+    SequenceNumber_t new_replay_next = replay_next;
+    select_late_joiners(replay_next);
+
+    bool finished = false;
+    try
+    {
+        RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+        bool remote_destinations = locator_selector_.selected_size() > 0;
+        uint32_t replayed_size = 0;
+
+        CacheChange_t* change = nullptr;
+        History::const_iterator it = mp_history->get_change_nts(replay_next, m_guid, &change,
+                        mp_history->changesBegin());
+        History::const_iterator first = it;
+        // At least one change is replayed on each turn, so the replay always progresses
+        while (it != mp_history->changesEnd() &&
+                (it == first || replayed_size < late_joiner_replay_budget_))
+        {
+            change = *it;
+            replayed_size += change->serializedPayload.length;
+
+            for (ReaderLocator& reader : matched_readers_)
+            {
+                if (reader.is_local_reader() && is_late_joiner_at(reader.remote_guid(), replay_next))
+                {
+                    intraprocess_delivery(change, reader);
+                }
+            }
+
+            if (remote_destinations)
+            {
+                ChangeForReader_t reader_change(change);
+                if (!add_change_to_rtps_group(group, &reader_change, is_inline_qos_expected_))
+                {
+                    break;
+                }
+            }
+
+            new_replay_next = change->sequenceNumber + 1;
+            ++it;
+        }
+
+        finished = it == mp_history->changesEnd();
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        logError(RTPS_WRITER, "Max blocking time reached");
+    }
+
+    select_all_readers();
+    late_joiners_replayed_up_to(replay_next, new_replay_next, finished);
+}
+
+bool StatelessWriter::replay_history_with_flow_control()
+{
+    // Serve the late joiner waiting for the longest time, and those at its same position
+    SequenceNumber_t replay_next = late_joiners_.begin()->replay_next;
+    SequenceNumber_t new_replay_next = replay_next;
+
+    RTPSWriterCollector<ReaderLocator*> changes_to_send;
+    uint32_t collected_size = 0;
+
+    CacheChange_t* change = nullptr;
+    History::const_iterator it = mp_history->get_change_nts(replay_next, m_guid, &change,
+                    mp_history->changesBegin());
+    // At least one change is collected on each turn, so the replay always progresses
+    while (it != mp_history->changesEnd() && (changes_to_send.empty() || collected_size < late_joiner_replay_budget_))
+    {
+        change = *it;
+        collected_size += change->serializedPayload.length;
+        changes_to_send.add_change(change, nullptr, ChangeForReader_t(change).getUnsentFragments());
+        ++it;
+    }
+    bool batch_reaches_end = it == mp_history->changesEnd();
+
+    size_t n_items = changes_to_send.size();
+
+    // Clear through local controllers
+    for (auto& controller : flow_controllers_)
+    {
+        (*controller)(changes_to_send);
+    }
+
+    // Clear through parent controllers
+    for (auto& controller : mp_RTPSParticipant->getFlowControllers())
+    {
+        (*controller)(changes_to_send);
+    }
+
+    bool flow_controllers_limited = n_items != changes_to_send.size();
+
+    select_late_joiners(replay_next);
+
+    try
+    {
+        RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+
+        while (!changes_to_send.empty())
+        {
+            RTPSWriterCollector<ReaderLocator*>::Item item = changes_to_send.pop();
+
+            // Notify the controllers
+            FlowController::NotifyControllersChangeSent(item.cacheChange);
+
+            if (item.fragmentNumber != 0)
+            {
+                if (!group.add_data_frag(*item.cacheChange, item.fragmentNumber, is_inline_qos_expected_))
+                {
+                    logError(RTPS_WRITER, "Error sending fragment (" << item.sequenceNumber <<
+                            ", " << item.fragmentNumber << ")");
+                }
+            }
+            else
+            {
+                if (!group.add_data(*item.cacheChange, is_inline_qos_expected_))
+                {
+                    logError(RTPS_WRITER, "Error sending change " << item.sequenceNumber);
+                }
+            }
+
+            // The cursor only moves past a change when its last fragment has been sent
+            if (item.fragmentNumber == 0 || item.fragmentNumber == item.cacheChange->getFragmentCount())
+            {
+                for (ReaderLocator& reader : matched_readers_)
+                {
+                    if (reader.is_local_reader() && is_late_joiner_at(reader.remote_guid(), replay_next))
+                    {
+                        intraprocess_delivery(item.cacheChange, reader);
+                    }
+                }
+
+                new_replay_next = item.sequenceNumber + 1;
+            }
+        }
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        logError(RTPS_WRITER, "Max blocking time reached");
+        flow_controllers_limited = true;
+    }
+
+    select_all_readers();
+    late_joiners_replayed_up_to(replay_next, new_replay_next, batch_reaches_end && !flow_controllers_limited);
+
+    return flow_controllers_limited;
+}
+
 /*
  *	MATCHED_READER-RELATED METHODS
  */
@@ -737,7 +996,8 @@ bool StatelessWriter::matched_reader_add(
         if (reader.start(data.guid(),
                 data.remote_locators().unicast,
                 data.remote_locators().multicast,
-                data.m_expectsInlineQos))
+                data.m_expectsInlineQos,
+                is_datasharing_compatible_with(data)))
         {
             new_reader = &reader;
             break;
@@ -756,7 +1016,8 @@ bool StatelessWriter::matched_reader_add(
             new_reader->start(data.guid(),
                     data.remote_locators().unicast,
                     data.remote_locators().multicast,
-                    data.m_expectsInlineQos);
+                    data.m_expectsInlineQos,
+                    is_datasharing_compatible_with(data));
         }
         else
         {
@@ -777,12 +1038,12 @@ bool StatelessWriter::matched_reader_add(
     if ((mp_history->getHistorySize() > 0) &&
             (data.m_qos.m_durability.kind >= TRANSIENT_LOCAL_DURABILITY_QOS))
     {
-        // Resend all changes
-        unsent_changes_.assign(mp_history->changesBegin(), mp_history->changesEnd());
-        // If a new change is added, should be sent to everyone
-        first_seq_for_all_readers_ = mp_history->next_sequence_number();
-        // Mark newcommer's guid as receiver of old changes
-        late_joiner_guids_.emplace_back(data.guid());
+        // The history is replayed to the newcomer from its oldest change, in batches sent from the asynchronous
+        // thread. Other late joiners still waiting for the replay keep their own position.
+        LateJoiner late_joiner;
+        late_joiner.guid = data.guid();
+        late_joiner.replay_next = (*mp_history->changesBegin())->sequenceNumber;
+        late_joiners_.push_back(late_joiner);
         // History is always sent asynchronously to late joiners
         mp_RTPSParticipant->async_thread().wake_up(this);
     }
@@ -831,7 +1092,11 @@ bool StatelessWriter::matched_reader_remove(
         // guid should be both on locator_selector_ and matched_readers_
         assert(found);
 
-        late_joiner_guids_.remove(reader_guid);
+        late_joiners_.remove_if(
+            [&reader_guid](const LateJoiner& late_joiner)
+            {
+                return late_joiner.guid == reader_guid;
+            });
         update_reader_info(false);
     }
 
@@ -858,8 +1123,6 @@ void StatelessWriter::unsent_changes_reset()
     {
         // Mark all changes as pending
         unsent_changes_.assign(mp_history->changesBegin(), mp_history->changesEnd());
-        // Send to all from the beginning
-        first_seq_for_all_readers_ = unsent_changes_.front().getSequenceNumber();
         // Do it asynchronously
         mp_RTPSParticipant->async_thread().wake_up(this);
     }
@@ -871,18 +1134,38 @@ void StatelessWriter::add_flow_controller(
     flow_controllers_.push_back(std::move(controller));
 }
 
+uint32_t StatelessWriter::max_message_size() const
+{
+    uint32_t max_size = RTPSWriter::max_message_size();
+
+    if (!ignore_fixed_locators_)
+    {
+        for (const Locator_t& locator : fixed_locators_)
+        {
+            uint32_t locator_max_size = mp_RTPSParticipant->get_max_message_size(locator);
+            if (0 == max_size || locator_max_size < max_size)
+            {
+                max_size = locator_max_size;
+            }
+        }
+    }
+
+    return max_size;
+}
+
 bool StatelessWriter::send(
-        CDRMessage_t* message,
+        const NetworkBuffers& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    if (!RTPSWriter::send(message, max_blocking_time_point))
+    if (!RTPSWriter::send(buffers, total_bytes, max_blocking_time_point))
     {
         return false;
     }
 
     return ignore_fixed_locators_ ||
            fixed_locators_.empty() ||
-           mp_RTPSParticipant->sendSync(message, Locators(fixed_locators_.begin()), Locators(
+           mp_RTPSParticipant->sendSync(buffers, total_bytes, Locators(fixed_locators_.begin()), Locators(
                        fixed_locators_.end()), max_blocking_time_point);
 }
 
@@ -707,6 +707,8 @@ XMLP_ret XMLParser::getXMLThroughputController(
             <xs:all minOccurs="0">
                 <xs:element name="bytesPerPeriod" type="uint32Type" minOccurs="0"/>
                 <xs:element name="periodMillisecs" type="uint32Type" minOccurs="0"/>
+                <xs:element name="kind" type="throughputControllerKindType" minOccurs="0"/>
+                <xs:element name="burstBytes" type="uint32Type" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -732,6 +734,54 @@ XMLP_ret XMLParser::getXMLThroughputController(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, KIND) == 0)
+        {
+            /*
+                <xs:simpleType name="throughputControllerKindType">
+                    <xs:restriction base="xs:string">
+                        <xs:enumeration value="FIXED_WINDOW"/>
+                        <xs:enumeration value="TOKEN_BUCKET"/>
+                        <xs:enumeration value="PRIORITY"/>
+                        <xs:enumeration value="FAIR_SHARE"/>
+                    </xs:restriction>
+                </xs:simpleType>
+             */
+            const char* text = p_aux0->GetText();
+            if (nullptr == text)
+            {
+                logError(XMLPARSER, "Node '" << KIND << "' without content");
+                return XMLP_ret::XML_ERROR;
+            }
+            if (strcmp(text, THROUGHPUT_FIXED_WINDOW) == 0)
+            {
+                throughputController.kind = FIXED_WINDOW_THROUGHPUT_CONTROLLER;
+            }
+            else if (strcmp(text, THROUGHPUT_TOKEN_BUCKET) == 0)
+            {
+                throughputController.kind = TOKEN_BUCKET_THROUGHPUT_CONTROLLER;
+            }
+            else if (strcmp(text, THROUGHPUT_PRIORITY) == 0)
+            {
+                throughputController.kind = PRIORITY_THROUGHPUT_CONTROLLER;
+            }
+            else if (strcmp(text, THROUGHPUT_FAIR_SHARE) == 0)
+            {
+                throughputController.kind = FAIR_SHARE_THROUGHPUT_CONTROLLER;
+            }
+            else
+            {
+                logError(XMLPARSER, "Node '" << KIND << "' bad content");
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, BURST_BYTES) == 0)
+        {
+            // burstBytes - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.burstBytes, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'portType'. Name: " << name);
@@ -44,6 +44,8 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* UDP_LISTEN_THREADS = "listen_threads";
+const char* UDP_RECEIVE_BATCH_SIZE = "receive_batch_size";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* MAX_MESSAGE_SIZE = "maxMessageSize";
 const char* MAX_INITIAL_PEERS_RANGE = "maxInitialPeersRange";
@@ -53,6 +55,7 @@ const char* MAX_LOGICAL_PORT = "max_logical_port";
 const char* LOGICAL_PORT_RANGE = "logical_port_range";
 const char* LOGICAL_PORT_INCREMENT = "logical_port_increment";
 const char* ENABLE_TCP_NODELAY = "enable_tcp_nodelay";
+const char* TCP_IO_THREADS = "io_threads";
 const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
@@ -233,6 +236,11 @@ const char* DEPTH = "depth";
 const char* ALLOCATED_SAMPLES = "allocated_samples";
 const char* BYTES_PER_SECOND = "bytesPerPeriod";
 const char* PERIOD_MILLISECS = "periodMillisecs";
+const char* BURST_BYTES = "burstBytes";
+const char* THROUGHPUT_FIXED_WINDOW = "FIXED_WINDOW";
+const char* THROUGHPUT_TOKEN_BUCKET = "TOKEN_BUCKET";
+const char* THROUGHPUT_PRIORITY = "PRIORITY";
+const char* THROUGHPUT_FAIR_SHARE = "FAIR_SHARE";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -24,6 +24,7 @@
 #include <openssl/aes.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
+#include <chrono>
 #include <cstring>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
@@ -42,6 +43,80 @@ using namespace eprosima::fastrtps::rtps::security;
 
 CONSTEXPR int initialization_vector_suffix_length = 8;
 
+/**
+ * Builds the suffix of the initialization vector of a new message from a counter of the session.
+ * Several senders may share the same session key (e.g. the key exchange writer and reader of both participants),
+ * so the counter starts at a random value the first time the session protects a message, instead of at zero,
+ * and RAND_bytes is only called once per session data.
+ */
+static void next_initialization_vector_suffix(
+        KeySessionData& session,
+        std::array<uint8_t, initialization_vector_suffix_length>& initialization_vector_suffix)
+{
+    if (!session.initialization_vector_counter_seeded)
+    {
+        RAND_bytes(reinterpret_cast<unsigned char*>(&session.initialization_vector_counter),
+                sizeof(session.initialization_vector_counter));
+        session.initialization_vector_counter_seeded = true;
+    }
+
+    uint64_t counter = ++session.initialization_vector_counter;
+    memcpy(initialization_vector_suffix.data(), &counter, initialization_vector_suffix_length);
+}
+
+/**
+ * Gets the cipher context of a session, keyed with its current session key.
+ * @return nullptr if the context could not be created or keyed.
+ */
+static EVP_CIPHER_CTX* session_cipher_context(
+        KeySessionData& session,
+        bool use_256_bits)
+{
+    if (session.cipher_context == nullptr)
+    {
+        session.cipher_context = EVP_CIPHER_CTX_new();
+        if (session.cipher_context == nullptr)
+        {
+            return nullptr;
+        }
+        session.cipher_context_outdated = true;
+    }
+
+    if (session.cipher_context_outdated)
+    {
+        if (!EVP_EncryptInit_ex(session.cipher_context, use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(),
+                nullptr, (const unsigned char*)(session.SessionKey.data()), nullptr))
+        {
+            return nullptr;
+        }
+        session.cipher_context_outdated = false;
+    }
+
+    return session.cipher_context;
+}
+
+/**
+ * Computes the receiver specific MAC of a message, reusing the cipher context of the receiver session.
+ * As the context keeps the key schedule of the receiver specific session key, only the initialization vector and the
+ * common MAC are processed for each message.
+ * @return false if the MAC could not be computed.
+ */
+static bool compute_receiver_specific_mac(
+        KeySessionData& session,
+        bool use_256_bits,
+        const std::array<uint8_t, 12>& initialization_vector,
+        const std::array<uint8_t, 16>& common_mac,
+        std::array<uint8_t, 16>& receiver_mac)
+{
+    int actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* e_ctx = session_cipher_context(session, use_256_bits);
+    return (nullptr != e_ctx) &&
+           EVP_EncryptInit_ex(e_ctx, nullptr, nullptr, nullptr, initialization_vector.data()) &&
+           EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, common_mac.data(), 16) &&
+           EVP_EncryptFinal_ex(e_ctx, nullptr, &final_size) &&
+           EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, receiver_mac.data());
+}
+
 static KeyMaterial_AES_GCM_GMAC* find_key(
         KeyMaterial_AES_GCM_GMAC_Seq& keys,
         const CryptoTransformIdentifier& id)
@@ -106,6 +181,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
         session->session_id += 1;
 
         compute_sessionkey(session->SessionKey, keyMat, session->session_id);
+        session->cipher_context_outdated = true;
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
@@ -115,7 +191,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
 
     //Build NONCE elements (Build once, use once)
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
+    next_initialization_vector_suffix(*session, initialization_vector_suffix);
     std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
     memcpy(initialization_vector.data(), &(session->session_id), 4);
     memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), initialization_vector_suffix_length);
@@ -139,7 +215,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
     // Body
     try
     {
-        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
+        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, *session,
                 initialization_vector, output_buffer, payload.data, payload.length, tag, false))
         {
             return false;
@@ -155,7 +231,8 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
     {
         std::vector<DatareaderCryptoHandle*> receiving_datareader_crypto_list;
         if (!serialize_SecureDataTag(serializer, keyMat.transformation_kind, session->session_id,
-                initialization_vector, receiving_datareader_crypto_list, false, tag, nKeys - 1))
+                initialization_vector, receiving_datareader_crypto_list, false, tag, nKeys - 1,
+                local_writer->TimingCounters))
         {
             return false;
         }
@@ -211,6 +288,7 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
         session->session_id += 1;
         update_specific_keys = true;
         compute_sessionkey(session->SessionKey, keyMat, session->session_id);
+        session->cipher_context_outdated = true;
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
@@ -220,7 +298,7 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
+    next_initialization_vector_suffix(*session, initialization_vector_suffix);
     std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
     memcpy(initialization_vector.data(), &(session->session_id), 4);
     memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
@@ -266,12 +344,14 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
     // Body
     try
     {
-        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
+        auto body_start = std::chrono::steady_clock::now();
+        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, *session,
                 initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                 plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
             return false;
         }
+        local_writer->TimingCounters.common_protection_time += std::chrono::steady_clock::now() - body_start;
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException&)
     {
@@ -290,7 +370,8 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
         const char* length_position = serializer.getCurrentPosition();
 
         if (!serialize_SecureDataTag(serializer, keyMat.transformation_kind, session->session_id,
-                initialization_vector, receiving_datareader_crypto_list, update_specific_keys, tag, 0))
+                initialization_vector, receiving_datareader_crypto_list, update_specific_keys, tag, 0,
+                local_writer->TimingCounters))
         {
             return false;
         }
@@ -311,6 +392,8 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
     encoded_rtps_submessage.pos += static_cast<uint32_t>(serializer.getSerializedDataLength());
     encoded_rtps_submessage.length += static_cast<uint32_t>(serializer.getSerializedDataLength());
 
+    local_writer->TimingCounters.encoded_submessages += 1;
+
     return true;
 }
 
@@ -351,6 +434,7 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
         update_specific_keys = true;
         compute_sessionkey(session->SessionKey, local_reader->EntityKeyMaterial.at(0),
                 session->session_id);
+        session->cipher_context_outdated = true;
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
@@ -360,7 +444,7 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
+    next_initialization_vector_suffix(*session, initialization_vector_suffix);
     std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
     memcpy(initialization_vector.data(), &(session->session_id), 4);
     memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
@@ -406,13 +490,15 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
     // Body
     try
     {
+        auto body_start = std::chrono::steady_clock::now();
         if (!serialize_SecureDataBody(serializer, local_reader->EntityKeyMaterial.at(0).transformation_kind,
-                session->SessionKey,
+                *session,
                 initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                 plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
             return false;
         }
+        local_reader->TimingCounters.common_protection_time += std::chrono::steady_clock::now() - body_start;
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException&)
     {
@@ -432,7 +518,8 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
 
         if (!serialize_SecureDataTag(serializer, local_reader->EntityKeyMaterial.at(0).transformation_kind,
                 session->session_id,
-                initialization_vector, receiving_datawriter_crypto_list, update_specific_keys, tag, 0))
+                initialization_vector, receiving_datawriter_crypto_list, update_specific_keys, tag, 0,
+                local_reader->TimingCounters))
         {
             return false;
         }
@@ -453,6 +540,8 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
     encoded_rtps_submessage.pos += static_cast<uint32_t>(serializer.getSerializedDataLength());
     encoded_rtps_submessage.length += static_cast<uint32_t>(serializer.getSerializedDataLength());
 
+    local_reader->TimingCounters.encoded_submessages += 1;
+
     return true;
 }
 
@@ -491,6 +580,7 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
         update_specific_keys = true;
         compute_sessionkey(local_participant->Session.SessionKey, local_participant->ParticipantKeyMaterial,
                 local_participant->Session.session_id);
+        local_participant->Session.cipher_context_outdated = true;
 
         //ReceiverSpecific keys shall be computed specifically when needed
         local_participant->Session.session_block_counter = 0;
@@ -501,7 +591,7 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
 
     //Build remaining NONCE elements
     std::array<uint8_t, initialization_vector_suffix_length> initialization_vector_suffix;  //iv suffix changes with every operation
-    RAND_bytes(initialization_vector_suffix.data(), initialization_vector_suffix_length);
+    next_initialization_vector_suffix(local_participant->Session, initialization_vector_suffix);
     std::array<uint8_t, 12> initialization_vector; //96 bytes, session_id + suffix
     memcpy(initialization_vector.data(), &(local_participant->Session.session_id), 4);
     memcpy(initialization_vector.data() + 4, initialization_vector_suffix.data(), 8);
@@ -548,7 +638,7 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
     try
     {
         if (!serialize_SecureDataBody(serializer, local_participant->ParticipantKeyMaterial.transformation_kind,
-                local_participant->Session.SessionKey,
+                local_participant->Session,
                 initialization_vector, output_buffer, &plain_rtps_message.buffer[plain_rtps_message.pos],
                 plain_rtps_message.length - plain_rtps_message.pos, tag, true))
         {
@@ -1451,6 +1541,40 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     return true;
 }
 
+bool AESGCMGMAC_Transform::get_datawriter_timing_counters(
+        DatawriterCryptoHandle& datawriter_crypto,
+        CryptoTimingCounters& timing_counters)
+{
+    AESGCMGMAC_WriterCryptoHandle& local_writer = AESGCMGMAC_WriterCryptoHandle::narrow(datawriter_crypto);
+
+    if (local_writer.nil())
+    {
+        logWarning(SECURITY_CRYPTO, "Invalid cryptoHandle");
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(local_writer->mutex_);
+    timing_counters = local_writer->TimingCounters;
+    return true;
+}
+
+bool AESGCMGMAC_Transform::get_datareader_timing_counters(
+        DatareaderCryptoHandle& datareader_crypto,
+        CryptoTimingCounters& timing_counters)
+{
+    AESGCMGMAC_ReaderCryptoHandle& local_reader = AESGCMGMAC_ReaderCryptoHandle::narrow(datareader_crypto);
+
+    if (local_reader.nil())
+    {
+        logWarning(SECURITY_CRYPTO, "Invalid cryptoHandle");
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(local_reader->mutex_);
+    timing_counters = local_reader->TimingCounters;
+    return true;
+}
+
 void AESGCMGMAC_Transform::compute_sessionkey(
         std::array<uint8_t, 32>& session_key,
         const KeyMaterial_AES_GCM_GMAC& key_mat,
@@ -1529,7 +1653,7 @@ void AESGCMGMAC_Transform::serialize_SecureDataHeader(
 bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         eprosima::fastcdr::Cdr& serializer,
         const std::array<uint8_t, 4>& transformation_kind,
-        const std::array<uint8_t, 32>& session_key,
+        KeySessionData& session,
         const std::array<uint8_t, 12>& initialization_vector,
         eprosima::fastcdr::FastBuffer& output_buffer,
         octet* plain_buffer,
@@ -1544,32 +1668,17 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
 
-    if (!use_256_bits)
+    // The context keeps the key schedule of the session, so only the initialization vector is set
+    EVP_CIPHER_CTX* e_ctx = session_cipher_context(session, use_256_bits);
+    if (e_ctx == nullptr ||
+            !EVP_EncryptInit_ex(e_ctx, nullptr, nullptr, nullptr, initialization_vector.data()))
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_CTX_block_size(e_ctx);
 
     if (!do_encryption)
     {
@@ -1578,7 +1687,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             logError(SECURITY_CRYPTO, "Not enough memory to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.getCurrentPosition(), plain_buffer, plain_buffer_len);
@@ -1587,14 +1695,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         if (!EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, plain_buffer, static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
         if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
     }
@@ -1638,7 +1744,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             logError(SECURITY_CRYPTO, "Not enough memory to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1646,14 +1751,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
         if (!EVP_EncryptFinal(e_ctx, &output_buffer_raw[actual_size], &final_size))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1679,7 +1782,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1704,7 +1806,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         std::vector<EntityCryptoHandle*>& receiving_crypto_list,
         bool update_specific_keys,
         SecureDataTag& tag,
-        size_t sessionIndex)
+        size_t sessionIndex,
+        CryptoTimingCounters& timing_counters)
 {
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
@@ -1725,6 +1828,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
     uint32_t length = 0;
     serializer << length;
 
+    auto macs_start = std::chrono::steady_clock::now();
+
     //Check the list of receivers, search for keys and compute session keys as needed
     for (auto rec = receiving_crypto_list.begin(); rec != receiving_crypto_list.end(); ++rec)
     {
@@ -1757,57 +1862,26 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
             remote_entity->Sessions[sessionIndex].session_id = session_id;
             compute_sessionkey(remote_entity->Sessions[sessionIndex].SessionKey, true,
                     keyMat.master_receiver_specific_key, keyMat.master_salt, session_id, key_len);
+            remote_entity->Sessions[sessionIndex].cipher_context_outdated = true;
         }
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        std::array<uint8_t, 16> receiver_mac;
+        if (!compute_receiver_specific_mac(remote_entity->Sessions[sessionIndex], use_256_bits,
+                initialization_vector, tag.common_mac, receiver_mac))
         {
             logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the datawriter submessage. EVP function returns an error");
             continue;
         }
-        serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+        serializer << keyMat.receiver_specific_key_id << receiver_mac;
 
         ++length;
     }
 
+    timing_counters.receiver_specific_macs += length;
+    timing_counters.receiver_specific_macs_time += std::chrono::steady_clock::now() - macs_start;
+
     eprosima::fastcdr::Cdr::state current_state = serializer.getState();
     serializer.setState(length_state);
     serializer.serialize(length, eprosima::fastcdr::Cdr::Endianness::BIG_ENDIANNESS);
@@ -1868,54 +1942,19 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
             compute_sessionkey(remote_participant->Session.SessionKey, true,
                     keyMat.master_receiver_specific_key, keyMat.master_salt, remote_participant->Session.session_id,
                     key_len);
+            remote_participant->Session.cipher_context_outdated = true;
         }
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        std::array<uint8_t, 16> receiver_mac;
+        if (!compute_receiver_specific_mac(remote_participant->Session, use_256_bits, initialization_vector,
+                tag.common_mac, receiver_mac))
         {
             logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the rtps message. EVP function returns an error");
             continue;
         }
-        serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+        serializer << keyMat.receiver_specific_key_id << receiver_mac;
 
         ++length;
     }
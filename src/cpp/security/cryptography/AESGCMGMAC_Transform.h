@@ -104,6 +104,26 @@ public:
             DatawriterCryptoHandle& sending_datawriter_crypto,
             SecurityException& exception) override;
 
+    /**
+     * Get the time spent protecting the submessages of a local datawriter.
+     * @param datawriter_crypto Handle of the local datawriter.
+     * @param timing_counters Filled with the counters of the datawriter.
+     * @return false when the handle is not valid.
+     */
+    bool get_datawriter_timing_counters(
+            DatawriterCryptoHandle& datawriter_crypto,
+            CryptoTimingCounters& timing_counters);
+
+    /**
+     * Get the time spent protecting the submessages of a local datareader.
+     * @param datareader_crypto Handle of the local datareader.
+     * @param timing_counters Filled with the counters of the datareader.
+     * @return false when the handle is not valid.
+     */
+    bool get_datareader_timing_counters(
+            DatareaderCryptoHandle& datareader_crypto,
+            CryptoTimingCounters& timing_counters);
+
     //Aux functions to compute session key from the master material
     void compute_sessionkey(
             std::array<uint8_t, 32>& session_key,
@@ -129,7 +149,7 @@ public:
     bool serialize_SecureDataBody(
             eprosima::fastcdr::Cdr& serializer,
             const std::array<uint8_t, 4>& transformation_kind,
-            const std::array<uint8_t, 32>& session_key,
+            KeySessionData& session,
             const std::array<uint8_t, 12>& initialization_vector,
             eprosima::fastcdr::FastBuffer& output_buffer,
             octet* plain_buffer,
@@ -145,7 +165,8 @@ public:
             std::vector<EntityCryptoHandle*>& receiving_datareader_crypto_list,
             bool update_specific_keys,
             SecureDataTag& tag,
-            size_t sessionIndex);
+            size_t sessionIndex,
+            CryptoTimingCounters& timing_counters);
 
     bool serialize_SecureDataTag(
             eprosima::fastcdr::Cdr& serializer,
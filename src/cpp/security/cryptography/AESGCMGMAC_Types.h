@@ -26,6 +26,9 @@
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
+#include <openssl/evp.h>
+
+#include <chrono>
 #include <mutex>
 #include <limits>
 
@@ -135,9 +138,41 @@ struct SecureDataTag
 
 struct KeySessionData
 {
+    KeySessionData() = default;
+
+    KeySessionData(
+            const KeySessionData&) = delete;
+
+    KeySessionData& operator =(
+            const KeySessionData&) = delete;
+
+    ~KeySessionData()
+    {
+        EVP_CIPHER_CTX_free(cipher_context);
+    }
+
     uint32_t session_id = std::numeric_limits<uint32_t>::max();
     std::array<uint8_t, 32> SessionKey = c_empty_key_material;
     uint64_t session_block_counter = 0;
+    //Used to build initialization vectors. Starts at a random value and is never reset.
+    uint64_t initialization_vector_counter = 0;
+    bool initialization_vector_counter_seeded = false;
+    //Cipher context keyed with SessionKey, so it is only initialized when the session key changes
+    EVP_CIPHER_CTX* cipher_context = nullptr;
+    bool cipher_context_outdated = true;
+};
+
+//Time spent by a local endpoint protecting its submessages
+struct CryptoTimingCounters
+{
+    //Number of submessages protected
+    uint64_t encoded_submessages = 0;
+    //Number of receiver specific MACs computed for those submessages
+    uint64_t receiver_specific_macs = 0;
+    //Time spent encrypting or signing the submessages with the session key
+    std::chrono::nanoseconds common_protection_time{0};
+    //Time spent computing the receiver specific MACs
+    std::chrono::nanoseconds receiver_specific_macs_time{0};
 };
 
 struct EntityKeyHandle
@@ -162,6 +197,8 @@ struct EntityKeyHandle
     //Data used to store the current session keys and to determine when it has to be updated
     KeySessionData Sessions[2];
     uint64_t max_blocks_per_session = 0;
+    //Timing of the protection of the submessages of a local endpoint. Guarded by mutex_
+    CryptoTimingCounters TimingCounters;
     std::mutex mutex_;
 };
 
@@ -0,0 +1,93 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CRC32.hpp
+ */
+
+#ifndef UTILS_CRC32_HPP_
+#define UTILS_CRC32_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+
+/**
+ * CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) computed with a lookup table.
+ */
+class CRC32
+{
+public:
+
+    /**
+     * Update a CRC with a block of data.
+     * @param crc Value returned by a previous call, or 0 to start a new computation.
+     * @param data Pointer to the data.
+     * @param size Number of bytes of data.
+     * @return The CRC of all the data processed.
+     */
+    static uint32_t update(
+            uint32_t crc,
+            const void* data,
+            size_t size)
+    {
+        const uint32_t* table = get_table();
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i)
+        {
+            crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    static uint32_t compute(
+            const void* data,
+            size_t size)
+    {
+        return update(0, data, size);
+    }
+
+private:
+
+    struct Table
+    {
+        Table()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t value = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                }
+                values[i] = value;
+            }
+        }
+
+        uint32_t values[256];
+    };
+
+    static const uint32_t* get_table()
+    {
+        static const Table table;
+        return table.values;
+    }
+
+};
+
+} // namespace eprosima
+
+#endif // UTILS_CRC32_HPP_
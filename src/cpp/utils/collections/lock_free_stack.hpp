@@ -0,0 +1,258 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file lock_free_stack.hpp
+ */
+
+#ifndef _FASTRTPS_UTILS_LOCK_FREE_STACK_H_
+#define _FASTRTPS_UTILS_LOCK_FREE_STACK_H_
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief LockFreeStack. A multiple producers, multiple consumers stack of trivially copyable values
+ * (i.e. free lists of pointers).
+ *
+ * It is a Treiber stack whose nodes are slots identified by their index. The heads store the index of the top
+ * slot together with a tag that changes on every update, so a thread that lost a race never succeeds on a stale
+ * head (ABA problem). Slots are allocated on blocks that are only freed on destruction, and a second stack keeps
+ * the slots which are not in use.
+ *
+ * Operations never block nor allocate. The capacity is only increased by reserve, which should not be called
+ * concurrently with itself.
+ */
+template<typename T>
+class LockFreeStack final
+{
+public:
+
+    LockFreeStack()
+    {
+        for (std::atomic<Slot*>& block : blocks_)
+        {
+            block.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~LockFreeStack()
+    {
+        for (std::atomic<Slot*>& block : blocks_)
+        {
+            delete[] block.load(std::memory_order_relaxed);
+        }
+    }
+
+    // not-copyable
+    LockFreeStack(
+            const LockFreeStack&) = delete;
+
+    LockFreeStack& operator =(
+            const LockFreeStack&) = delete;
+
+    /**
+     * @brief Ensures that at least @c capacity values can be stored.
+     * It may be called concurrently with the rest of operations, but not with itself.
+     * @param capacity Number of values.
+     */
+    void reserve(
+            size_t capacity)
+    {
+        assert(capacity < NIL);
+
+        while (capacity_.load(std::memory_order_relaxed) < capacity)
+        {
+            uint32_t first_index = capacity_.load(std::memory_order_relaxed);
+            uint32_t block_index = block_of(first_index);
+            uint32_t block_size = FIRST_BLOCK_SIZE << block_index;
+            Slot* block = new Slot[block_size];
+            blocks_[block_index].store(block, std::memory_order_release);
+
+            for (uint32_t i = 0; i < block_size; ++i)
+            {
+                push_slot(free_head_, first_index + i);
+            }
+            capacity_.store(first_index + block_size, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Pushes a value on top of the stack.
+     * @param value The value to push.
+     * @return false when the capacity is exhausted.
+     */
+    bool push(
+            const T& value)
+    {
+        uint32_t index = pop_slot(free_head_);
+        if (NIL == index)
+        {
+            return false;
+        }
+
+        slot(index).value = value;
+        push_slot(head_, index);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pops the value on top of the stack.
+     * @param value Where the value is returned.
+     * @return false when the stack is empty.
+     */
+    bool pop(
+            T& value)
+    {
+        uint32_t index = pop_slot(head_);
+        if (NIL == index)
+        {
+            return false;
+        }
+
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        value = slot(index).value;
+        push_slot(free_head_, index);
+        return true;
+    }
+
+    //! Number of values in the stack. It is only exact when there are no concurrent operations.
+    size_t size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const
+    {
+        return 0u == size();
+    }
+
+    size_t capacity() const
+    {
+        return capacity_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of times an operation had to retry because another thread modified the stack at the same time.
+    uint64_t contentions() const
+    {
+        return contentions_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<uint32_t> next{NIL};
+        T value{};
+    };
+
+    static constexpr uint32_t NIL = std::numeric_limits<uint32_t>::max();
+
+    //! Blocks double their size, so 32 of them cover all the indexes.
+    static constexpr uint32_t FIRST_BLOCK_SIZE = 16;
+
+    static constexpr uint64_t TAG_INCREMENT = uint64_t(1) << 32;
+
+    //! Block k holds the indexes from FIRST_BLOCK_SIZE * (2^k - 1).
+    static uint32_t block_of(
+            uint32_t index)
+    {
+        uint32_t position = index / FIRST_BLOCK_SIZE + 1;
+        uint32_t block_index = 0;
+        while (position > 1)
+        {
+            position >>= 1;
+            ++block_index;
+        }
+        return block_index;
+    }
+
+    Slot& slot(
+            uint32_t index) const
+    {
+        uint32_t block_index = block_of(index);
+        uint32_t first_index = FIRST_BLOCK_SIZE * ((uint32_t(1) << block_index) - 1);
+        return blocks_[block_index].load(std::memory_order_acquire)[index - first_index];
+    }
+
+    void push_slot(
+            std::atomic<uint64_t>& head,
+            uint32_t index)
+    {
+        Slot& pushed = slot(index);
+        uint64_t old_head = head.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do
+        {
+            pushed.next.store(static_cast<uint32_t>(old_head), std::memory_order_relaxed);
+            new_head = ((old_head & ~uint64_t(NIL)) + TAG_INCREMENT) | index;
+        } while (!compare_exchange(head, old_head, new_head));
+    }
+
+    uint32_t pop_slot(
+            std::atomic<uint64_t>& head)
+    {
+        uint64_t old_head = head.load(std::memory_order_acquire);
+        uint32_t index;
+        uint64_t new_head;
+        do
+        {
+            index = static_cast<uint32_t>(old_head);
+            if (NIL == index)
+            {
+                return NIL;
+            }
+
+            // The slot may have been popped by another thread, but then the tag of the head has changed
+            new_head = ((old_head & ~uint64_t(NIL)) + TAG_INCREMENT) |
+                    slot(index).next.load(std::memory_order_relaxed);
+        } while (!compare_exchange(head, old_head, new_head));
+
+        return index;
+    }
+
+    bool compare_exchange(
+            std::atomic<uint64_t>& head,
+            uint64_t& expected,
+            uint64_t desired)
+    {
+        if (head.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        contentions_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::atomic<uint64_t> head_{NIL};
+    std::atomic<uint64_t> free_head_{NIL};
+    std::atomic<size_t> size_{0};
+    std::atomic<uint32_t> capacity_{0};
+    std::atomic<uint64_t> contentions_{0};
+    std::array<std::atomic<Slot*>, 32> blocks_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTRTPS_UTILS_LOCK_FREE_STACK_H_
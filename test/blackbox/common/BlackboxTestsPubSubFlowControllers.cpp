@@ -126,6 +126,45 @@ TEST_P(PubSubFlowControllers, AsyncPubSubAsReliableData64kbWithParticipantFlowCo
     reader.block_for_all();
 }
 
+TEST_P(PubSubFlowControllers, AsyncPubSubAsReliableData64kbWithSeveralAsyncThreads)
+{
+    PubSubReader<Data64kbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data64kbType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    PropertyPolicy participant_properties;
+    participant_properties.properties().emplace_back("fastdds.async_writer_threads", "4");
+    PropertyPolicy writer_properties;
+    writer_properties.properties().emplace_back("fastdds.async_writer_thread", "2");
+    writer_properties.properties().emplace_back("fastdds.async_writer_priority", "10");
+
+    writer.history_depth(10).
+            property_policy(participant_properties).
+            entity_property_policy(writer_properties).
+            asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data64kb_data_generator(10);
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
 TEST(PubSubFlowControllers, AsyncPubSubWithFlowController64kb)
 {
     PubSubReader<Data64kbType> reader(TEST_TOPIC_NAME);
@@ -21,7 +21,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+
 #include <fastrtps/transport/UDPv4Transport.h>
+#include <fastrtps/transport/test_UDPv4Transport.h>
 #include "../cpp/rtps/transport/shared_mem/test_SharedMemTransportDescriptor.h"
 
 using namespace eprosima::fastrtps;
@@ -244,6 +247,141 @@ TEST(SHM, SHM_UDP_300KFragmentation)
     reader.wait_participant_undiscovery();
 }
 
+// Synchronous writers send fragmented changes on a single DATA to destinations allowing big messages
+TEST(SHM, SHM_UDP_300KSyncNoFragmentation)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    auto data = default_data300kb_data_generator(1);
+    auto data_size = data.front().data().size();
+
+    auto shm_transport = std::make_shared<test_SharedMemTransportDescriptor>();
+    const uint32_t segment_size = 1024 * 1024;
+    shm_transport->segment_size(segment_size);
+    shm_transport->max_message_size(segment_size);
+
+    // The UDP transport limits the fragment size of the writer to less than the size of the sample
+    auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
+
+    uint32_t big_buffers_send_count = 0;
+    uint32_t big_buffers_recv_count = 0;
+    shm_transport->big_buffer_size_ = static_cast<uint32_t>(data_size);
+    shm_transport->big_buffer_size_send_count_ = &big_buffers_send_count;
+    shm_transport->big_buffer_size_recv_count_ = &big_buffers_recv_count;
+
+    writer.asynchronously(eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE);
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    writer
+    .disable_builtin_transport()
+    .add_user_transport_to_pparams(shm_transport)
+    .add_user_transport_to_pparams(udp_transport)
+    .init();
+
+    // The reader is only reached through SHM, as it is on the same host
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    reader
+    .disable_builtin_transport()
+    .add_user_transport_to_pparams(shm_transport)
+    .add_user_transport_to_pparams(udp_transport)
+    .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    reader.startReception(data);
+    writer.send(data);
+
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    // The whole sample was sent and received on a single message
+    ASSERT_EQ(big_buffers_send_count, 1u);
+    ASSERT_EQ(big_buffers_recv_count, 1u);
+
+    // Destroy the writer participant.
+    writer.destroy();
+
+    // Check that reader receives the unmatched.
+    reader.wait_participant_undiscovery();
+}
+
+// Synchronous writers keep sending fragments to destinations only allowing small messages
+TEST(SHM, SHM_UDP_300KSyncFragmentationToUDPReader)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    auto data = default_data300kb_data_generator(1);
+    auto data_size = data.front().data().size();
+
+    auto shm_transport = std::make_shared<test_SharedMemTransportDescriptor>();
+    const uint32_t segment_size = 1024 * 1024;
+    shm_transport->segment_size(segment_size);
+    shm_transport->max_message_size(segment_size);
+
+    uint32_t big_buffers_send_count = 0;
+    uint32_t big_buffers_recv_count = 0;
+    shm_transport->big_buffer_size_ = 32 * 1024; // 32K
+    shm_transport->big_buffer_size_send_count_ = &big_buffers_send_count;
+    shm_transport->big_buffer_size_recv_count_ = &big_buffers_recv_count;
+
+    auto test_udp_transport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+    std::atomic<uint32_t> data_frag_count(0);
+    test_udp_transport->drop_data_frag_messages_filter_ = [&data_frag_count](rtps::CDRMessage_t& )
+            {
+                ++data_frag_count;
+                return false;
+            };
+
+    writer.asynchronously(eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE);
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    writer
+    .disable_builtin_transport()
+    .add_user_transport_to_pparams(shm_transport)
+    .add_user_transport_to_pparams(test_udp_transport)
+    .init();
+
+    // The reader is only reached through UDP
+    auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    reader
+    .disable_builtin_transport()
+    .add_user_transport_to_pparams(udp_transport)
+    .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    reader.startReception(data);
+    writer.send(data);
+
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    // Nothing was sent through SHM, and the sample was sent on fragments no bigger than a UDP message
+    ASSERT_EQ(big_buffers_send_count, 0u);
+    ASSERT_GE(data_frag_count.load(), std::ceil(data_size / (float)udp_transport->maxMessageSize));
+
+    // Destroy the writer participant.
+    writer.destroy();
+
+    // Check that reader receives the unmatched.
+    reader.wait_participant_undiscovery();
+}
+
 TEST(SHM, UDPvsSHM_UDP)
 {
     PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
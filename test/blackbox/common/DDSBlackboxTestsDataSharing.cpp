@@ -0,0 +1,111 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/*!
+ * A reliable data-sharing reader uses the payloads on the writer's pool in place.
+ * A KEEP_ALL writer with a history smaller than the number of samples sent must wait for a slow reader
+ * to consume them, instead of reusing the payloads the reader has not read yet.
+ */
+TEST(DDSDataSharing, ReliableKeepAllSlowReader)
+{
+    PubSubReader<FixedSizedType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<FixedSizedType> writer(TEST_TOPIC_NAME);
+
+    PropertyPolicy datasharing_policy;
+    datasharing_policy.properties().emplace_back("fastdds.datasharing", "true");
+
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).
+            max_blocking_time({10, 0}).
+            resource_limits_allocated_samples(2).
+            resource_limits_max_samples(2).
+            entity_property_policy(datasharing_policy).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Data-sharing is only used between processes on the same host,
+    // so the reader participant takes the host part of the writer's prefix and another process part.
+    GuidPrefix_t reader_prefix = writer.participant_guid().guidPrefix;
+    for (size_t i = 4; i < 8; ++i)
+    {
+        reader_prefix.value[i] = static_cast<octet>(~reader_prefix.value[i]);
+    }
+
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+            history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).
+            guid_prefix(reader_prefix).
+            entity_property_policy(datasharing_policy).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_fixed_sized_data_generator(10);
+    auto expected_data(data);
+
+    // The writer blocks whenever its two samples are still held by the reader
+    std::thread sender([&writer, &data]()
+            {
+                writer.send(data);
+            });
+
+    std::vector<uint16_t> received_indexes;
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+    while (received_indexes.size() < expected_data.size() && std::chrono::steady_clock::now() < timeout)
+    {
+        FixedSized received;
+        if (reader.takeNextData(&received))
+        {
+            received_indexes.push_back(received.index());
+
+            // Keep the following samples on the reader history for a while
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    sender.join();
+
+    // All the samples were written and received in order, none of them was dropped or overwritten
+    std::vector<uint16_t> expected_indexes;
+    for (const FixedSized& expected : expected_data)
+    {
+        expected_indexes.push_back(expected.index());
+    }
+    ASSERT_TRUE(data.empty());
+    ASSERT_EQ(received_indexes, expected_indexes);
+}
+
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
@@ -0,0 +1,253 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <asio.hpp>
+
+#include <fastrtps/transport/test_UDPv4Transport.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/*!
+ * Checks how a participant processes the DATA(p) announcements of a remote participant.
+ *
+ * The first announcement sent by the remote participant is captured on its transport, so the tests can send it
+ * again to the local participant with a newer sequence number, being processed as a new announcement.
+ */
+class DDSDiscoveryAnnouncements : public testing::Test
+{
+public:
+
+    void SetUp() override
+    {
+        reader_.reset(new PubSubReader<HelloWorldType>(TEST_TOPIC_NAME));
+        writer_.reset(new PubSubWriter<HelloWorldType>(TEST_TOPIC_NAME));
+
+        // Capture the first DATA(p) sent by the writer participant
+        auto test_transport = std::make_shared<rtps::test_UDPv4TransportDescriptor>();
+        test_transport->dropParticipantBuiltinTopicData = true;
+        test_transport->drop_data_messages_filter_ = [this](CDRMessage_t& msg)
+                {
+                    // DATA submessage: extraFlags, octetsToInlineQos, readerId, writerId, writerSN
+                    const uint32_t writer_id_pos = msg.pos + 8;
+                    if (msg.length >= msg.pos + 20 &&
+                            std::equal(c_EntityId_SPDPWriter.value, c_EntityId_SPDPWriter.value + EntityId_t::size,
+                            msg.buffer + writer_id_pos))
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (announcement_.empty())
+                        {
+                            announcement_.assign(msg.buffer, msg.buffer + msg.length);
+                            sequence_number_pos_ = msg.pos + 12;
+                            little_endian_ = msg.msg_endian == LITTLEEND;
+                            cv_.notify_all();
+                        }
+                    }
+                    return false;
+                };
+
+        writer_->userData({'a', 'b', 'c', 'd'}).
+                disable_builtin_transport().
+                add_user_transport_to_pparams(test_transport).init();
+
+        ASSERT_TRUE(writer_->isInitialized());
+
+        reader_->setOnDiscoveryFunction([this](const ParticipantDiscoveryInfo& info) -> bool
+                {
+                    if (info.info.m_guid == writer_guid_)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        switch (info.status)
+                        {
+                            case ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT:
+                                ++discovered_count_;
+                                break;
+                            case ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT:
+                                ++changed_qos_count_;
+                                break;
+                            default:
+                                ++removed_count_;
+                                break;
+                        }
+                        user_data_ = info.info.m_userData.data_vec();
+                        cv_.notify_all();
+                    }
+                    return false;
+                });
+
+        // Announcements are sent again to the metatraffic unicast locator of the reader participant
+        Locator_t metatraffic_locator;
+        IPLocator::setIPv4(metatraffic_locator, 127, 0, 0, 1);
+        metatraffic_locator.port = global_port;
+        LocatorList_t metatraffic_locators;
+        metatraffic_locators.push_back(metatraffic_locator);
+
+        writer_guid_ = writer_->participant_guid();
+        reader_->metatraffic_unicast_locator_list(metatraffic_locators).init();
+
+        ASSERT_TRUE(reader_->isInitialized());
+
+        reader_->wait_discovery();
+        writer_->wait_discovery();
+
+        wait_for([this]()
+                {
+                    return !announcement_.empty() && discovered_count_ == 1u;
+                });
+    }
+
+    void TearDown() override
+    {
+        reader_.reset();
+        writer_.reset();
+    }
+
+protected:
+
+    //! Sends again the captured announcement, with another sequence number and optionally other user data
+    void send_announcement(
+            uint32_t sequence_number,
+            octet last_user_data_octet = 'd')
+    {
+        std::vector<octet> message;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            message = announcement_;
+        }
+
+        const octet high[4] = {0, 0, 0, 0};
+        octet low[4];
+        for (size_t i = 0; i < 4; ++i)
+        {
+            low[little_endian_ ? i : 3 - i] = static_cast<octet>(sequence_number >> (8 * i));
+        }
+        std::copy(high, high + 4, message.begin() + sequence_number_pos_);
+        std::copy(low, low + 4, message.begin() + sequence_number_pos_ + 4);
+
+        const octet user_data[] = {'a', 'b', 'c', 'd'};
+        auto user_data_it = std::search(message.begin() + sequence_number_pos_, message.end(),
+                        user_data, user_data + sizeof(user_data));
+        ASSERT_NE(user_data_it, message.end());
+        *(user_data_it + sizeof(user_data) - 1) = last_user_data_octet;
+
+        asio::io_service io_service;
+        asio::ip::udp::socket socket(io_service);
+        socket.open(asio::ip::udp::v4());
+        socket.send_to(asio::buffer(message),
+                asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), global_port));
+    }
+
+    void wait_for(
+            std::function<bool()> predicate)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ASSERT_TRUE(cv_.wait_for(lock, std::chrono::seconds(10), predicate));
+    }
+
+    std::unique_ptr<PubSubReader<HelloWorldType>> reader_;
+    std::unique_ptr<PubSubWriter<HelloWorldType>> writer_;
+    GUID_t writer_guid_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    std::vector<octet> announcement_;
+    uint32_t sequence_number_pos_ = 0;
+    bool little_endian_ = true;
+
+    uint32_t discovered_count_ = 0;
+    uint32_t changed_qos_count_ = 0;
+    uint32_t removed_count_ = 0;
+    std::vector<octet> user_data_;
+};
+
+//! Announcements equal to the last one processed only refresh the lease of the participant
+TEST_F(DDSDiscoveryAnnouncements, UnchangedAnnouncementIsNotReported)
+{
+    send_announcement(100);
+    send_announcement(101);
+    send_announcement(102);
+
+    // The changed announcement is processed after the previous ones, so it is reported the first
+    send_announcement(103, 'e');
+    wait_for([this]()
+            {
+                return changed_qos_count_ > 0u;
+            });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(changed_qos_count_, 1u);
+    ASSERT_EQ(discovered_count_, 1u);
+    ASSERT_EQ(removed_count_, 0u);
+    ASSERT_EQ(user_data_, std::vector<octet>({'a', 'b', 'c', 'e'}));
+}
+
+//! Announcements from the same participant with other user data are parsed and reported
+TEST_F(DDSDiscoveryAnnouncements, ChangedUserDataIsReported)
+{
+    send_announcement(100, 'e');
+    wait_for([this]()
+            {
+                return changed_qos_count_ == 1u;
+            });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ASSERT_EQ(user_data_, std::vector<octet>({'a', 'b', 'c', 'e'}));
+    }
+
+    // The original announcement is no longer the last one processed
+    send_announcement(101);
+    wait_for([this]()
+            {
+                return changed_qos_count_ == 2u;
+            });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(discovered_count_, 1u);
+    ASSERT_EQ(user_data_, std::vector<octet>({'a', 'b', 'c', 'd'}));
+}
+
+//! Once a participant is removed, its announcements discover it again
+TEST_F(DDSDiscoveryAnnouncements, RemovedParticipantIsDiscoveredAgain)
+{
+    writer_->destroy();
+    reader_->wait_participant_undiscovery();
+
+    send_announcement(100);
+    wait_for([this]()
+            {
+                return discovered_count_ == 2u;
+            });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(changed_qos_count_, 0u);
+    ASSERT_EQ(removed_count_, 1u);
+    ASSERT_EQ(user_data_, std::vector<octet>({'a', 'b', 'c', 'd'}));
+}
@@ -444,6 +444,97 @@ TEST_P(RTPS, RTPSAsReliableWithRegistrationAndHolesInHistory)
     late_joiner.block_for_all();
 }
 
+/**
+ * Checks that two late joiners receive the whole history of a writer, the second one being matched while the history
+ * is still being replayed to the first one.
+ */
+static void check_late_joiners_receive_history(
+        RTPSWithRegistrationWriter<HelloWorldType>& writer,
+        eprosima::fastrtps::rtps::ReliabilityKind_t reliability)
+{
+    ASSERT_TRUE(writer.isInitialized());
+
+    auto data = default_helloworld_data_generator();
+    auto send_data (data);
+
+    // Send data before any reader exists
+    writer.send(send_data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(send_data.empty());
+
+    RTPSWithRegistrationReader<HelloWorldType> first_late_joiner(TEST_TOPIC_NAME);
+    first_late_joiner.
+            durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            reliability(reliability).init();
+
+    ASSERT_TRUE(first_late_joiner.isInitialized());
+
+    first_late_joiner.wait_discovery();
+
+    RTPSWithRegistrationReader<HelloWorldType> second_late_joiner(TEST_TOPIC_NAME);
+    second_late_joiner.
+            durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            reliability(reliability).init();
+
+    ASSERT_TRUE(second_late_joiner.isInitialized());
+
+    second_late_joiner.wait_discovery();
+
+    // Block readers until reception finished or timeout.
+    first_late_joiner.expected_data(data);
+    first_late_joiner.startReception();
+    second_late_joiner.expected_data(data);
+    second_late_joiner.startReception();
+    first_late_joiner.block_for_all();
+    second_late_joiner.block_for_all();
+}
+
+TEST_P(RTPS, RTPSAsNonReliableLateJoinersWithZeroReplayBudget)
+{
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    writer.durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT).
+            late_joiner_replay_budget(0).init();
+
+    check_late_joiners_receive_history(writer, eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT);
+}
+
+TEST_P(RTPS, RTPSAsNonReliableLateJoinersWithSmallReplayBudget)
+{
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // The flow controller slows down the replay, so the second late joiner is matched during the replay
+    writer.durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            reliability(eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT).
+            add_throughput_controller_descriptor_to_pparams(300, 100).
+            late_joiner_replay_budget(50).init();
+
+    check_late_joiners_receive_history(writer, eprosima::fastrtps::rtps::ReliabilityKind_t::BEST_EFFORT);
+}
+
+TEST_P(RTPS, RTPSAsReliableLateJoinersWithZeroReplayBudget)
+{
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    writer.durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            late_joiner_replay_budget(0).init();
+
+    check_late_joiners_receive_history(writer, eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE);
+}
+
+TEST_P(RTPS, RTPSAsReliableLateJoinersWithSmallReplayBudget)
+{
+    RTPSWithRegistrationWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // The flow controller slows down the replay, so the second late joiner is matched during the replay
+    writer.durability(eprosima::fastrtps::rtps::DurabilityKind_t::TRANSIENT_LOCAL).
+            add_throughput_controller_descriptor_to_pparams(300, 100).
+            late_joiner_replay_budget(50).init();
+
+    check_late_joiners_receive_history(writer, eprosima::fastrtps::rtps::ReliabilityKind_t::RELIABLE);
+}
+
 
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
@@ -319,6 +319,14 @@ public:
         return *this;
     }
 
+    RTPSWithRegistrationWriter& late_joiner_replay_budget(
+            uint32_t budget)
+    {
+        writer_attr_.late_joiner_replay_budget = budget;
+
+        return *this;
+    }
+
     RTPSWithRegistrationWriter& add_throughput_controller_descriptor_to_pparams(
             uint32_t bytesPerPeriod,
             uint32_t periodInMs)
@@ -30,6 +30,11 @@ class AsyncWriterThread
 {
     public:
 
+        static const char* priority_property_name()
+        {
+            return "fastdds.async_writer_priority";
+        }
+
         void wake_up(RTPSWriter*) {}
 };
 
@@ -127,6 +127,9 @@ public:
     MOCK_METHOD0(userReadersListBegin, std::vector<RTPSReader*>::iterator ());
     MOCK_METHOD0(userReadersListEnd, std::vector<RTPSReader*>::iterator ());
 
+    MOCK_METHOD1(find_local_writer, RTPSWriter* (const GUID_t& writer_guid));
+    MOCK_METHOD1(find_local_reader, RTPSReader* (const GUID_t& reader_guid));
+
     MOCK_METHOD0(async_thread, AsyncWriterThread & ());
 
     MOCK_CONST_METHOD0(getParticipantMutex, std::recursive_mutex* ());
@@ -151,11 +151,40 @@ public:
         return true;
     }
 
+    virtual bool begin_sample_access_nts(
+            CacheChange_t*,
+            WriterProxy*& wp,
+            bool& is_future_change)
+    {
+        wp = nullptr;
+        is_future_change = false;
+        return true;
+    }
+
+    void end_sample_access_nts(
+            CacheChange_t* change,
+            WriterProxy*&,
+            bool mark_as_read)
+    {
+        change->isRead = change->isRead || mark_as_read;
+    }
+
     virtual bool isInCleanState()
     {
         return true;
     }
 
+    bool is_datasharing_compatible() const
+    {
+        return false;
+    }
+
+    bool is_sample_valid(
+            const CacheChange_t* /*change*/) const
+    {
+        return true;
+    }
+
     ReaderHistory* getHistory()
     {
         getHistory_mock();
@@ -171,6 +171,11 @@ public:
         return writer_guid == m_guid;
     }
 
+    bool is_datasharing_compatible() const
+    {
+        return false;
+    }
+
     WriterHistory* history_;
 
     WriterListener* listener_;
@@ -80,6 +80,7 @@ public:
      * @param unicast_locators    Unicast locators of the remote reader.
      * @param multicast_locators  Multicast locators of the remote reader.
      * @param expects_inline_qos  Whether remote reader expects to receive inline QoS.
+     * @param is_datasharing      Whether the remote reader should receive the changes through data-sharing.
      *
      * @return false when this object was already started, true otherwise.
      */
@@ -87,7 +88,8 @@ public:
             const GUID_t& /*remote_guid*/,
             const ResourceLimitedVector<Locator_t>& /*unicast_locators*/,
             const ResourceLimitedVector<Locator_t>& /*multicast_locators*/,
-            bool /*expects_inline_qos*/)
+            bool /*expects_inline_qos*/,
+            bool /*is_datasharing*/ = false)
     {
         return true;
     }
@@ -167,11 +169,13 @@ public:
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices with the message already serialized.
+     * @param total_bytes Sum of the sizes of all the slices.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
-            CDRMessage_t* /*message*/,
+            const NetworkBuffers& /*buffers*/,
+            uint32_t /*total_bytes*/,
             std::chrono::steady_clock::time_point& /*max_blocking_time_point*/) const override
     {
         return true;
@@ -187,6 +191,15 @@ public:
         return nullptr;
     }
 
+    bool is_datasharing_reader() const
+    {
+        return false;
+    }
+
+    void datasharing_notify()
+    {
+    }
+
 private:
 
     GUID_t remote_guid_;
@@ -306,6 +306,16 @@ public:
         return m_userDefinedId;
     }
 
+    const ParameterPropertyList_t& properties() const
+    {
+        return m_properties;
+    }
+
+    ParameterPropertyList_t& properties()
+    {
+        return m_properties;
+    }
+
 #if HAVE_SECURITY
     security::EndpointSecurityAttributesMask security_attributes_ = 0UL;
     security::PluginEndpointSecurityAttributesMask plugin_security_attributes_ = 0UL;
@@ -328,6 +338,7 @@ private:
     InstanceHandle_t m_key;
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
+    ParameterPropertyList_t m_properties;
 
 };
 
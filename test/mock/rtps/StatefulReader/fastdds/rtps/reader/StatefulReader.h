@@ -98,7 +98,8 @@ public:
     }
 
     bool send_sync_nts(
-            CDRMessage_t* /*message*/,
+            const NetworkBuffers& /*buffers*/,
+            uint32_t /*total_bytes*/,
             const LocatorsIterator& /*destination_locators_begin*/,
             const LocatorsIterator& /*destination_locators_end*/,
             std::chrono::steady_clock::time_point& /*max_blocking_time_point*/)
@@ -157,6 +157,8 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor
     uint16_t logical_port_range;
     uint16_t logical_port_increment;
     uint32_t tcp_negotiation_timeout;
+    //! Number of threads serving the connections. Connections secured with TLS keep a thread of their own.
+    uint32_t io_threads;
     bool enable_tcp_nodelay;
     bool wait_for_tcp_negotiation;
     bool calculate_crc;
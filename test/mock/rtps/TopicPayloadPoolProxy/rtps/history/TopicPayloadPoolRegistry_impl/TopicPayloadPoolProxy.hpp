@@ -130,6 +130,11 @@ public:
         return inner_pool_->payload_pool_available_size();
     }
 
+    PoolCounters payload_pool_counters() const override
+    {
+        return inner_pool_->payload_pool_counters();
+    }
+
 private:
 
     std::string topic_name_;
@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_RTPS_WLP_H_
 #define _FASTDDS_RTPS_WLP_H_
 
+#include <memory>
 #include <vector>
 #include <mutex>
 #include <gmock/gmock.h>
@@ -32,6 +33,7 @@ namespace fastrtps {
 namespace rtps {
 
 class BuiltinProtocols;
+struct LivelinessAssertion;
 
 /**
  * Class WLP that implements the Writer Liveliness Protocol described in the RTPS specification.
@@ -61,6 +63,15 @@ public:
                 GUID_t writer,
                 LivelinessQosPolicyKind kind,
                 Duration_t lease_duration));
+
+    bool assert_liveliness(
+            GUID_t writer,
+            LivelinessQosPolicyKind kind,
+            Duration_t lease_duration,
+            std::shared_ptr<LivelinessAssertion>&)
+    {
+        return assert_liveliness(writer, kind, lease_duration);
+    }
 };
 
 } /* namespace rtps */
@@ -0,0 +1,247 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryBenchmark.cpp
+ *
+ * Measures the time needed to discover and match the endpoints of several participants created in the same process.
+ * Each participant creates the same number of writers and readers, spread over a number of topics, so every reader
+ * matches the writers of its topic on all the participants.
+ * Usage: DiscoveryBenchmark [num_participants [num_endpoints [num_topics]]]
+ */
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/ReaderQos.h>
+#include <fastrtps/qos/WriterQos.h>
+
+#if defined(_WIN32)
+#define GET_PID _getpid
+#include <process.h>
+#else
+#define GET_PID getpid
+#include <sys/types.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Maximum time to wait for all the endpoints to be matched
+constexpr std::chrono::seconds discovery_timeout(120);
+
+class DiscoveryBenchmark : public ReaderListener
+{
+public:
+
+    DiscoveryBenchmark(
+            size_t num_participants,
+            size_t num_endpoints,
+            size_t num_topics)
+        : num_participants_(num_participants)
+        , num_endpoints_(num_endpoints)
+        , num_topics_(num_topics)
+    {
+    }
+
+    ~DiscoveryBenchmark()
+    {
+        for (RTPSParticipant* participant : participants_)
+        {
+            RTPSDomain::removeRTPSParticipant(participant);
+        }
+    }
+
+    bool run()
+    {
+        // Every reader matches the writers of its topic on all the participants, including its own
+        size_t expected_matches = 0;
+        for (size_t topic = 0; topic < num_topics_; ++topic)
+        {
+            size_t endpoints_on_topic = num_participants_ * (num_endpoints_ / num_topics_ +
+                    (topic < num_endpoints_ % num_topics_ ? 1 : 0));
+            expected_matches += endpoints_on_topic * endpoints_on_topic;
+        }
+
+        uint32_t domain_id = static_cast<uint32_t>(GET_PID()) % 230;
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < num_participants_; ++i)
+        {
+            if (!create_participant(domain_id))
+            {
+                return false;
+            }
+        }
+        Clock::time_point created = Clock::now();
+
+        bool all_matched = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            all_matched = cv_.wait_for(lock, discovery_timeout, [&]()
+                            {
+                                return matches_ >= expected_matches;
+                            });
+        }
+        Clock::time_point matched = Clock::now();
+
+        printf("%6zu participants x %6zu endpoints on %6zu topics: creation %10.3f ms | all matched %10.3f ms\n",
+                num_participants_, num_endpoints_, num_topics_,
+                std::chrono::duration<double, std::milli>(created - start).count(),
+                std::chrono::duration<double, std::milli>(matched - start).count());
+
+        if (!all_matched)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            printf("Only %zu of %zu matches were done\n", matches_, expected_matches);
+        }
+        return all_matched;
+    }
+
+    void onReaderMatched(
+            RTPSReader*,
+            MatchingInfo& info) override
+    {
+        if (MATCHED_MATCHING == info.status)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++matches_;
+            cv_.notify_one();
+        }
+    }
+
+private:
+
+    bool create_participant(
+            uint32_t domain_id)
+    {
+        RTPSParticipantAttributes participant_attributes;
+        participant_attributes.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::SIMPLE;
+        participant_attributes.builtin.use_WriterLivelinessProtocol = false;
+        RTPSParticipant* participant = RTPSDomain::createParticipant(domain_id, participant_attributes);
+        if (participant == nullptr)
+        {
+            printf("Cannot create participant\n");
+            return false;
+        }
+        participants_.push_back(participant);
+
+        HistoryAttributes history_attributes(PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 16, 1, 0);
+        for (size_t i = 0; i < num_endpoints_; ++i)
+        {
+            TopicAttributes topic_attributes;
+            topic_attributes.topicKind = NO_KEY;
+            topic_attributes.topicDataType = "DiscoveryBenchmarkType";
+            topic_attributes.topicName = "DiscoveryBenchmarkTopic_" + std::to_string(i % num_topics_);
+
+            writer_histories_.emplace_back(new WriterHistory(history_attributes));
+            WriterAttributes writer_attributes;
+            writer_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+            RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attributes,
+                            writer_histories_.back().get());
+            WriterQos writer_qos;
+            writer_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            if (writer == nullptr || !participant->registerWriter(writer, topic_attributes, writer_qos))
+            {
+                printf("Cannot create writer\n");
+                return false;
+            }
+
+            reader_histories_.emplace_back(new ReaderHistory(history_attributes));
+            ReaderAttributes reader_attributes;
+            reader_attributes.endpoint.reliabilityKind = BEST_EFFORT;
+            RTPSReader* reader = RTPSDomain::createRTPSReader(participant, reader_attributes,
+                            reader_histories_.back().get(), this);
+            ReaderQos reader_qos;
+            reader_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            if (reader == nullptr || !participant->registerReader(reader, topic_attributes, reader_qos))
+            {
+                printf("Cannot create reader\n");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t num_participants_;
+
+    size_t num_endpoints_;
+
+    size_t num_topics_;
+
+    std::vector<RTPSParticipant*> participants_;
+
+    std::vector<std::unique_ptr<WriterHistory>> writer_histories_;
+
+    std::vector<std::unique_ptr<ReaderHistory>> reader_histories_;
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    size_t matches_ = 0;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t values[] = {10, 50, 0};
+    if (argc > 4)
+    {
+        printf("Usage: %s [num_participants [num_endpoints [num_topics]]]\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_participants [num_endpoints [num_topics]]]\n", argv[0]);
+            return 1;
+        }
+        values[i - 1] = static_cast<size_t>(value);
+    }
+
+    // By default, each endpoint of a participant is on its own topic
+    if (0 == values[2])
+    {
+        values[2] = values[1];
+    }
+
+    DiscoveryBenchmark benchmark(values[0], values[1], values[2]);
+    return benchmark.run() ? 0 : 1;
+}
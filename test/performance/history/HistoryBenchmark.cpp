@@ -0,0 +1,229 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HistoryBenchmark.cpp
+ *
+ * Measures the cost of the operations done on the changes of a KEEP_ALL history: appending changes, inserting
+ * changes received out of order, looking them up by sequence number and removing them from the front, as a late
+ * joiner acknowledging the whole history does.
+ * Usage: HistoryBenchmark [num_changes ...]
+ */
+
+#include <fastdds/rtps/history/History.h>
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Every this number of changes, two consecutive changes are received swapped
+constexpr size_t out_of_order_period = 10;
+
+/**
+ * History that only keeps the changes given to it, using the same operations as writer and reader histories.
+ */
+class BenchmarkHistory : public History
+{
+public:
+
+    BenchmarkHistory()
+        : History(HistoryAttributes())
+    {
+        mp_mutex = &mutex_;
+    }
+
+    //! Appends a change, as writer histories do.
+    void append(
+            CacheChange_t* change)
+    {
+        m_changes.push_back(change);
+    }
+
+    //! Inserts a change keeping the changes ordered, as reader histories do.
+    void insert(
+            CacheChange_t* change)
+    {
+        if (!m_changes.empty() && change->sequenceNumber < m_changes.back()->sequenceNumber)
+        {
+            auto it = std::lower_bound(m_changes.begin(), m_changes.end(), change,
+                            [](const CacheChange_t* a, const CacheChange_t* b)
+                            {
+                                return a->sequenceNumber < b->sequenceNumber;
+                            });
+            m_changes.insert(it, change);
+        }
+        else
+        {
+            m_changes.push_back(change);
+        }
+    }
+
+    //! Looks a change up by its sequence number.
+    CacheChange_t* lookup(
+            const SequenceNumber_t& seq)
+    {
+        auto it = std::lower_bound(changesBegin(), changesEnd(), seq,
+                        [](const CacheChange_t* change, const SequenceNumber_t& sequence_number)
+                        {
+                            return change->sequenceNumber < sequence_number;
+                        });
+        return (it != changesEnd() && (*it)->sequenceNumber == seq) ? *it : nullptr;
+    }
+
+protected:
+
+    bool do_reserve_cache(
+            CacheChange_t**,
+            uint32_t) override
+    {
+        return false;
+    }
+
+    void do_release_cache(
+            CacheChange_t*) override
+    {
+    }
+
+private:
+
+    eprosima::fastrtps::RecursiveTimedMutex mutex_;
+};
+
+static double ns_per_change(
+        const Clock::time_point& start,
+        size_t num_changes)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(num_changes);
+}
+
+static bool run(
+        size_t num_changes)
+{
+    std::vector<std::unique_ptr<CacheChange_t>> changes;
+    changes.reserve(num_changes);
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        changes.emplace_back(new CacheChange_t());
+        changes.back()->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(i + 1));
+    }
+
+    BenchmarkHistory history;
+
+    // Writer side: append all changes
+    Clock::time_point start = Clock::now();
+    for (auto& change : changes)
+    {
+        history.append(change.get());
+    }
+    double append_ns = ns_per_change(start, num_changes);
+
+    // Late joiner: every change is looked up by sequence number
+    start = Clock::now();
+    size_t found = 0;
+    for (auto& change : changes)
+    {
+        found += (nullptr != history.lookup(change->sequenceNumber)) ? 1 : 0;
+    }
+    double lookup_ns = ns_per_change(start, num_changes);
+
+    // Acknowledged changes are removed from the front
+    start = Clock::now();
+    for (auto& change : changes)
+    {
+        history.remove_change_nts(history.find_change_nts(change.get()), false);
+    }
+    double remove_ns = ns_per_change(start, num_changes);
+
+    // Reader side: changes received slightly out of order
+    start = Clock::now();
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        size_t index = i;
+        if ((i % out_of_order_period) == 0 && (i + 1) < num_changes)
+        {
+            index = i + 1;
+        }
+        else if ((i % out_of_order_period) == 1)
+        {
+            index = i - 1;
+        }
+        history.insert(changes[index].get());
+    }
+    double insert_ns = ns_per_change(start, num_changes);
+    bool ordered = std::is_sorted(history.changesBegin(), history.changesEnd(),
+                    [](const CacheChange_t* a, const CacheChange_t* b)
+                    {
+                        return a->sequenceNumber < b->sequenceNumber;
+                    });
+
+    start = Clock::now();
+    while (history.changesBegin() != history.changesEnd())
+    {
+        history.remove_change_nts(history.changesBegin(), false);
+    }
+    double pop_ns = ns_per_change(start, num_changes);
+
+    printf("%8zu changes: append %8.1f ns | lookup %8.1f ns | remove %8.1f ns | "
+            "insert %8.1f ns | pop front %8.1f ns\n",
+            num_changes, append_ns, lookup_ns, remove_ns, insert_ns, pop_ns);
+
+    if (found != num_changes || !ordered)
+    {
+        printf("Unexpected contents on the history\n");
+        return false;
+    }
+
+    return true;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_changes ...]\n", argv[0]);
+            return 1;
+        }
+        sizes.push_back(static_cast<size_t>(value));
+    }
+
+    if (sizes.empty())
+    {
+        sizes = {1000u, 10000u, 100000u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_changes : sizes)
+    {
+        if (!run(num_changes))
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
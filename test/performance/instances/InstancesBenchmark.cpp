@@ -0,0 +1,183 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstancesBenchmark.cpp
+ *
+ * Measures the bookkeeping done by keyed histories on each received sample: updating the deadline of its instance,
+ * finding the next instance to miss its deadline, and evicting instances without changes when the maximum number of
+ * instances is reached.
+ * Usage: InstancesBenchmark [num_samples [num_instances ...]]
+ */
+
+#include <fastrtps/common/KeyedChangesCollection.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Deadline period of the instances
+constexpr std::chrono::milliseconds deadline_period(100);
+
+static InstanceHandle_t make_handle(
+        uint32_t index)
+{
+    // Short keys are stored on the handle without being hashed
+    InstanceHandle_t handle;
+    memcpy(handle.value, &index, sizeof(index));
+    return handle;
+}
+
+class InstancesBenchmark
+{
+public:
+
+    InstancesBenchmark(
+            size_t num_samples,
+            size_t num_instances)
+        : num_samples_(num_samples)
+        , num_instances_(num_instances)
+        , changes_(num_instances)
+    {
+    }
+
+    bool run()
+    {
+        KeyedChangesCollection instances;
+        Clock::time_point now = Clock::now();
+        for (size_t i = 0; i < num_instances_; ++i)
+        {
+            changes_[i].instanceHandle = make_handle(static_cast<uint32_t>(i));
+            auto it = instances.insert(changes_[i].instanceHandle);
+            instances.push_change(it, &changes_[i]);
+            instances.set_next_deadline(it, now + deadline_period);
+        }
+
+        // Each sample renews the deadline of its instance and reschedules the deadline timer, as readers do
+        InstanceHandle_t next_handle;
+        Clock::time_point next_deadline;
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < num_samples_; ++i)
+        {
+            auto it = instances.find(make_handle(static_cast<uint32_t>(i % num_instances_)));
+            instances.set_next_deadline(it, Clock::now() + deadline_period);
+            instances.get_next_deadline(next_handle, next_deadline);
+        }
+        double deadline_ns = ns_per_sample(start);
+
+        // Samples are received in order, so the next instance to miss its deadline is the one following the last
+        uint32_t expected = static_cast<uint32_t>(num_samples_ % num_instances_);
+        if (num_samples_ >= num_instances_ && !(next_handle == make_handle(expected)))
+        {
+            printf("Unexpected instance on the deadline heap\n");
+            return false;
+        }
+
+        // Each sample belongs to a new instance and removes the change of an old one, leaving it empty
+        start = Clock::now();
+        for (size_t i = 0; i < num_samples_; ++i)
+        {
+            size_t slot = i % num_instances_;
+            auto old_instance = instances.find(changes_[slot].instanceHandle);
+            instances.erase_change(old_instance, old_instance->second.cache_changes.begin());
+
+            if (!instances.erase_empty())
+            {
+                printf("No instance could be evicted\n");
+                return false;
+            }
+
+            changes_[slot].instanceHandle = make_handle(static_cast<uint32_t>(num_instances_ + i));
+            auto it = instances.insert(changes_[slot].instanceHandle);
+            instances.push_change(it, &changes_[slot]);
+            instances.set_next_deadline(it, Clock::now() + deadline_period);
+        }
+        double eviction_ns = ns_per_sample(start);
+
+        if (instances.size() != num_instances_)
+        {
+            printf("Unexpected number of instances\n");
+            return false;
+        }
+
+        printf("%8zu instances: deadline update %8.1f ns/sample | instance eviction %8.1f ns/sample\n",
+                num_instances_, deadline_ns, eviction_ns);
+        return true;
+    }
+
+private:
+
+    double ns_per_sample(
+            const Clock::time_point& start) const
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+               static_cast<double>(num_samples_);
+    }
+
+    size_t num_samples_;
+
+    size_t num_instances_;
+
+    std::vector<CacheChange_t> changes_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 100000;
+    std::vector<size_t> instances;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_samples [num_instances ...]]\n", argv[0]);
+            return 1;
+        }
+
+        if (1 == i)
+        {
+            num_samples = static_cast<size_t>(value);
+        }
+        else
+        {
+            instances.push_back(static_cast<size_t>(value));
+        }
+    }
+
+    if (instances.empty())
+    {
+        instances = {100u, 1000u, 10000u, 50000u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_instances : instances)
+    {
+        InstancesBenchmark benchmark(num_samples, num_instances);
+        if (!benchmark.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
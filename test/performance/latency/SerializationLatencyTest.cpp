@@ -0,0 +1,202 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SerializationLatencyTest.cpp
+ *
+ * Measures the time spent serializing and deserializing the sample of the latency test with the generated type,
+ * with DynamicData, and with the compiled layout of DynamicPubSubType.
+ * Usage: SerializationLatencyTest [num_samples [data_size ...]]
+ */
+
+#include "LatencyTestTypes.hpp"
+
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/FlatDynamicData.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::types;
+
+using Clock = std::chrono::steady_clock;
+
+class SerializationLatencyTest
+{
+public:
+
+    SerializationLatencyTest(
+            size_t num_samples,
+            uint32_t data_size)
+        : num_samples_(num_samples)
+        , data_size_(data_size)
+    {
+    }
+
+    bool run()
+    {
+        // Same type as the dynamic data mode of the latency test
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder_ptr struct_type_builder(factory->create_struct_builder());
+        struct_type_builder->add_member(0, "seqnum", factory->create_uint32_type());
+        struct_type_builder->add_member(1, "data",
+                factory->create_sequence_builder(factory->create_byte_type(), data_size_));
+        struct_type_builder->set_name("LatencyType");
+        DynamicType_ptr dynamic_type = struct_type_builder->build();
+
+        // Generated type
+        LatencyDataType generated_type;
+        LatencyType generated_in(data_size_);
+        LatencyType generated_out;
+        generated_in.seqnum = 1;
+        memset(generated_in.data.data(), 0xAA, data_size_);
+
+        // DynamicData
+        DynamicPubSubType dynamic_pub_sub_type(dynamic_type);
+        DynamicData* dynamic_in = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+        DynamicData* dynamic_out = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+        dynamic_in->set_uint32_value(1, 0);
+        DynamicData* sequence = dynamic_in->loan_value(1);
+        for (uint32_t i = 0; i < data_size_; ++i)
+        {
+            MemberId id;
+            sequence->insert_sequence_data(id);
+            sequence->set_byte_value(0xAA, id);
+        }
+        dynamic_in->return_loaned_value(sequence);
+
+        // Compiled layout
+        DynamicPubSubType compiled_pub_sub_type(dynamic_type);
+        if (!compiled_pub_sub_type.EnableCompiledLayout())
+        {
+            printf("Cannot compile the layout of the type\n");
+            return false;
+        }
+        FlatDynamicData* compiled_in = static_cast<FlatDynamicData*>(compiled_pub_sub_type.createData());
+        FlatDynamicData* compiled_out = static_cast<FlatDynamicData*>(compiled_pub_sub_type.createData());
+        compiled_in->set_value(1u, 0);
+        compiled_in->resize_sequence(1, data_size_);
+        uint32_t count = 0;
+        memset(compiled_in->get_elements<octet>(1, count), 0xAA, data_size_);
+
+        SerializedPayload_t payload(data_size_ + 64);
+        bool ret = measure("generated", generated_type, &generated_in, &generated_out, payload) &&
+                measure("DynamicData", dynamic_pub_sub_type, dynamic_in, dynamic_out, payload) &&
+                measure("compiled", compiled_pub_sub_type, compiled_in, compiled_out, payload);
+
+        DynamicDataFactory::get_instance()->delete_data(dynamic_in);
+        DynamicDataFactory::get_instance()->delete_data(dynamic_out);
+        compiled_pub_sub_type.deleteData(compiled_in);
+        compiled_pub_sub_type.deleteData(compiled_out);
+        return ret;
+    }
+
+private:
+
+    bool measure(
+            const char* name,
+            TopicDataType& type,
+            void* data_in,
+            void* data_out,
+            SerializedPayload_t& payload)
+    {
+        Clock::duration serialize_time(0);
+        Clock::duration deserialize_time(0);
+        for (size_t i = 0; i < num_samples_; ++i)
+        {
+            Clock::time_point start = Clock::now();
+            if (!type.serialize(data_in, &payload))
+            {
+                printf("Cannot serialize %s sample\n", name);
+                return false;
+            }
+            Clock::time_point end = Clock::now();
+            serialize_time += end - start;
+
+            start = Clock::now();
+            if (!type.deserialize(&payload, data_out))
+            {
+                printf("Cannot deserialize %s sample\n", name);
+                return false;
+            }
+            end = Clock::now();
+            deserialize_time += end - start;
+        }
+
+        double samples = static_cast<double>(num_samples_);
+        printf("%8u bytes %-12s: serialize %10.3f us | deserialize %10.3f us\n",
+                data_size_,
+                name,
+                std::chrono::duration<double, std::micro>(serialize_time).count() / samples,
+                std::chrono::duration<double, std::micro>(deserialize_time).count() / samples);
+        return true;
+    }
+
+    size_t num_samples_;
+
+    uint32_t data_size_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 1000;
+    std::vector<uint32_t> data_sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_samples [data_size ...]]\n", argv[0]);
+            return 1;
+        }
+
+        if (1 == i)
+        {
+            num_samples = static_cast<size_t>(value);
+        }
+        else
+        {
+            data_sizes.push_back(static_cast<uint32_t>(value));
+        }
+    }
+
+    if (data_sizes.empty())
+    {
+        // DynamicData keeps each element of the sequence on its own object, so the largest sizes of the latency
+        // test are left out by default
+        data_sizes = {16 - 4, 1024 - 4, 64512 - 4};
+    }
+
+    int ret_code = 0;
+    for (uint32_t data_size : data_sizes)
+    {
+        SerializationLatencyTest test(num_samples, data_size);
+        if (!test.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
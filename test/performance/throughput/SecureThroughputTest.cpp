@@ -0,0 +1,206 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SecureThroughputTest.cpp
+ *
+ * Variant of the throughput test that measures the payload protection of the builtin cryptographic plugin in
+ * isolation. Each thread encrypts the samples of its own writer, so writers that should not contend are measured
+ * together.
+ * Usage: SecureThroughputTest [num_samples [payload_size [num_threads ...]]]
+ */
+
+#include <security/cryptography/AESGCMGMAC.h>
+#include <security/authentication/PKIIdentityHandle.h>
+#include <security/accesscontrol/AccessPermissionsHandle.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+using Clock = std::chrono::steady_clock;
+
+class SecureThroughputTest
+{
+public:
+
+    SecureThroughputTest(
+            size_t num_samples,
+            uint32_t payload_size,
+            size_t num_threads)
+        : num_samples_(num_samples)
+        , payload_size_(payload_size)
+        , num_threads_(num_threads)
+    {
+    }
+
+    bool run()
+    {
+        AESGCMGMAC plugin;
+        PKIIdentityHandle identity_handle;
+        AccessPermissionsHandle permissions_handle;
+        PropertySeq properties;
+        SecurityException exception;
+
+        ParticipantSecurityAttributes participant_attributes;
+        ParticipantCryptoHandle* participant = plugin.keyfactory()->register_local_participant(identity_handle,
+                        permissions_handle, properties, participant_attributes, exception);
+        if (participant == nullptr)
+        {
+            printf("Cannot register participant: %s\n", exception.what());
+            return false;
+        }
+
+        EndpointSecurityAttributes writer_attributes;
+        writer_attributes.is_payload_protected = true;
+        writer_attributes.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+        std::vector<DatawriterCryptoHandle*> writers;
+        for (size_t i = 0; i < num_threads_; ++i)
+        {
+            DatawriterCryptoHandle* writer = plugin.keyfactory()->register_local_datawriter(*participant,
+                            properties, writer_attributes, exception);
+            if (writer == nullptr)
+            {
+                printf("Cannot register writer: %s\n", exception.what());
+                return false;
+            }
+            writers.push_back(writer);
+        }
+
+        std::vector<bool> results(num_threads_, true);
+        std::vector<std::thread> threads;
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < num_threads_; ++i)
+        {
+            threads.emplace_back([&, i]()
+                    {
+                        results[i] = encode(plugin, *writers[i]);
+                    });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        for (DatawriterCryptoHandle* writer : writers)
+        {
+            plugin.keyfactory()->unregister_datawriter(writer, exception);
+        }
+        plugin.keyfactory()->unregister_participant(participant, exception);
+
+        for (bool result : results)
+        {
+            if (!result)
+            {
+                printf("Cannot encode payload\n");
+                return false;
+            }
+        }
+
+        double samples = static_cast<double>(num_samples_ * num_threads_);
+        printf("%2zu threads, %6u bytes: %10.0f samples/s | %8.1f MB/s\n",
+                num_threads_, payload_size_, samples / seconds,
+                samples * payload_size_ / seconds / (1024.0 * 1024.0));
+        return true;
+    }
+
+private:
+
+    bool encode(
+            AESGCMGMAC& plugin,
+            DatawriterCryptoHandle& writer)
+    {
+        SerializedPayload_t plain_payload(payload_size_);
+        memset(plain_payload.data, 0xA5, payload_size_);
+        plain_payload.length = payload_size_;
+
+        // Room for the header, the padding of the cipher and the tag
+        SerializedPayload_t encoded_payload(payload_size_ + 128);
+        std::vector<uint8_t> extra_inline_qos;
+        SecurityException exception;
+
+        for (size_t i = 0; i < num_samples_; ++i)
+        {
+            if (!plugin.cryptotransform()->encode_serialized_payload(encoded_payload, extra_inline_qos,
+                    plain_payload, writer, exception))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t num_samples_;
+
+    uint32_t payload_size_;
+
+    size_t num_threads_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 100000;
+    uint32_t payload_size = 1024;
+    std::vector<size_t> threads;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_samples [payload_size [num_threads ...]]]\n", argv[0]);
+            return 1;
+        }
+
+        if (1 == i)
+        {
+            num_samples = static_cast<size_t>(value);
+        }
+        else if (2 == i)
+        {
+            payload_size = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            threads.push_back(static_cast<size_t>(value));
+        }
+    }
+
+    if (threads.empty())
+    {
+        threads = {1u, 2u, 4u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_threads : threads)
+    {
+        SecureThroughputTest test(num_samples, payload_size, num_threads);
+        if (!test.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
@@ -0,0 +1,255 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SyscallThroughputTest.cpp
+ *
+ * Variant of the throughput test that measures the UDP send path of the transport in isolation,
+ * counting the system calls issued for each sample sent to a number of destinations.
+ * Usage: SyscallThroughputTest [num_samples [num_destinations ...]]
+ */
+
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+#include <fastdds/rtps/transport/UDPv4Transport.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <dlfcn.h>
+#include <sys/socket.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Number of calls to each of the intercepted system calls
+static std::atomic<uint64_t> g_send_calls(0);
+static std::atomic<uint64_t> g_setsockopt_calls(0);
+
+template<typename Function>
+static Function next_symbol(
+        const char* name)
+{
+    return reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+}
+
+// The definitions below take precedence over the ones on the C library, so every system call done by the
+// transport on this process is counted before being forwarded.
+
+extern "C" int setsockopt(
+        int fd,
+        int level,
+        int optname,
+        const void* optval,
+        socklen_t optlen) __THROW
+{
+    using Function = int (*)(int, int, int, const void*, socklen_t);
+    static Function next = next_symbol<Function>("setsockopt");
+    ++g_setsockopt_calls;
+    return next(fd, level, optname, optval, optlen);
+}
+
+extern "C" ssize_t sendto(
+        int fd,
+        const void* buf,
+        size_t len,
+        int flags,
+        const struct sockaddr* addr,
+        socklen_t addr_len)
+{
+    using Function = ssize_t (*)(int, const void*, size_t, int, const struct sockaddr*, socklen_t);
+    static Function next = next_symbol<Function>("sendto");
+    ++g_send_calls;
+    return next(fd, buf, len, flags, addr, addr_len);
+}
+
+extern "C" ssize_t sendmsg(
+        int fd,
+        const struct msghdr* message,
+        int flags)
+{
+    using Function = ssize_t (*)(int, const struct msghdr*, int);
+    static Function next = next_symbol<Function>("sendmsg");
+    ++g_send_calls;
+    return next(fd, message, flags);
+}
+
+extern "C" int sendmmsg(
+        int fd,
+        struct mmsghdr* messages,
+        unsigned int length,
+        int flags)
+{
+    using Function = int (*)(int, struct mmsghdr*, unsigned int, int);
+    static Function next = next_symbol<Function>("sendmmsg");
+    ++g_send_calls;
+    return next(fd, messages, length, flags);
+}
+
+//! First port used for the destinations
+constexpr uint16_t first_port = 27400;
+
+//! Size of the serialized payload of each sample
+constexpr uint32_t payload_size = 1024;
+
+class SyscallThroughputTest
+{
+public:
+
+    SyscallThroughputTest(
+            size_t num_samples,
+            size_t num_destinations)
+        : num_samples_(num_samples)
+        , num_destinations_(num_destinations)
+    {
+    }
+
+    bool run()
+    {
+        UDPv4TransportDescriptor descriptor;
+        descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+        UDPv4Transport transport(descriptor);
+        if (!transport.init())
+        {
+            printf("Cannot initialize the transport\n");
+            return false;
+        }
+
+        // Destinations are bound, so datagrams are discarded by the kernel instead of generating ICMP errors
+        asio::io_service io_service;
+        std::vector<std::unique_ptr<asio::ip::udp::socket>> sinks;
+        LocatorList_t destinations;
+        for (size_t i = 0; i < num_destinations_; ++i)
+        {
+            uint16_t port = static_cast<uint16_t>(first_port + i);
+            sinks.emplace_back(new asio::ip::udp::socket(io_service));
+            asio::error_code ec;
+            sinks.back()->open(asio::ip::udp::v4(), ec);
+            sinks.back()->bind(asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), port), ec);
+            if (!!ec)
+            {
+                printf("Cannot bind destination port %u\n", static_cast<unsigned int>(port));
+                return false;
+            }
+
+            Locator_t locator;
+            locator.kind = LOCATOR_KIND_UDPv4;
+            locator.port = port;
+            IPLocator::setIPv4(locator, 127, 0, 0, 1);
+            destinations.push_back(locator);
+        }
+
+        Locator_t output_locator;
+        output_locator.kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(output_locator, 127, 0, 0, 1);
+        SendResourceList send_resources;
+        if (!transport.OpenOutputChannel(send_resources, output_locator) || send_resources.empty())
+        {
+            printf("Cannot open output channel\n");
+            return false;
+        }
+
+        // Samples are sent as the message group does: header and submessage slices plus the referenced payload
+        std::vector<octet> header(44, 0);
+        std::vector<octet> payload(payload_size, 0xAA);
+        NetworkBuffers buffers;
+        buffers.emplace_back(header.data(), static_cast<uint32_t>(header.size()));
+        buffers.emplace_back(payload.data(), payload_size);
+        uint32_t total_bytes = static_cast<uint32_t>(header.size()) + payload_size;
+
+        uint64_t send_calls = g_send_calls.load();
+        uint64_t setsockopt_calls = g_setsockopt_calls.load();
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < num_samples_; ++i)
+        {
+            Locators locators_begin(destinations.begin());
+            Locators locators_end(destinations.end());
+            send_resources.front()->send(buffers, total_bytes, &locators_begin, &locators_end,
+                    Clock::now() + std::chrono::milliseconds(100));
+        }
+        Clock::time_point end = Clock::now();
+        send_calls = g_send_calls.load() - send_calls;
+        setsockopt_calls = g_setsockopt_calls.load() - setsockopt_calls;
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double samples = static_cast<double>(num_samples_);
+        printf("%4zu destinations: %10.0f samples/s | %10.0f datagrams/s | "
+                "syscalls/sample %7.3f (send %7.3f, setsockopt %7.3f)\n",
+                num_destinations_,
+                samples / seconds,
+                samples * static_cast<double>(num_destinations_) / seconds,
+                static_cast<double>(send_calls + setsockopt_calls) / samples,
+                static_cast<double>(send_calls) / samples,
+                static_cast<double>(setsockopt_calls) / samples);
+        return true;
+    }
+
+private:
+
+    size_t num_samples_;
+
+    size_t num_destinations_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 10000;
+    std::vector<size_t> destinations;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_samples [num_destinations ...]]\n", argv[0]);
+            return 1;
+        }
+
+        if (1 == i)
+        {
+            num_samples = static_cast<size_t>(value);
+        }
+        else
+        {
+            destinations.push_back(static_cast<size_t>(value));
+        }
+    }
+
+    if (destinations.empty())
+    {
+        destinations = {1u, 4u, 16u, 64u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_destinations : destinations)
+    {
+        SyscallThroughputTest test(num_samples, num_destinations);
+        if (!test.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
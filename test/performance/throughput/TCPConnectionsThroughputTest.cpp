@@ -0,0 +1,289 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TCPConnectionsThroughputTest.cpp
+ *
+ * Variant of the throughput test that measures the TCP receive path of the transport in isolation,
+ * with many connections sending to the same listening port, and counts the threads of the process.
+ * Usage: TCPConnectionsThroughputTest [num_messages [io_threads [num_connections ...]]]
+ */
+
+#include <fastdds/rtps/transport/TCPv4Transport.h>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastdds/rtps/transport/tcp/RTCPHeader.h>
+#include <fastdds/rtps/transport/tcp/RTCPMessageManager.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <asio.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Listening port of the transport
+constexpr uint16_t listening_port = 27500;
+
+//! Logical port the messages are sent to
+constexpr uint16_t logical_port = 7410;
+
+//! Size of each message, without the TCP header
+constexpr uint32_t payload_size = 1024;
+
+//! Number of threads sending through the connections
+constexpr size_t num_sender_threads = 4;
+
+//! Counts the threads of the process
+static size_t count_threads()
+{
+    size_t threads = 0;
+    DIR* dir = opendir("/proc/self/task");
+    if (nullptr != dir)
+    {
+        while (dirent* entry = readdir(dir))
+        {
+            if ('.' != entry->d_name[0])
+            {
+                ++threads;
+            }
+        }
+        closedir(dir);
+    }
+    return threads;
+}
+
+//! Receiver that counts the messages delivered by the transport
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    void OnDataReceived(
+            const octet*,
+            const uint32_t,
+            const Locator_t&,
+            const Locator_t&) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++received_;
+        cv_.notify_one();
+    }
+
+    bool wait(
+            uint64_t expected,
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return expected <= received_;
+                       });
+    }
+
+    uint64_t received()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return received_;
+    }
+
+private:
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    uint64_t received_ = 0;
+};
+
+class TCPConnectionsThroughputTest
+{
+public:
+
+    TCPConnectionsThroughputTest(
+            size_t num_messages,
+            uint32_t io_threads,
+            size_t num_connections)
+        : num_messages_(num_messages)
+        , io_threads_(io_threads)
+        , num_connections_(num_connections)
+    {
+    }
+
+    bool run()
+    {
+        size_t initial_threads = count_threads();
+
+        TCPv4TransportDescriptor descriptor;
+        descriptor.add_listener_port(listening_port);
+        descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+        descriptor.io_threads = io_threads_;
+        TCPv4Transport transport(descriptor);
+        if (!transport.init())
+        {
+            printf("Cannot initialize the transport\n");
+            return false;
+        }
+
+        Locator_t input_locator;
+        input_locator.kind = LOCATOR_KIND_TCPv4;
+        input_locator.port = listening_port;
+        IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+        IPLocator::setLogicalPort(input_locator, logical_port);
+        CountingReceiver receiver;
+        if (!transport.OpenInputChannel(input_locator, &receiver, descriptor.maxMessageSize))
+        {
+            printf("Cannot open input channel\n");
+            return false;
+        }
+
+        asio::io_service io_service;
+        std::vector<std::unique_ptr<asio::ip::tcp::socket>> connections;
+        asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), listening_port);
+        for (size_t i = 0; i < num_connections_; ++i)
+        {
+            connections.emplace_back(new asio::ip::tcp::socket(io_service));
+            asio::error_code ec;
+            connections.back()->connect(endpoint, ec);
+            if (!!ec)
+            {
+                printf("Cannot open connection %zu: %s\n", i, ec.message().c_str());
+                return false;
+            }
+            connections.back()->set_option(asio::ip::tcp::no_delay(true), ec);
+        }
+
+        // Messages carry the checksum, so the transport verifies all of them
+        std::vector<octet> message(TCPHeader::size() + payload_size, 0xAA);
+        TCPHeader header;
+        header.length = static_cast<uint32_t>(message.size());
+        header.logical_port = logical_port;
+        header.crc = RTCPMessageManager::addToCRC(0, message.data() + TCPHeader::size(), payload_size);
+        memcpy(message.data(), header.address(), TCPHeader::size());
+
+        Clock::time_point start = Clock::now();
+        std::vector<std::thread> senders;
+        for (size_t t = 0; t < num_sender_threads; ++t)
+        {
+            senders.emplace_back([&, t]()
+                    {
+                        for (size_t i = t; i < num_connections_; i += num_sender_threads)
+                        {
+                            for (size_t n = 0; n < num_messages_; ++n)
+                            {
+                                asio::error_code ec;
+                                asio::write(*connections[i], asio::buffer(message), ec);
+                            }
+                        }
+                    });
+        }
+
+        for (std::thread& sender : senders)
+        {
+            sender.join();
+        }
+
+        uint64_t expected = static_cast<uint64_t>(num_messages_) * num_connections_;
+        bool all_received = receiver.wait(expected, std::chrono::seconds(30));
+        Clock::time_point end = Clock::now();
+        size_t threads = count_threads() - initial_threads;
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double messages = static_cast<double>(receiver.received());
+        printf("%5zu connections, %2u io threads: %10.0f messages/s | %8.1f MB/s | %4zu threads created%s\n",
+                num_connections_,
+                io_threads_,
+                messages / seconds,
+                messages * payload_size / seconds / (1024.0 * 1024.0),
+                threads,
+                all_received ? "" : " | messages lost");
+
+        for (auto& connection : connections)
+        {
+            asio::error_code ec;
+            connection->shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+            connection->close(ec);
+        }
+
+        return all_received;
+    }
+
+private:
+
+    size_t num_messages_;
+
+    uint32_t io_threads_;
+
+    size_t num_connections_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_messages = 1000;
+    uint32_t io_threads = 2;
+    std::vector<size_t> connections;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_messages [io_threads [num_connections ...]]]\n", argv[0]);
+            return 1;
+        }
+
+        if (1 == i)
+        {
+            num_messages = static_cast<size_t>(value);
+        }
+        else if (2 == i)
+        {
+            io_threads = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            connections.push_back(static_cast<size_t>(value));
+        }
+    }
+
+    if (connections.empty())
+    {
+        connections = {1u, 16u, 128u, 512u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_connections : connections)
+    {
+        TCPConnectionsThroughputTest test(num_messages, io_threads, num_connections);
+        if (!test.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
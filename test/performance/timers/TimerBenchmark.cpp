@@ -0,0 +1,232 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerBenchmark.cpp
+ *
+ * Measures the accuracy and the CPU usage of ResourceEvent with a large number of active timers.
+ * Usage: TimerBenchmark [num_timers ...]
+ */
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! Minimum interval of the timers, in milliseconds
+constexpr double min_interval_ms = 100.0;
+
+//! Maximum interval of the timers, in milliseconds
+constexpr double max_interval_ms = 1100.0;
+
+class TimerBenchmark
+{
+public:
+
+    explicit TimerBenchmark(
+            size_t num_timers)
+        : num_timers_(num_timers)
+        , fired_(0)
+        , recording_(true)
+    {
+        intervals_.resize(num_timers_);
+        arm_times_.resize(num_timers_);
+        lateness_us_.resize(num_timers_);
+    }
+
+    bool run()
+    {
+        ResourceEvent service;
+        service.init_thread();
+
+        // Timers are spread uniformly on the intervals range
+        std::mt19937 gen(static_cast<std::mt19937::result_type>(num_timers_));
+        std::uniform_real_distribution<double> dis(min_interval_ms, max_interval_ms);
+
+        std::vector<std::unique_ptr<TimedEvent>> events(num_timers_);
+        for (size_t i = 0; i < num_timers_; ++i)
+        {
+            intervals_[i] = std::chrono::microseconds(static_cast<int64_t>(dis(gen) * 1000));
+            auto callback = [this, i]() -> bool
+                    {
+                        on_expiration(i);
+                        return false;
+                    };
+            events[i].reset(new TimedEvent(service, callback, intervals_[i].count() / 1000.0));
+        }
+
+        // Arm all the timers
+        fired_.store(0);
+        std::clock_t arm_cpu = std::clock();
+        Clock::time_point arm_start = Clock::now();
+        for (size_t i = 0; i < num_timers_; ++i)
+        {
+            arm_times_[i] = Clock::now();
+            events[i]->restart_timer();
+        }
+        Clock::time_point arm_end = Clock::now();
+        std::clock_t wait_cpu = std::clock();
+
+        // Wait for all of them to expire
+        bool all_fired = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            all_fired = cv_.wait_for(lock, std::chrono::milliseconds(static_cast<int64_t>(max_interval_ms)) +
+                            std::chrono::seconds(30), [this]()
+                            {
+                                return fired_.load() == num_timers_;
+                            });
+        }
+        Clock::time_point wait_end = Clock::now();
+        std::clock_t end_cpu = std::clock();
+
+        // Arm them again and cancel them. Expirations are not recorded anymore.
+        recording_.store(false);
+        for (size_t i = 0; i < num_timers_; ++i)
+        {
+            events[i]->restart_timer();
+        }
+        Clock::time_point cancel_start = Clock::now();
+        for (size_t i = 0; i < num_timers_; ++i)
+        {
+            events[i]->cancel_timer();
+        }
+        Clock::time_point cancel_end = Clock::now();
+
+        Clock::time_point destroy_start = Clock::now();
+        events.clear();
+        Clock::time_point destroy_end = Clock::now();
+
+        if (!all_fired)
+        {
+            printf("%10zu timers: only %zu expired on time\n", num_timers_, fired_.load());
+            return false;
+        }
+
+        std::sort(lateness_us_.begin(), lateness_us_.end());
+        double wait_seconds = std::chrono::duration<double>(wait_end - arm_end).count();
+        double cpu_usage = 100.0 * (static_cast<double>(end_cpu - wait_cpu) / CLOCKS_PER_SEC) / wait_seconds;
+
+        printf("%10zu timers: arm %8.1f ns/op | cancel %8.1f ns/op | destroy %8.1f ns/op | "
+                "late (us) p50 %7lld p99 %7lld max %7lld | cpu %5.1f %% (arm cpu %.3f s)\n",
+                num_timers_,
+                ns_per_op(arm_start, arm_end),
+                ns_per_op(cancel_start, cancel_end),
+                ns_per_op(destroy_start, destroy_end),
+                static_cast<long long>(percentile(0.50)),
+                static_cast<long long>(percentile(0.99)),
+                static_cast<long long>(lateness_us_.back()),
+                cpu_usage,
+                static_cast<double>(wait_cpu - arm_cpu) / CLOCKS_PER_SEC);
+        return true;
+    }
+
+private:
+
+    void on_expiration(
+            size_t index)
+    {
+        if (!recording_.load())
+        {
+            return;
+        }
+
+        Clock::time_point expected = arm_times_[index] + intervals_[index];
+        lateness_us_[index] = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - expected).count();
+
+        if (fired_.fetch_add(1) + 1 == num_timers_)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_one();
+        }
+    }
+
+    double ns_per_op(
+            const Clock::time_point& start,
+            const Clock::time_point& end) const
+    {
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(num_timers_);
+    }
+
+    int64_t percentile(
+            double p) const
+    {
+        size_t index = static_cast<size_t>(p * static_cast<double>(num_timers_ - 1));
+        return lateness_us_[index];
+    }
+
+    size_t num_timers_;
+
+    std::vector<std::chrono::microseconds> intervals_;
+
+    std::vector<Clock::time_point> arm_times_;
+
+    std::vector<int64_t> lateness_us_;
+
+    std::atomic<size_t> fired_;
+
+    std::atomic<bool> recording_;
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        long long value = std::atoll(argv[i]);
+        if (value <= 0)
+        {
+            printf("Usage: %s [num_timers ...]\n", argv[0]);
+            return 1;
+        }
+        sizes.push_back(static_cast<size_t>(value));
+    }
+
+    if (sizes.empty())
+    {
+        sizes = {10000u, 100000u, 1000000u};
+    }
+
+    int ret_code = 0;
+    for (size_t num_timers : sizes)
+    {
+        TimerBenchmark benchmark(num_timers);
+        if (!benchmark.run())
+        {
+            ret_code = 1;
+        }
+    }
+
+    return ret_code;
+}
@@ -24,6 +24,9 @@
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <dds/sub/Subscriber.hpp>
 #include <dds/sub/DataReader.hpp>
 #include <dds/sub/qos/DataReaderQos.hpp>
@@ -34,6 +37,9 @@
 #include <fastrtps/attributes/SubscriberAttributes.h>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
 
+#include <chrono>
+#include <cstring>
+#include <thread>
 
 namespace eprosima {
 namespace fastdds {
@@ -158,6 +164,201 @@ TEST(DataReaderTests, ReadData)
 }
 
 
+struct PlainType
+{
+    uint32_t index = 0;
+};
+
+FASTDDS_SEQUENCE(PlainTypeSeq, PlainType);
+
+class PlainTypeSupport : public TopicDataType
+{
+public:
+
+    PlainTypeSupport()
+        : TopicDataType()
+    {
+        m_typeSize = 4u + sizeof(PlainType);
+        setName("PlainType");
+    }
+
+    bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        payload->data[0] = 0;
+        payload->data[1] = CDR_LE;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        memcpy(payload->data + 4u, data, sizeof(PlainType));
+        payload->length = m_typeSize;
+        payload->encapsulation = CDR_LE;
+        return true;
+    }
+
+    bool deserialize(
+            fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        memcpy(data, payload->data + 4u, sizeof(PlainType));
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* /*data*/) override
+    {
+        return [this]()
+               {
+                   return m_typeSize;
+               };
+    }
+
+    void* createData() override
+    {
+        return new PlainType();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<PlainType*>(data);
+    }
+
+    bool getKey(
+            void* /*data*/,
+            fastrtps::rtps::InstanceHandle_t* /*ihandle*/,
+            bool /*force_md5*/) override
+    {
+        return true;
+    }
+
+    bool is_bounded() const override
+    {
+        return true;
+    }
+
+    bool is_plain() const override
+    {
+        return true;
+    }
+
+    bool construct_sample(
+            void* sample) const override
+    {
+        new (sample) PlainType();
+        return true;
+    }
+
+};
+
+TEST(DataReaderTests, ReadTakeSequences)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    ASSERT_NE(subscriber, nullptr);
+
+    TypeSupport type(new PlainTypeSupport());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("plaintopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    DataWriter* data_writer = publisher->create_datawriter(topic, writer_qos);
+    ASSERT_NE(data_writer, nullptr);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    DataReader* data_reader = subscriber->create_datareader(topic, reader_qos);
+    ASSERT_NE(data_reader, nullptr);
+
+    PlainTypeSeq data_seq;
+    SampleInfoSeq info_seq;
+    EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA, data_reader->read(data_seq, info_seq));
+
+    // Collections should have the same state
+    SampleInfoSeq owned_info_seq(1u);
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, data_reader->read(data_seq, owned_info_seq));
+
+    constexpr uint32_t num_samples = 3u;
+    PlainType data;
+    fastrtps::rtps::InstanceHandle_t handle;
+    for (uint32_t i = 1; i <= num_samples; ++i)
+    {
+        data.index = i;
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_writer->write(&data, handle));
+    }
+
+    // Wait for all the samples to be received
+    for (uint32_t tries = 0; tries < 100u && num_samples != data_seq.length(); ++tries)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_reader->return_loan(data_seq, info_seq));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        data_reader->read(data_seq, info_seq, LENGTH_UNLIMITED, READ_SAMPLE_STATE | NOT_READ_SAMPLE_STATE);
+    }
+
+    // Samples are loaned in order
+    ASSERT_EQ(num_samples, data_seq.length());
+    ASSERT_EQ(num_samples, info_seq.length());
+    EXPECT_FALSE(data_seq.has_ownership());
+    EXPECT_FALSE(info_seq.has_ownership());
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        EXPECT_EQ(i + 1u, data_seq[i].index);
+        EXPECT_TRUE(info_seq[i].valid_data);
+    }
+
+    // Loaned collections cannot be used until returned
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, data_reader->read(data_seq, info_seq));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader->return_loan(data_seq, info_seq));
+    EXPECT_TRUE(data_seq.has_ownership());
+    EXPECT_EQ(0u, data_seq.maximum());
+    EXPECT_EQ(0u, info_seq.maximum());
+
+    // All samples have been read
+    EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA,
+            data_reader->read(data_seq, info_seq, LENGTH_UNLIMITED, NOT_READ_SAMPLE_STATE));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_reader->read(data_seq, info_seq, 2, READ_SAMPLE_STATE));
+    ASSERT_EQ(2u, data_seq.length());
+    EXPECT_EQ(READ_SAMPLE_STATE, info_seq[0].sample_state);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader->return_loan(data_seq, info_seq));
+
+    // Take into collections owned by the application
+    PlainTypeSeq owned_data_seq(num_samples);
+    SampleInfoSeq owned_infos(num_samples);
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET,
+            data_reader->take(owned_data_seq, owned_infos, num_samples + 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_reader->take(owned_data_seq, owned_infos, 2));
+    ASSERT_EQ(2u, owned_data_seq.length());
+    EXPECT_TRUE(owned_data_seq.has_ownership());
+    EXPECT_EQ(1u, owned_data_seq[0].index);
+    EXPECT_EQ(2u, owned_data_seq[1].index);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader->return_loan(owned_data_seq, owned_infos));
+
+    // Take the remaining sample with a loan
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, data_reader->take(data_seq, info_seq));
+    ASSERT_EQ(1u, data_seq.length());
+    EXPECT_EQ(num_samples, data_seq[0].index);
+    EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA, data_reader->take(owned_data_seq, owned_infos));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader->return_loan(data_seq, info_seq));
+
+    ASSERT_EQ(subscriber->delete_datareader(data_reader), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(publisher->delete_datawriter(data_writer), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
 
 void set_listener_test (
         DataReader* reader,
@@ -25,6 +25,7 @@
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/DynamicDataPtr.h>
+#include <fastrtps/types/FlatDynamicData.h>
 #include <fastrtps/types/TypeObjectFactory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
@@ -5071,6 +5072,118 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST_F(DynamicTypesTests, DynamicType_compiled_layout_unit_tests)
+{
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+        DynamicTypeBuilder_ptr child_builder = factory->create_struct_builder();
+        ASSERT_TRUE(child_builder->add_member(0, "int32", factory->create_int32_type()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(child_builder->add_member(1, "int64", factory->create_int64_type()) == ReturnCode_t::RETCODE_OK);
+        DynamicType_ptr child_type = child_builder->build();
+
+        DynamicTypeBuilder_ptr seq_builder = factory->create_sequence_builder(factory->create_uint16_type(), 4);
+        DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(factory->create_float64_type(), { 3 });
+
+        DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+        ASSERT_TRUE(struct_builder->add_member(0, "child", child_type) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(1, "name", factory->create_string_type()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(2, "seq", seq_builder.get()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(3, "array", array_builder.get()) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(struct_builder->add_member(4, "flag", factory->create_bool_type()) == ReturnCode_t::RETCODE_OK);
+        DynamicType_ptr struct_type = struct_builder->build();
+        ASSERT_TRUE(struct_type != nullptr);
+
+        // Fill a sample through DynamicData
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(struct_type);
+        DynamicData* child_data = data->loan_value(0);
+        ASSERT_TRUE(child_data->set_int32_value(-7, 0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(child_data->set_int64_value(1234567890123, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->return_loaned_value(child_data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->set_string_value("compiled", 1) == ReturnCode_t::RETCODE_OK);
+        DynamicData* seq_data = data->loan_value(2);
+        for (uint16_t i = 0; i < 3; ++i)
+        {
+            MemberId id;
+            ASSERT_TRUE(seq_data->insert_sequence_data(id) == ReturnCode_t::RETCODE_OK);
+            ASSERT_TRUE(seq_data->set_uint16_value(static_cast<uint16_t>(100 + i), id) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(seq_data) == ReturnCode_t::RETCODE_OK);
+        DynamicData* array_data = data->loan_value(3);
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(array_data->set_float64_value(0.5 * i, i) == ReturnCode_t::RETCODE_OK);
+        }
+        ASSERT_TRUE(data->return_loaned_value(array_data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(data->set_bool_value(true, 4) == ReturnCode_t::RETCODE_OK);
+
+        DynamicPubSubType pubsubType(struct_type);
+        uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(data)());
+        SerializedPayload_t payload(payloadSize);
+        ASSERT_TRUE(pubsubType.serialize(data, &payload));
+
+        DynamicPubSubType compiledType(struct_type);
+        ASSERT_TRUE(compiledType.EnableCompiledLayout());
+        ASSERT_TRUE(compiledType.GetCompiledLayout() != nullptr);
+
+        // Read the sample with the compiled layout
+        FlatDynamicData* flat = static_cast<FlatDynamicData*>(compiledType.createData());
+        ASSERT_TRUE(compiledType.deserialize(&payload, flat));
+
+        FlatDynamicDataView child_view = flat->get_nested(0);
+        ASSERT_TRUE(child_view.is_valid());
+        int32_t int32_value = 0;
+        ASSERT_TRUE(child_view.get_value(int32_value, 0) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(int32_value, -7);
+        int64_t int64_value = 0;
+        ASSERT_TRUE(child_view.get_value(int64_value, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(int64_value, 1234567890123);
+        ASSERT_FALSE(child_view.get_value(int32_value, 1) == ReturnCode_t::RETCODE_OK);
+        std::string string_value;
+        ASSERT_TRUE(flat->get_string_value(string_value, 1) == ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(string_value, "compiled");
+        uint32_t count = 0;
+        const uint16_t* seq_values = flat->get_elements<uint16_t>(2, count);
+        ASSERT_TRUE(seq_values != nullptr);
+        ASSERT_EQ(count, 3u);
+        ASSERT_EQ(seq_values[2], 102);
+        const double* array_values = flat->get_elements<double>(3, count);
+        ASSERT_TRUE(array_values != nullptr);
+        ASSERT_EQ(count, 3u);
+        ASSERT_EQ(array_values[2], 1.0);
+        bool bool_value = false;
+        ASSERT_TRUE(flat->get_value(bool_value, 4) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(bool_value);
+        ASSERT_FALSE(flat->resize_sequence(2, 5) == ReturnCode_t::RETCODE_OK);
+
+        // The compiled program writes the same representation
+        uint32_t compiledSize = static_cast<uint32_t>(compiledType.getSerializedSizeProvider(flat)());
+        ASSERT_EQ(compiledSize, payloadSize);
+        SerializedPayload_t compiled_payload(compiledSize);
+        ASSERT_TRUE(compiledType.serialize(flat, &compiled_payload));
+        ASSERT_EQ(compiled_payload.length, payload.length);
+        ASSERT_EQ(memcmp(compiled_payload.data, payload.data, payload.length), 0);
+
+        DynamicData* data2 = DynamicDataFactory::get_instance()->create_data(struct_type);
+        ASSERT_TRUE(pubsubType.deserialize(&compiled_payload, data2));
+        ASSERT_TRUE(data2->equals(data));
+
+        compiledType.deleteData(flat);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(data) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(DynamicDataFactory::get_instance()->delete_data(data2) == ReturnCode_t::RETCODE_OK);
+
+        // Unsupported members leave the type with DynamicData samples
+        DynamicTypeBuilder_ptr wstring_builder = factory->create_struct_builder();
+        ASSERT_TRUE(wstring_builder->add_member(0, "wstring", factory->create_wstring_type()) ==
+                ReturnCode_t::RETCODE_OK);
+        DynamicPubSubType unsupportedType(wstring_builder->build());
+        ASSERT_FALSE(unsupportedType.EnableCompiledLayout());
+        ASSERT_TRUE(unsupportedType.GetCompiledLayout() == nullptr);
+    }
+    ASSERT_TRUE(DynamicTypeBuilderFactory::get_instance()->is_empty());
+    ASSERT_TRUE(DynamicDataFactory::get_instance()->is_empty());
+}
+
 int main(
         int argc,
         char** argv)
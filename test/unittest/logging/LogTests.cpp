@@ -22,6 +22,8 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 
 using namespace eprosima::fastdds::dds;
@@ -157,6 +159,130 @@ TEST_F(LogTests, multiple_verbosity_levels)
     ASSERT_EQ(3u, consumedEntries.size());
 }
 
+/*
+    'category_rate_limit' tests that entries over the rate limit of their category are discarded,
+    counted and reported, while other categories keep being logged.
+ */
+TEST_F(LogTests, category_rate_limit)
+{
+    constexpr uint32_t limit = 10;
+    constexpr uint32_t num_entries = 100;
+
+    uint64_t dropped_before = Log::GetDroppedEntries();
+    Log::SetCategoryRateLimit(limit);
+
+    for (uint32_t i = 0; i < num_entries; ++i)
+    {
+        logWarning(RateLimited, "Rate limited entry " << i);
+    }
+    logWarning(NotRateLimited, "Entry on another category");
+
+    // Entries may fall on two different periods of the rate limit
+    Log::Flush();
+    size_t rate_limited = 0;
+    size_t not_rate_limited = 0;
+    for (const Log::Entry& entry : mockConsumer->ConsumedEntries())
+    {
+        std::string category(entry.context.category);
+        rate_limited += (category == "RateLimited") ? 1 : 0;
+        not_rate_limited += (category == "NotRateLimited") ? 1 : 0;
+    }
+    ASSERT_GE(rate_limited, limit);
+    ASSERT_LE(rate_limited, 2 * limit);
+    ASSERT_EQ(1u, not_rate_limited);
+    ASSERT_EQ(dropped_before + num_entries - rate_limited, Log::GetDroppedEntries());
+
+    // Discarded entries are reported without waiting for more entries
+    bool reported = false;
+    for (int i = 0; i < 30 && !reported; ++i)
+    {
+        for (const Log::Entry& entry : mockConsumer->ConsumedEntries())
+        {
+            reported |= (std::string(entry.context.category) == "LOG");
+        }
+        this_thread::sleep_for(chrono::milliseconds(100));
+    }
+    ASSERT_TRUE(reported);
+}
+
+/*
+    'full_queue_discards_entries' tests that producers don't block when the logging thread
+    cannot keep up, discarding and counting the entries that don't fit in the queue.
+ */
+TEST_F(LogTests, full_queue_discards_entries)
+{
+    constexpr uint32_t num_entries = 10000;
+
+    // Blocks the logging thread on the first entry
+    class BlockingConsumer : public LogConsumer
+    {
+    public:
+
+        void Consume(
+                const Log::Entry&) override
+        {
+            std::unique_lock<std::mutex> guard(mutex);
+            blocked = true;
+            cv.notify_all();
+            cv.wait(guard, [this]()
+                    {
+                        return released;
+                    });
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool blocked = false;
+        bool released = false;
+    };
+
+    BlockingConsumer* blocking_consumer = new BlockingConsumer();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(blocking_consumer));
+
+    logWarning(FullQueue, "First entry");
+    {
+        std::unique_lock<std::mutex> guard(blocking_consumer->mutex);
+        blocking_consumer->cv.wait(guard, [&]()
+                {
+                    return blocking_consumer->blocked;
+                });
+    }
+
+    uint64_t dropped_before = Log::GetDroppedEntries();
+    for (uint32_t i = 0; i < num_entries; ++i)
+    {
+        logWarning(FullQueue, "Entry " << i);
+    }
+    uint64_t dropped = Log::GetDroppedEntries() - dropped_before;
+    ASSERT_GT(dropped, 0u);
+
+    {
+        std::unique_lock<std::mutex> guard(blocking_consumer->mutex);
+        blocking_consumer->released = true;
+        blocking_consumer->cv.notify_all();
+    }
+    Log::Flush();
+
+    size_t consumed = 0;
+    for (const Log::Entry& entry : mockConsumer->ConsumedEntries())
+    {
+        consumed += (std::string(entry.context.category) == "FullQueue") ? 1 : 0;
+    }
+    ASSERT_EQ(num_entries + 1, consumed + dropped);
+
+    // Wait for the report of the discarded entries, so it doesn't reach other tests
+    bool reported = false;
+    for (int i = 0; i < 30 && !reported; ++i)
+    {
+        for (const Log::Entry& entry : mockConsumer->ConsumedEntries())
+        {
+            reported |= (std::string(entry.context.category) == "LOG");
+        }
+        this_thread::sleep_for(chrono::milliseconds(100));
+    }
+    ASSERT_TRUE(reported);
+}
+
 // 'logless_flush_call' tests rif the Flush() operation may deadlock with an idle log
 TEST_F(LogTests, logless_flush_call)
 {
@@ -0,0 +1,201 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/DataSharing/ReaderPool.hpp>
+#include <rtps/DataSharing/WriterPool.hpp>
+
+#include <chrono>
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+
+constexpr uint32_t pool_size = 4u;
+constexpr uint32_t payload_size = 64u;
+
+class DataSharingPoolTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        // Avoid collisions with other test processes running on the same host
+        uint64_t stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        memcpy(writer_guid.guidPrefix.value, &stamp, sizeof(stamp));
+        writer_guid.entityId = EntityId_t(0x103);
+
+        writer_pool.reset(new WriterPool(pool_size, payload_size));
+        ASSERT_TRUE(writer_pool->init_shared_memory(writer_guid));
+    }
+
+    void TearDown() override
+    {
+        for (CacheChange_t& change : changes)
+        {
+            if (change.payload_owner() != nullptr)
+            {
+                change.payload_owner()->release_payload(change);
+            }
+        }
+        writer_pool.reset();
+    }
+
+    CacheChange_t& publish(
+            uint32_t index,
+            int64_t sequence_number)
+    {
+        CacheChange_t& change = changes[index];
+        if (change.payload_owner() != nullptr)
+        {
+            change.payload_owner()->release_payload(change);
+        }
+
+        EXPECT_TRUE(writer_pool->get_payload(payload_size, change));
+        change.kind = ALIVE;
+        change.writerGUID = writer_guid;
+        change.sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(sequence_number));
+        change.serializedPayload.length = sizeof(int64_t);
+        memcpy(change.serializedPayload.data, &sequence_number, sizeof(int64_t));
+        writer_pool->add_to_shared_history(&change);
+        return change;
+    }
+
+    static int64_t value_of(
+            const CacheChange_t& change)
+    {
+        int64_t value = 0;
+        memcpy(&value, change.serializedPayload.data, sizeof(int64_t));
+        return value;
+    }
+
+    static void forget(
+            CacheChange_t& change)
+    {
+        change.serializedPayload.data = nullptr;
+        change.payload_owner(nullptr);
+    }
+
+    GUID_t writer_guid;
+    std::shared_ptr<WriterPool> writer_pool;
+    CacheChange_t changes[pool_size];
+};
+
+TEST_F(DataSharingPoolTests, writer_pool_limits)
+{
+    EXPECT_EQ(pool_size, writer_pool->payload_pool_allocated_size());
+    EXPECT_EQ(pool_size, writer_pool->payload_pool_available_size());
+
+    CacheChange_t change;
+    EXPECT_FALSE(writer_pool->get_payload(payload_size + 1u, change));
+    EXPECT_EQ(nullptr, change.payload_owner());
+
+    for (uint32_t i = 0; i < pool_size; ++i)
+    {
+        publish(i, i + 1);
+    }
+    EXPECT_EQ(0u, writer_pool->payload_pool_available_size());
+    EXPECT_FALSE(writer_pool->get_payload(payload_size, change));
+
+    writer_pool->release_payload(changes[0]);
+    EXPECT_EQ(1u, writer_pool->payload_pool_available_size());
+}
+
+TEST_F(DataSharingPoolTests, reader_reads_in_place)
+{
+    publish(0, 1);
+    publish(1, 2);
+
+    ReaderPool reader_pool(false);
+    ASSERT_TRUE(reader_pool.init_shared_memory(writer_guid));
+
+    CacheChange_t change;
+    for (int64_t expected = 1; expected <= 2; ++expected)
+    {
+        ASSERT_TRUE(reader_pool.get_next_unread_payload(change));
+        EXPECT_EQ(writer_guid, change.writerGUID);
+        EXPECT_EQ(SequenceNumber_t(0, static_cast<uint32_t>(expected)), change.sequenceNumber);
+        EXPECT_EQ(expected, value_of(change));
+        EXPECT_EQ(&reader_pool, change.payload_owner());
+        EXPECT_TRUE(reader_pool.is_sample_valid(change));
+        forget(change);
+    }
+    EXPECT_FALSE(reader_pool.get_next_unread_payload(change));
+}
+
+TEST_F(DataSharingPoolTests, volatile_reader_skips_previous)
+{
+    publish(0, 1);
+
+    ReaderPool reader_pool(true);
+    ASSERT_TRUE(reader_pool.init_shared_memory(writer_guid));
+
+    CacheChange_t change;
+    EXPECT_FALSE(reader_pool.get_next_unread_payload(change));
+
+    publish(1, 2);
+    ASSERT_TRUE(reader_pool.get_next_unread_payload(change));
+    EXPECT_EQ(2, value_of(change));
+    forget(change);
+}
+
+TEST_F(DataSharingPoolTests, released_payloads_are_invalid)
+{
+    ReaderPool reader_pool(false);
+    ASSERT_TRUE(reader_pool.init_shared_memory(writer_guid));
+
+    publish(0, 1);
+    publish(1, 2);
+
+    // The writer removes the first change before the reader gets it
+    writer_pool->release_payload(changes[0]);
+
+    CacheChange_t change;
+    ASSERT_TRUE(reader_pool.get_next_unread_payload(change));
+    EXPECT_EQ(2, value_of(change));
+
+    // The writer removes the second change while the reader is using it
+    writer_pool->release_payload(changes[1]);
+    EXPECT_FALSE(reader_pool.is_sample_valid(change));
+    forget(change);
+}
+
+TEST_F(DataSharingPoolTests, lagging_reader_loses_overwritten)
+{
+    ReaderPool reader_pool(false);
+    ASSERT_TRUE(reader_pool.init_shared_memory(writer_guid));
+
+    // Publish twice the size of the ring, reusing the payloads
+    for (uint32_t i = 0; i < 2u * pool_size; ++i)
+    {
+        publish(i % pool_size, i + 1);
+    }
+
+    CacheChange_t change;
+    for (uint32_t i = pool_size; i < 2u * pool_size; ++i)
+    {
+        ASSERT_TRUE(reader_pool.get_next_unread_payload(change));
+        EXPECT_EQ(static_cast<int64_t>(i + 1), value_of(change));
+        forget(change);
+    }
+    EXPECT_FALSE(reader_pool.get_next_unread_payload(change));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -16,10 +16,12 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <rtps/flowcontrol/ThroughputController.h>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 using namespace std;
 using namespace eprosima::fastrtps::rtps;
+using ::testing::ReturnRef;
 
 static const unsigned int testPayloadSize = 1000;
 static const unsigned int controllerSize = 5500;
@@ -141,6 +143,158 @@ TEST_F(ThroughputControllerTests, throughput_controller_resets_completely_after_
    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
 }
 
+class TestWriter : public RTPSWriter
+{
+public:
+
+    TestWriter(
+            uint8_t entity_id,
+            const char* priority,
+            const char* weight)
+    {
+        guid_.entityId.value[3] = entity_id;
+        ON_CALL(*this, getGuid()).WillByDefault(ReturnRef(guid_));
+        m_att.properties.properties().emplace_back("fastdds.async_writer_priority", priority);
+        m_att.properties.properties().emplace_back("fastdds.flow_controller_weight", weight);
+    }
+
+    bool matched_reader_add(
+            const ReaderProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_reader_remove(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    bool matched_reader_is_matched(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    GUID_t guid_;
+};
+
+class ThroughputControllerKindsTests : public ::testing::Test
+{
+public:
+
+    ThroughputControllerKindsTests()
+        : first_writer(1, "5", "2")
+        , second_writer(2, "0", "1")
+    {
+        for (unsigned int i = 0; i < numberOfTestChanges; i++)
+        {
+            first_changes.emplace_back(new CacheChange_t(testPayloadSize));
+            first_changes.back()->sequenceNumber = {0, i + 1};
+            first_changes.back()->serializedPayload.length = testPayloadSize;
+            first_changes.back()->writerGUID = first_writer.guid_;
+
+            second_changes.emplace_back(new CacheChange_t(testPayloadSize));
+            second_changes.back()->sequenceNumber = {0, i + 1};
+            second_changes.back()->serializedPayload.length = testPayloadSize;
+            second_changes.back()->writerGUID = second_writer.guid_;
+        }
+    }
+
+    static void fill(
+            RTPSWriterCollector<ReaderLocator*>& collector,
+            std::vector<std::unique_ptr<CacheChange_t>>& changes,
+            size_t number)
+    {
+        collector.clear();
+        for (size_t i = 0; i < number; ++i)
+        {
+            collector.add_change(changes[i].get(), nullptr, FragmentNumberSet_t());
+        }
+    }
+
+    ::testing::NiceMock<TestWriter> first_writer;
+    ::testing::NiceMock<TestWriter> second_writer;
+    std::vector<std::unique_ptr<CacheChange_t>> first_changes;
+    std::vector<std::unique_ptr<CacheChange_t>> second_changes;
+    RTPSWriterCollector<ReaderLocator*> first_collector;
+    RTPSWriterCollector<ReaderLocator*> second_collector;
+};
+
+TEST_F(ThroughputControllerKindsTests, token_bucket_controller_allows_bursts_and_refills_gradually)
+{
+    ThroughputControllerDescriptor descriptor(5500, periodMillisecs, TOKEN_BUCKET_THROUGHPUT_CONTROLLER, 2500);
+    ThroughputController controller(descriptor, (RTPSParticipantImpl*)nullptr);
+
+    // Only the burst is allowed at once
+    fill(first_collector, first_changes, numberOfTestChanges);
+    controller(first_collector);
+    ASSERT_EQ(2u, first_collector.size());
+
+    // The bucket is refilled during half a period, but never above the burst
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs / 2));
+    fill(first_collector, first_changes, numberOfTestChanges);
+    controller(first_collector);
+    ASSERT_EQ(2u, first_collector.size());
+}
+
+TEST_F(ThroughputControllerKindsTests, priority_controller_holds_lower_priority_writers)
+{
+    ThroughputControllerDescriptor descriptor(3000, periodMillisecs, PRIORITY_THROUGHPUT_CONTROLLER);
+    ThroughputController controller(descriptor, (RTPSParticipantImpl*)nullptr);
+    controller.register_writer(&first_writer);
+    controller.register_writer(&second_writer);
+
+    fill(first_collector, first_changes, numberOfTestChanges);
+    controller(first_collector);
+    ASSERT_EQ(3u, first_collector.size());
+
+    // Lower priority writer cannot send while the higher priority one is waiting
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+    fill(second_collector, second_changes, numberOfTestChanges);
+    controller(second_collector);
+    ASSERT_EQ(0u, second_collector.size());
+
+    // Once the higher priority writer has sent everything, the lower priority one gets the rest
+    fill(first_collector, first_changes, 1);
+    controller(first_collector);
+    ASSERT_EQ(1u, first_collector.size());
+    fill(second_collector, second_changes, numberOfTestChanges);
+    controller(second_collector);
+    ASSERT_EQ(2u, second_collector.size());
+
+    controller.unregister_writer(&first_writer);
+    controller.unregister_writer(&second_writer);
+}
+
+TEST_F(ThroughputControllerKindsTests, fair_share_controller_shares_bandwidth_by_weight)
+{
+    ThroughputControllerDescriptor descriptor(6000, periodMillisecs, FAIR_SHARE_THROUGHPUT_CONTROLLER);
+    ThroughputController controller(descriptor, (RTPSParticipantImpl*)nullptr);
+    controller.register_writer(&first_writer);
+    controller.register_writer(&second_writer);
+
+    // Alone, the first writer may use the whole bucket
+    fill(first_collector, first_changes, numberOfTestChanges);
+    controller(first_collector);
+    ASSERT_EQ(6u, first_collector.size());
+    fill(second_collector, second_changes, numberOfTestChanges);
+    controller(second_collector);
+    ASSERT_EQ(0u, second_collector.size());
+
+    // With both writers waiting, the bucket is shared proportionally to their weights
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+    fill(first_collector, first_changes, numberOfTestChanges);
+    controller(first_collector);
+    ASSERT_EQ(4u, first_collector.size());
+    fill(second_collector, second_changes, numberOfTestChanges);
+    controller(second_collector);
+    ASSERT_EQ(2u, second_collector.size());
+
+    controller.unregister_writer(&first_writer);
+    controller.unregister_writer(&second_writer);
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -406,6 +406,34 @@ TEST_P(TopicPayloadPoolTests, release_history_writer_finite_size)
     do_history_test(reserve_size, reserve_max_size, false);
 }
 
+TEST_P(TopicPayloadPoolTests, counters)
+{
+    do_reserve_history(test_input_pool_size, test_input_max_pool_size, false);
+
+    // Every request is either a hit or a miss
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(payload_size, change));
+    PoolCounters counters = pool->payload_pool_counters();
+    EXPECT_EQ(counters.hits + counters.misses, 1u);
+    ASSERT_TRUE(pool->release_payload(change));
+
+    // Released payloads are reused, except on DYNAMIC_RESERVE_MEMORY_MODE
+    ASSERT_TRUE(pool->get_payload(payload_size, change));
+    PoolCounters new_counters = pool->payload_pool_counters();
+    EXPECT_EQ(new_counters.hits + new_counters.misses, 2u);
+    if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)
+    {
+        EXPECT_EQ(new_counters.misses, counters.misses + 1u);
+    }
+    else
+    {
+        EXPECT_EQ(new_counters.hits, counters.hits + 1u);
+    }
+    ASSERT_TRUE(pool->release_payload(change));
+
+    do_release_history(test_input_pool_size, test_input_max_pool_size, false);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -0,0 +1,113 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/messages/MatchedReadersIndex.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+class MatchedReadersIndexTests : public ::testing::Test
+{
+protected:
+
+    std::vector<EntityId_t> readers_for(
+            const GUID_t& writer_guid) const
+    {
+        std::vector<EntityId_t> readers;
+        uut_.for_each_reader(writer_guid, [&readers](const EntityId_t& reader_id)
+                {
+                    readers.push_back(reader_id);
+                });
+        return readers;
+    }
+
+    MatchedReadersIndex uut_;
+
+    GUID_t writer_{GuidPrefix_t(), EntityId_t(0x102)};
+
+    GUID_t other_writer_{GuidPrefix_t(), EntityId_t(0x202)};
+
+    EntityId_t reader_{0x107};
+
+    EntityId_t other_reader_{0x207};
+};
+
+TEST_F(MatchedReadersIndexTests, matched_readers)
+{
+    ASSERT_TRUE(readers_for(writer_).empty());
+
+    uut_.add_match(reader_, writer_);
+    uut_.add_match(reader_, writer_);
+    uut_.add_match(other_reader_, other_writer_);
+    ASSERT_EQ(readers_for(writer_), std::vector<EntityId_t>({reader_}));
+    ASSERT_EQ(readers_for(other_writer_), std::vector<EntityId_t>({other_reader_}));
+
+    uut_.remove_match(reader_, writer_);
+    ASSERT_TRUE(readers_for(writer_).empty());
+    ASSERT_EQ(readers_for(other_writer_), std::vector<EntityId_t>({other_reader_}));
+}
+
+//! Readers accepting unknown writers receive messages from writers they are not matched with
+TEST_F(MatchedReadersIndexTests, unknown_writers_reader)
+{
+    uut_.add_match(other_reader_, other_writer_);
+    uut_.set_accepts_unmatched_writers(reader_, true);
+    ASSERT_EQ(readers_for(writer_), std::vector<EntityId_t>({reader_}));
+    ASSERT_EQ(readers_for(other_writer_), std::vector<EntityId_t>({reader_, other_reader_}));
+
+    // Being matched too does not inform the reader twice
+    uut_.add_match(reader_, writer_);
+    ASSERT_EQ(readers_for(writer_), std::vector<EntityId_t>({reader_}));
+
+    // Once unknown writers are not accepted, only the matched writers remain
+    uut_.set_accepts_unmatched_writers(reader_, false);
+    ASSERT_EQ(readers_for(writer_), std::vector<EntityId_t>({reader_}));
+    ASSERT_EQ(readers_for(other_writer_), std::vector<EntityId_t>({other_reader_}));
+}
+
+//! Readers with a trusted writer receive its messages without being matched with it
+TEST_F(MatchedReadersIndexTests, trusted_writer_reader)
+{
+    uut_.set_accepts_unmatched_writers(reader_, true);
+    uut_.set_accepts_unmatched_writers(reader_, true);
+    ASSERT_EQ(readers_for(writer_), std::vector<EntityId_t>({reader_}));
+
+    // Removing the reader removes both its matches and its trusted writer
+    uut_.add_match(reader_, other_writer_);
+    uut_.remove_reader(reader_);
+    ASSERT_TRUE(readers_for(writer_).empty());
+    ASSERT_TRUE(readers_for(other_writer_).empty());
+}
+
+//! Lookups keep working on the snapshot they took, even if the index is updated meanwhile
+TEST_F(MatchedReadersIndexTests, snapshot_is_not_modified)
+{
+    uut_.add_match(reader_, writer_);
+    std::shared_ptr<const MatchedReadersIndex::Snapshot> snapshot = uut_.snapshot();
+
+    uut_.remove_reader(reader_);
+    ASSERT_EQ(snapshot->matched_readers.size(), 1u);
+    ASSERT_TRUE(uut_.snapshot()->matched_readers.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::ReturnRef;
+
+class SendBuffersManagerTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        EXPECT_CALL(participant_, getGuid()).WillRepeatedly(ReturnRef(guid_));
+    }
+
+    ::testing::NiceMock<RTPSParticipantImpl> participant_;
+
+    GUID_t guid_;
+};
+
+TEST_F(SendBuffersManagerTests, buffer_is_kept_on_thread_cache)
+{
+    SendBuffersManager uut(1, false);
+    uut.init(&participant_);
+
+    std::unique_ptr<RTPSMessageGroup_t> buffer = uut.get_buffer(&participant_);
+    RTPSMessageGroup_t* raw_buffer = buffer.get();
+    uut.return_buffer(std::move(buffer));
+
+    // The same buffer is served again from the cache of this thread
+    buffer = uut.get_buffer(&participant_);
+    ASSERT_EQ(buffer.get(), raw_buffer);
+    uut.return_buffer(std::move(buffer));
+
+    SendBuffersCounters counters = uut.get_counters();
+    EXPECT_EQ(counters.shared_pool_hits, 1u);
+    EXPECT_EQ(counters.thread_cache_hits, 1u);
+    EXPECT_EQ(counters.grown_buffers, 0u);
+    EXPECT_EQ(counters.waits, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, buffer_cached_by_other_thread_is_taken)
+{
+    SendBuffersManager uut(1, false);
+    uut.init(&participant_);
+
+    RTPSMessageGroup_t* raw_buffer = nullptr;
+    std::thread thread([&]()
+            {
+                std::unique_ptr<RTPSMessageGroup_t> buffer = uut.get_buffer(&participant_);
+                raw_buffer = buffer.get();
+                uut.return_buffer(std::move(buffer));
+            });
+    thread.join();
+
+    // The only buffer is on the cache of the finished thread, so it is taken from there without growing the pool
+    std::unique_ptr<RTPSMessageGroup_t> buffer = uut.get_buffer(&participant_);
+    ASSERT_EQ(buffer.get(), raw_buffer);
+    uut.return_buffer(std::move(buffer));
+
+    SendBuffersCounters counters = uut.get_counters();
+    EXPECT_EQ(counters.thread_cache_hits + counters.shared_pool_hits, 2u);
+    EXPECT_EQ(counters.grown_buffers, 0u);
+    EXPECT_EQ(counters.waits, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, pool_grows_when_allowed)
+{
+    SendBuffersManager uut(1, true);
+    uut.init(&participant_);
+
+    std::unique_ptr<RTPSMessageGroup_t> first = uut.get_buffer(&participant_);
+    std::unique_ptr<RTPSMessageGroup_t> second = uut.get_buffer(&participant_);
+    ASSERT_NE(first.get(), second.get());
+    uut.return_buffer(std::move(first));
+    uut.return_buffer(std::move(second));
+
+    SendBuffersCounters counters = uut.get_counters();
+    EXPECT_EQ(counters.grown_buffers, 1u);
+    EXPECT_EQ(counters.waits, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, waiting_thread_gets_returned_buffer)
+{
+    SendBuffersManager uut(1, false);
+    uut.init(&participant_);
+
+    std::unique_ptr<RTPSMessageGroup_t> buffer = uut.get_buffer(&participant_);
+    RTPSMessageGroup_t* raw_buffer = buffer.get();
+
+    RTPSMessageGroup_t* received_buffer = nullptr;
+    std::thread thread([&]()
+            {
+                std::unique_ptr<RTPSMessageGroup_t> other_buffer = uut.get_buffer(&participant_);
+                received_buffer = other_buffer.get();
+                uut.return_buffer(std::move(other_buffer));
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    uut.return_buffer(std::move(buffer));
+    thread.join();
+
+    ASSERT_EQ(received_buffer, raw_buffer);
+    SendBuffersCounters counters = uut.get_counters();
+    EXPECT_LE(counters.waits, 1u);
+    EXPECT_EQ(counters.grown_buffers, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, concurrent_get_return)
+{
+    constexpr size_t num_threads = 8;
+    constexpr size_t num_iterations = 10000;
+
+    SendBuffersManager uut(2, false);
+    uut.init(&participant_);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (size_t i = 0; i < num_iterations; ++i)
+                    {
+                        std::unique_ptr<RTPSMessageGroup_t> buffer = uut.get_buffer(&participant_);
+                        EXPECT_NE(buffer.get(), nullptr);
+                        uut.return_buffer(std::move(buffer));
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every request was served without creating more buffers
+    SendBuffersCounters counters = uut.get_counters();
+    EXPECT_EQ(counters.thread_cache_hits + counters.shared_pool_hits, num_threads * num_iterations);
+    EXPECT_EQ(counters.grown_buffers, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -661,6 +661,32 @@ TEST_F(NetworkTests, LocatorShrink)
     }
 }
 
+TEST_F(NetworkTests, max_message_size_depends_on_the_transport_of_the_locator)
+{
+    NetworkFactory f;
+    UDPv4TransportDescriptor udpv4;
+    udpv4.maxMessageSize = 1024;
+    UDPv6TransportDescriptor udpv6;
+    ASSERT_TRUE(f.RegisterTransport(&udpv4));
+    ASSERT_TRUE(f.RegisterTransport(&udpv6));
+
+    Locator_t v4_locator;
+    IPLocator::setIPv4(v4_locator, 127, 0, 0, 1);
+    v4_locator.port = 7400;
+    Locator_t v6_locator;
+    v6_locator.kind = LOCATOR_KIND_UDPv6;
+    IPLocator::setIPv6(v6_locator, "::1");
+    v6_locator.port = 7400;
+    Locator_t unsupported_locator;
+    unsupported_locator.kind = LOCATOR_KIND_TCPv4;
+
+    ASSERT_EQ(f.get_max_message_size(v4_locator), 1024u);
+    ASSERT_EQ(f.get_max_message_size(v6_locator), udpv6.max_message_size());
+    // Locators of transports which are not registered get the minimum between all transports
+    ASSERT_EQ(f.get_max_message_size(unsupported_locator), f.get_max_message_size_between_transports());
+    ASSERT_EQ(f.get_max_message_size_between_transports(), 1024u);
+}
+
 int main(
         int argc,
         char** argv)
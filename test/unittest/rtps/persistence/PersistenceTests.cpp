@@ -19,9 +19,17 @@
 #include <rtps/persistence/sqlite3.h>
 #include <rtps/persistence/SQLite3PersistenceServiceStatements.h>
 
+#include <algorithm>
 #include <climits>
+#include <cstring>
 #include <gtest/gtest.h>
 
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // ifndef _WIN32
+
 using namespace eprosima::fastrtps::rtps;
 
 class NoOpPayloadPool : public IPayloadPool
@@ -388,6 +396,482 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, WriterGroupCommit)
+ * @brief This test checks the writer persistence interface when operations are committed in batches.
+ */
+TEST_F(PersistenceTest, WriterGroupCommit)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit", "true");
+    policy.properties().emplace_back("dds.persistence.sqlite3.flush_period_ms", "1000");
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_queued_operations", "4");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 20, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Add more changes than the queue can hold, so callers have to wait for the commit thread
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+
+    // Remove the first five changes
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+
+    // Loading should wait for the queued operations and return seqs 6 to 10
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 5u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 10u));
+    uint32_t i = 5;
+    for (auto it : changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+        pool->release_cache(it);
+    }
+
+    // Pending operations should be committed when the service is destroyed
+    change.sequenceNumber.low = 11;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    delete service;
+
+    policy.properties().pop_back();
+    policy.properties().pop_back();
+    policy.properties().pop_back();
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 6u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 11u));
+    ASSERT_EQ(changes.back()->sequenceNumber, SequenceNumber_t(0, 11u));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, ReaderGroupCommit)
+ * @brief This test checks that reader updates are coalesced when operations are committed in batches.
+ */
+TEST_F(PersistenceTest, ReaderGroupCommit)
+{
+    const std::string persist_guid("TEST_READER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.group_commit", "true");
+    policy.properties().emplace_back("dds.persistence.sqlite3.flush_period_ms", "1000");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Only the last sequence number of each writer should be stored
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, 2 * i)));
+    }
+    seq_map[guid_1] = SequenceNumber_t(0, 100);
+    seq_map[guid_2] = SequenceNumber_t(0, 200);
+
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
+#ifndef _WIN32
+
+class MappedLogPersistenceTest : public PersistenceTest
+{
+protected:
+
+    virtual void SetUp() override
+    {
+        remove_segments();
+        mkdir(directory, 0755);
+    }
+
+    virtual void TearDown() override
+    {
+        if (service != nullptr)
+        {
+            delete service;
+        }
+
+        remove_segments();
+        rmdir(directory);
+    }
+
+    PropertyPolicy policy(
+            const char* segment_size)
+    {
+        PropertyPolicy ret;
+        ret.properties().emplace_back("dds.persistence.plugin", "builtin.MAPPED_LOG");
+        ret.properties().emplace_back("dds.persistence.mapped_log.directory", directory);
+        ret.properties().emplace_back("dds.persistence.mapped_log.segment_size", segment_size);
+        return ret;
+    }
+
+    std::vector<std::string> segments()
+    {
+        std::vector<std::string> ret;
+        DIR* dir = opendir(directory);
+        if (dir != nullptr)
+        {
+            while (struct dirent* entry = readdir(dir))
+            {
+                std::string name(entry->d_name);
+                if (name != "." && name != "..")
+                {
+                    ret.push_back(std::string(directory) + "/" + name);
+                }
+            }
+            closedir(dir);
+        }
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+    void remove_segments()
+    {
+        for (const std::string& segment : segments())
+        {
+            std::remove(segment.c_str());
+        }
+    }
+
+    void add_change(
+            const std::string& persist_guid,
+            uint32_t sequence)
+    {
+        octet data[100];
+        memset(data, static_cast<octet>(sequence), sizeof(data));
+        CacheChange_t change;
+        change.kind = ALIVE;
+        change.sequenceNumber.low = sequence;
+        change.instanceHandle.value[0] = static_cast<octet>(sequence);
+        change.serializedPayload.data = data;
+        change.serializedPayload.length = sizeof(data);
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+        change.serializedPayload.data = nullptr;
+    }
+
+    void remove_change(
+            const std::string& persist_guid,
+            uint32_t sequence)
+    {
+        CacheChange_t change;
+        change.sequenceNumber.low = sequence;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+
+    void check_change(
+            const CacheChange_t* change,
+            uint32_t sequence)
+    {
+        ASSERT_EQ(change->sequenceNumber, SequenceNumber_t(0, sequence));
+        ASSERT_EQ(change->instanceHandle.value[0], static_cast<octet>(sequence));
+        ASSERT_EQ(change->serializedPayload.length, 100u);
+        for (uint32_t i = 0; i < change->serializedPayload.length; ++i)
+        {
+            ASSERT_EQ(change->serializedPayload.data[i], static_cast<octet>(sequence));
+        }
+    }
+
+    const char* directory = "mapped_log_test";
+};
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, Writer)
+ * @brief This test checks the writer persistence interface of the mapped log persistence service.
+ */
+TEST_F(MappedLogPersistenceTest, Writer)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+
+    // Initial load should return empty vector
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 0u);
+
+    // Add two changes, that cannot be added again
+    add_change(persist_guid, 1);
+    add_change(persist_guid, 2);
+    change.sequenceNumber.low = 1;
+    ASSERT_FALSE(service->add_writer_change_to_storage(persist_guid, change));
+
+    // Remove seq = 1, and test it can be safely removed twice
+    remove_change(persist_guid, 1);
+    remove_change(persist_guid, 1);
+
+    // Loading after a restart should return seq = 2, copied on the preallocated payload
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 1u);
+    check_change(changes[0], 2);
+    ASSERT_EQ(changes[0]->writerGUID, guid);
+    ASSERT_EQ(changes[0]->payload_owner(), nullptr);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+    pool->release_cache(changes[0]);
+
+    // The last sequence number should be kept when all the changes are removed
+    remove_change(persist_guid, 2);
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 0u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, WriterMappedPayloads)
+ * @brief This test checks that loaded payloads point to the log files, and outlive the service.
+ */
+TEST_F(MappedLogPersistenceTest, WriterMappedPayloads)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        add_change(persist_guid, i);
+    }
+    delete service;
+
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg);
+    SequenceNumber_t max_seq;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 5u);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 5u));
+
+    // Removing the changes from storage and destroying the service keeps the payloads valid
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        remove_change(persist_guid, i);
+    }
+    delete service;
+    service = nullptr;
+
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        CacheChange_t* change = changes[i];
+        check_change(change, i + 1);
+        ASSERT_NE(change->payload_owner(), nullptr);
+        ASSERT_TRUE(change->payload_owner()->release_payload(*change));
+        ASSERT_EQ(change->serializedPayload.data, nullptr);
+        pool->release_cache(change);
+    }
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, WriterCompaction)
+ * @brief This test checks that segments are removed or compacted when their changes are removed.
+ */
+TEST_F(MappedLogPersistenceTest, WriterCompaction)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    service = PersistenceFactory::create_persistence_service(policy("4096"));
+    ASSERT_NE(service, nullptr);
+
+    // Keep the last 10 changes, as a history with KEEP_LAST 10 would
+    for (uint32_t i = 1; i <= 500; ++i)
+    {
+        add_change(persist_guid, i);
+        if (i > 10)
+        {
+            remove_change(persist_guid, i - 10);
+        }
+    }
+    ASSERT_LE(segments().size(), 3u);
+
+    // Keep one change of every 50, which should be moved by compaction
+    for (uint32_t i = 501; i <= 1000; ++i)
+    {
+        add_change(persist_guid, i);
+        if ((i - 10) % 50 != 0)
+        {
+            remove_change(persist_guid, i - 10);
+        }
+    }
+    ASSERT_LE(segments().size(), 4u);
+    delete service;
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 50, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+
+    service = PersistenceFactory::create_persistence_service(policy("4096"));
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 1000u));
+    ASSERT_EQ(changes.size(), 20u);
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        check_change(changes[i], 500 + 50 * i);
+    }
+    for (uint32_t i = 10; i < 20; ++i)
+    {
+        check_change(changes[i], 991 + (i - 10));
+    }
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, WriterTornRecord)
+ * @brief This test checks that a record partially written is discarded when the log is loaded.
+ */
+TEST_F(MappedLogPersistenceTest, WriterTornRecord)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        add_change(persist_guid, i);
+    }
+    delete service;
+
+    // Corrupt the payload of the last change
+    std::vector<std::string> files = segments();
+    ASSERT_EQ(files.size(), 1u);
+    FILE* file = fopen(files[0].c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    const long record_size = 40 + 104;
+    fseek(file, 16 + 2 * record_size + 40 + 50, SEEK_SET);
+    fputc(0xFF, file);
+    fclose(file);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 10, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 2u);
+    check_change(changes[0], 1);
+    check_change(changes[1], 2);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
+
+    // The discarded record is overwritten by the next one
+    add_change(persist_guid, 3);
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy("65536"));
+    changes.clear();
+    pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, pool, payload_pool_, max_seq));
+    ASSERT_EQ(changes.size(), 3u);
+    check_change(changes[2], 3);
+}
+
+/*!
+ * @fn TEST_F(MappedLogPersistenceTest, Reader)
+ * @brief This test checks the reader persistence interface of the mapped log persistence service.
+ */
+TEST_F(MappedLogPersistenceTest, Reader)
+{
+    const std::string persist_guid("TEST_READER");
+
+    service = PersistenceFactory::create_persistence_service(policy("4096"));
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Initial load should return empty map
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 0u);
+
+    // Enough updates to use several segments
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, 2 * i)));
+    }
+    seq_map[guid_1] = SequenceNumber_t(0, 1000);
+    seq_map[guid_2] = SequenceNumber_t(0, 2000);
+    ASSERT_EQ(segments().size(), 1u);
+
+    // Loading after a restart should return the last values
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy("4096"));
+    ASSERT_NE(service, nullptr);
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
+#endif // ifndef _WIN32
+
 int main(
         int argc,
         char** argv)
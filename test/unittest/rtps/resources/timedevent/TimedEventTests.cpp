@@ -164,6 +164,35 @@ TEST(TimedEvent, Event_QuickRestartEvents)
     ASSERT_EQ(successed, 1);
 }
 
+/*!
+ * @fn TEST(TimedEvent, Event_NeverTriggeredEarly)
+ * @brief This test checks events with different intervals are not triggered before their expiration time.
+ * This test launches events spread on several levels of the timer wheel, and checks the elapsed time when
+ * each one is triggered.
+ */
+TEST(TimedEvent, Event_NeverTriggeredEarly)
+{
+    MockEvent event_short(*env->service_, 5, false);
+    MockEvent event_medium(*env->service_, 40, false);
+    MockEvent event_long(*env->service_, 300, false);
+
+    auto start = std::chrono::steady_clock::now();
+    event_long.event().restart_timer();
+    event_medium.event().restart_timer();
+    event_short.event().restart_timer();
+
+    event_short.wait();
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5));
+    event_medium.wait();
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(40));
+    event_long.wait();
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(300));
+
+    EXPECT_EQ(event_short.successed_.load(std::memory_order_relaxed), 1);
+    EXPECT_EQ(event_medium.successed_.load(std::memory_order_relaxed), 1);
+    EXPECT_EQ(event_long.successed_.load(std::memory_order_relaxed), 1);
+}
+
 /*!
  * @fn TEST(TimedEvent, Event_AutoRestart)
  * @brief This test checks an event is able to restart itself.
@@ -99,6 +99,7 @@ class LivelinessManagerTests : public ::testing::Test
 namespace  eprosima {
 namespace fastrtps {
 
+using eprosima::fastrtps::rtps::LivelinessAssertion;
 using eprosima::fastrtps::rtps::LivelinessData;
 using eprosima::fastrtps::rtps::LivelinessManager;
 using eprosima::fastrtps::rtps::GuidPrefix_t;
@@ -478,6 +479,58 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that assertions done with a cached assertion keep a writer alive, and that they recover it once it
+//! has lost liveliness
+TEST_F(LivelinessManagerTests, AssertLivelinessWithCachedAssertion)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+
+    std::shared_ptr<LivelinessAssertion> assertion;
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1), assertion));
+    ASSERT_NE(assertion, nullptr);
+    wait_liveliness_recovered(1u);
+
+    // Assert during several lease durations, the writer should not lose liveliness
+    for (int i = 0; i < 30; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                    GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1), assertion));
+    }
+    EXPECT_EQ(num_writers_lost, 0u);
+    EXPECT_EQ(num_writers_recovered, 1u);
+
+    // Stop asserting, so that it loses liveliness
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 1));
+
+    // The cached assertion recovers it
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1), assertion));
+    wait_liveliness_recovered(2u);
+    EXPECT_EQ(liveliness_manager.get_liveliness_data()[0].status, LivelinessData::WriterStatus::ALIVE);
+
+    // Once removed, the cached assertion cannot be used
+    EXPECT_TRUE(liveliness_manager.remove_writer(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1)));
+    EXPECT_FALSE(liveliness_manager.assert_liveliness(
+                GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1), assertion));
+}
+
 }
 }
 
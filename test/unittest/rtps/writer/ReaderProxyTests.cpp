@@ -133,6 +133,58 @@ TEST(ReaderProxyTests, are_there_gaps)
     ASSERT_FALSE(rproxy.are_there_gaps());
 }
 
+TEST(ReaderProxyTests, replay_history)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    // Changes 1 to 4 are replayed, while change 5 is added as a live change
+    rproxy.start_replay(SequenceNumber_t(0, 1), SequenceNumber_t(0, 5));
+    rproxy.add_change(ChangeForReader_t(SequenceNumber_t(0, 5)), false);
+    ASSERT_TRUE(rproxy.replay_pending());
+    ASSERT_TRUE(rproxy.has_changes());
+    ASSERT_FALSE(rproxy.are_there_gaps());
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 1)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
+
+    // Changes pending to be replayed are not informed as holes
+    std::vector<SequenceNumber_t> informed;
+    rproxy.for_each_unsent_change(SequenceNumber_t(0, 6),
+            [&informed](const SequenceNumber_t& seq_num, const ChangeForReader_t*)
+            {
+                informed.push_back(seq_num);
+            });
+    ASSERT_EQ(informed, std::vector<SequenceNumber_t>({SequenceNumber_t(0, 5)}));
+
+    // Replayed changes are kept before the live ones. Change 3 is a hole on the history.
+    rproxy.add_replayed_change(ChangeForReader_t(SequenceNumber_t(0, 1)));
+    rproxy.add_replayed_change(ChangeForReader_t(SequenceNumber_t(0, 2)));
+    ASSERT_EQ(rproxy.replay_next(), SequenceNumber_t(0, 3));
+    ASSERT_EQ(rproxy.first_relevant_sequence_number(), SequenceNumber_t(0, 1));
+    rproxy.add_replayed_change(ChangeForReader_t(SequenceNumber_t(0, 4)));
+    rproxy.replayed_up_to(SequenceNumber_t(0, 5));
+    ASSERT_FALSE(rproxy.replay_pending());
+    ASSERT_TRUE(rproxy.are_there_gaps());
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 3)));
+
+    informed.clear();
+    rproxy.for_each_unsent_change(SequenceNumber_t(0, 6),
+            [&informed](const SequenceNumber_t& seq_num, const ChangeForReader_t*)
+            {
+                informed.push_back(seq_num);
+            });
+    ASSERT_EQ(informed, std::vector<SequenceNumber_t>({SequenceNumber_t(0, 1), SequenceNumber_t(0, 2),
+                SequenceNumber_t(0, 3), SequenceNumber_t(0, 4), SequenceNumber_t(0, 5)}));
+
+    // An acknowledgement beyond the replayed changes finishes the replay
+    rproxy.start_replay(SequenceNumber_t(0, 6), SequenceNumber_t(0, 10));
+    rproxy.acked_changes_set(SequenceNumber_t(0, 10));
+    ASSERT_FALSE(rproxy.replay_pending());
+    ASSERT_FALSE(rproxy.has_changes());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -22,8 +22,10 @@
 
 #include <gtest/gtest.h>
 #include <openssl/rand.h>
+#include <array>
 #include <cstdlib>
 #include <cstring>
+#include <set>
 
 class CryptographyPluginTest : public ::testing::Test
 {
@@ -1831,4 +1833,305 @@ TEST_F(CryptographyPluginTest, transform_preprocess_secure_submessage)
     delete i_handle;
 }
 
+// The key exchange writer and reader of both participants share the same session key, so the initialization vectors
+// of their messages should never repeat
+TEST_F(CryptographyPluginTest, transform_kx_initialization_vectors_are_unique)
+{
+    eprosima::fastrtps::rtps::security::PKIIdentityHandle* i_handle =
+            new eprosima::fastrtps::rtps::security::PKIIdentityHandle();
+    eprosima::fastrtps::rtps::security::AccessPermissionsHandle* perm_handle =
+            new eprosima::fastrtps::rtps::security::AccessPermissionsHandle();
+    eprosima::fastrtps::rtps::PropertySeq prop_handle;
+    eprosima::fastrtps::rtps::security::ParticipantSecurityAttributes part_sec_attr;
+    eprosima::fastrtps::rtps::security::EndpointSecurityAttributes sec_attrs;
+    eprosima::fastrtps::rtps::security::SharedSecretHandle* shared_secret =
+            new eprosima::fastrtps::rtps::security::SharedSecretHandle();
+
+    eprosima::fastrtps::rtps::security::SecurityException exception;
+
+    sec_attrs.is_submessage_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED;
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* participant_A =
+            CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr,
+                    exception);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* participant_B =
+            CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr,
+                    exception);
+
+    //Fill shared secret with dummy values
+    std::vector<uint8_t> dummy_data, challenge_1, challenge_2;
+    eprosima::fastrtps::rtps::security::SharedSecret::BinaryData binary_data;
+    challenge_1.resize(32);
+    challenge_2.resize(32);
+
+    RAND_bytes(challenge_1.data(), 32);
+    binary_data.name("Challenge1");
+    binary_data.value(challenge_1);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    RAND_bytes(challenge_2.data(), 32);
+    binary_data.name("Challenge2");
+    binary_data.value(challenge_2);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    dummy_data.resize(32);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    //Register a remote for both Participants, which creates their key exchange endpoints
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* ParticipantA_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_A, *i_handle, *perm_handle,
+                    *shared_secret, exception);
+    ASSERT_TRUE(ParticipantA_remote != nullptr);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* ParticipantB_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_B, *i_handle, *perm_handle,
+                    *shared_secret, exception);
+    ASSERT_TRUE(ParticipantB_remote != nullptr);
+
+    //Retrieve the key exchange endpoints the same way the SecurityManager does
+    eprosima::fastrtps::rtps::PropertySeq kx_writer_prop;
+    kx_writer_prop.emplace_back("dds.sec.builtin_endpoint_name", "BuiltinParticipantVolatileMessageSecureWriter");
+    eprosima::fastrtps::rtps::PropertySeq kx_reader_prop;
+    kx_reader_prop.emplace_back("dds.sec.builtin_endpoint_name", "BuiltinParticipantVolatileMessageSecureReader");
+
+    std::vector<eprosima::fastrtps::rtps::security::DatawriterCryptoHandle*> kx_writers;
+    kx_writers.push_back(CryptoPlugin->keyfactory()->register_local_datawriter(*ParticipantA_remote, kx_writer_prop,
+            sec_attrs, exception));
+    kx_writers.push_back(CryptoPlugin->keyfactory()->register_local_datawriter(*ParticipantB_remote, kx_writer_prop,
+            sec_attrs, exception));
+    std::vector<eprosima::fastrtps::rtps::security::DatareaderCryptoHandle*> kx_readers;
+    kx_readers.push_back(CryptoPlugin->keyfactory()->register_local_datareader(*ParticipantA_remote, kx_reader_prop,
+            sec_attrs, exception));
+    kx_readers.push_back(CryptoPlugin->keyfactory()->register_local_datareader(*ParticipantB_remote, kx_reader_prop,
+            sec_attrs, exception));
+
+    eprosima::fastrtps::rtps::CDRMessage_t plain_payload(RTPSMESSAGE_DEFAULT_SIZE);
+    char message[] = "My goose is cooked"; //Length 18
+    memcpy(plain_payload.buffer, message, 18);
+    plain_payload.length = 18;
+
+    //The initialization vector follows the submessage header, the transformation kind and the key id
+    const uint32_t initialization_vector_position = 12;
+    std::set<std::array<uint8_t, 12>> initialization_vectors;
+    std::vector<eprosima::fastrtps::rtps::security::DatareaderCryptoHandle*> receivers;
+    const size_t messages_per_endpoint = 10;
+
+    for (size_t i = 0; i < messages_per_endpoint; ++i)
+    {
+        for (eprosima::fastrtps::rtps::security::DatawriterCryptoHandle* kx_writer : kx_writers)
+        {
+            ASSERT_TRUE(kx_writer != nullptr);
+            eprosima::fastrtps::rtps::CDRMessage_t encoded_payload(RTPSMESSAGE_DEFAULT_SIZE);
+            plain_payload.pos = 0;
+            ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_datawriter_submessage(encoded_payload, plain_payload,
+                    *kx_writer, receivers, exception));
+
+            std::array<uint8_t, 12> initialization_vector;
+            memcpy(initialization_vector.data(), encoded_payload.buffer + initialization_vector_position, 12);
+            initialization_vectors.insert(initialization_vector);
+        }
+
+        for (eprosima::fastrtps::rtps::security::DatareaderCryptoHandle* kx_reader : kx_readers)
+        {
+            ASSERT_TRUE(kx_reader != nullptr);
+            eprosima::fastrtps::rtps::CDRMessage_t encoded_payload(RTPSMESSAGE_DEFAULT_SIZE);
+            plain_payload.pos = 0;
+            ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_datareader_submessage(encoded_payload, plain_payload,
+                    *kx_reader, receivers, exception));
+
+            std::array<uint8_t, 12> initialization_vector;
+            memcpy(initialization_vector.data(), encoded_payload.buffer + initialization_vector_position, 12);
+            initialization_vectors.insert(initialization_vector);
+        }
+    }
+
+    ASSERT_EQ(initialization_vectors.size(), messages_per_endpoint * (kx_writers.size() + kx_readers.size()));
+
+    //The key exchange endpoints are released along with their remote participant
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(participant_A, exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(ParticipantA_remote, exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(participant_B, exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(ParticipantB_remote, exception));
+
+    delete shared_secret;
+    delete perm_handle;
+    delete i_handle;
+}
+
+//Computes a receiver specific MAC keying a new cipher context, instead of the one cached on the session
+static std::array<uint8_t, 16> fresh_receiver_specific_mac(
+        eprosima::fastrtps::rtps::security::AESGCMGMAC_Transform& transform,
+        const eprosima::fastrtps::rtps::security::KeyMaterial_AES_GCM_GMAC& key_material,
+        bool use_256_bits,
+        uint32_t session_id,
+        const std::array<uint8_t, 12>& initialization_vector,
+        const std::array<uint8_t, 16>& common_mac)
+{
+    std::array<uint8_t, 32> session_key;
+    transform.compute_sessionkey(session_key, true, key_material.master_receiver_specific_key,
+            key_material.master_salt, session_id, use_256_bits ? 32 : 16);
+
+    std::array<uint8_t, 16> receiver_mac;
+    receiver_mac.fill(0);
+    int actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
+    EXPECT_TRUE(EVP_EncryptInit(e_ctx, use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(),
+            session_key.data(), initialization_vector.data()));
+    EXPECT_TRUE(EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, common_mac.data(), 16));
+    EXPECT_TRUE(EVP_EncryptFinal(e_ctx, nullptr, &final_size));
+    EXPECT_TRUE(EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, 16, receiver_mac.data()));
+    EVP_CIPHER_CTX_free(e_ctx);
+    return receiver_mac;
+}
+
+// The receiver specific MACs computed with the cipher contexts cached on each receiver should be the same as the ones
+// computed with a freshly keyed context, also after the session key has been changed
+TEST_F(CryptographyPluginTest, transform_receiver_specific_macs)
+{
+    eprosima::fastrtps::rtps::security::PKIIdentityHandle* i_handle =
+            new eprosima::fastrtps::rtps::security::PKIIdentityHandle();
+    eprosima::fastrtps::rtps::security::AccessPermissionsHandle* perm_handle =
+            new eprosima::fastrtps::rtps::security::AccessPermissionsHandle();
+    eprosima::fastrtps::rtps::PropertySeq prop_handle;
+    eprosima::fastrtps::rtps::security::ParticipantSecurityAttributes part_sec_attr;
+    eprosima::fastrtps::rtps::security::EndpointSecurityAttributes sec_attrs;
+    eprosima::fastrtps::rtps::security::SharedSecretHandle* shared_secret =
+            new eprosima::fastrtps::rtps::security::SharedSecretHandle();
+
+    eprosima::fastrtps::rtps::security::SecurityException exception;
+
+    //Change the session key every two messages
+    const uint32_t max_blocks_per_session = 2;
+    prop_handle.emplace_back("dds.sec.crypto.maxblockspersession", std::to_string(max_blocks_per_session));
+
+    sec_attrs.is_submessage_protected = true;
+    sec_attrs.is_payload_protected = false;
+    sec_attrs.is_key_protected = false;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED;
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* participant_A =
+            CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr,
+                    exception);
+
+    eprosima::fastrtps::rtps::security::DatawriterCryptoHandle* writer =
+            CryptoPlugin->keyfactory()->register_local_datawriter(*participant_A, prop_handle, sec_attrs, exception);
+    ASSERT_TRUE(writer != nullptr);
+
+    //Fill shared secret with dummy values
+    std::vector<uint8_t> dummy_data, challenge_1, challenge_2;
+    eprosima::fastrtps::rtps::security::SharedSecret::BinaryData binary_data;
+    challenge_1.resize(32);
+    challenge_2.resize(32);
+
+    RAND_bytes(challenge_1.data(), 32);
+    binary_data.name("Challenge1");
+    binary_data.value(challenge_1);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    RAND_bytes(challenge_2.data(), 32);
+    binary_data.name("Challenge2");
+    binary_data.value(challenge_2);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    dummy_data.resize(32);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* ParticipantA_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_A, *i_handle, *perm_handle,
+                    *shared_secret, exception);
+    ASSERT_TRUE(ParticipantA_remote != nullptr);
+
+    //Register two DataReaders with the DataWriter, each one with its own receiver specific key
+    std::vector<eprosima::fastrtps::rtps::security::DatareaderCryptoHandle*> receivers;
+    receivers.push_back(CryptoPlugin->keyfactory()->register_matched_remote_datareader(*writer, *ParticipantA_remote,
+            *shared_secret, false, exception));
+    receivers.push_back(CryptoPlugin->keyfactory()->register_matched_remote_datareader(*writer, *ParticipantA_remote,
+            *shared_secret, false, exception));
+    ASSERT_TRUE(receivers[0] != nullptr);
+    ASSERT_TRUE(receivers[1] != nullptr);
+
+    eprosima::fastrtps::rtps::CDRMessage_t plain_payload(RTPSMESSAGE_DEFAULT_SIZE);
+    char message[] = "My goose is cooked"; //Length 18
+    memcpy(plain_payload.buffer, message, 18);
+    plain_payload.length = 18;
+
+    const size_t number_of_messages = 3 * max_blocks_per_session;
+    std::set<uint32_t> session_ids;
+
+    for (size_t i = 0; i < number_of_messages; ++i)
+    {
+        eprosima::fastrtps::rtps::CDRMessage_t encoded_payload(RTPSMESSAGE_DEFAULT_SIZE);
+        plain_payload.pos = 0;
+        ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_datawriter_submessage(encoded_payload, plain_payload,
+                *writer, receivers, exception));
+
+        //The header follows the submessage header: transformation kind, key id, session id and IV suffix
+        std::array<uint8_t, 4> transformation_kind;
+        memcpy(transformation_kind.data(), encoded_payload.buffer + 4, 4);
+        bool use_256_bits = transformation_kind == eprosima::fastrtps::rtps::security::c_transfrom_kind_aes256_gcm ||
+                transformation_kind == eprosima::fastrtps::rtps::security::c_transfrom_kind_aes256_gmac;
+        uint32_t session_id = 0;
+        memcpy(&session_id, encoded_payload.buffer + 12, 4);
+        session_ids.insert(session_id);
+        std::array<uint8_t, 12> initialization_vector;
+        memcpy(initialization_vector.data(), encoded_payload.buffer + 12, 12);
+
+        //The postfix ends with the common MAC and the sequence of receiver key ids and MACs
+        const uint32_t receiver_mac_length = 4 + 16;
+        uint32_t receiver_macs_position = encoded_payload.length -
+                static_cast<uint32_t>(receivers.size()) * receiver_mac_length;
+        ASSERT_EQ(encoded_payload.buffer[receiver_macs_position - 1], receivers.size());
+        std::array<uint8_t, 16> common_mac;
+        memcpy(common_mac.data(), encoded_payload.buffer + receiver_macs_position - 4 - 16, 16);
+
+        for (eprosima::fastrtps::rtps::security::DatareaderCryptoHandle* receiver : receivers)
+        {
+            const eprosima::fastrtps::rtps::security::KeyMaterial_AES_GCM_GMAC& key_material =
+                    eprosima::fastrtps::rtps::security::AESGCMGMAC_ReaderCryptoHandle::narrow(*receiver)->
+                            Remote2EntityKeyMaterial.at(0);
+            std::array<uint8_t, 16> expected_mac = fresh_receiver_specific_mac(*CryptoPlugin->cryptotransform(),
+                    key_material, use_256_bits, session_id, initialization_vector, common_mac);
+
+            bool found = false;
+            for (uint32_t pos = receiver_macs_position; pos < encoded_payload.length; pos += receiver_mac_length)
+            {
+                if (0 == memcmp(encoded_payload.buffer + pos, key_material.receiver_specific_key_id.data(), 4))
+                {
+                    found = true;
+                    ASSERT_EQ(0, memcmp(encoded_payload.buffer + pos + 4, expected_mac.data(), 16));
+                }
+            }
+            ASSERT_TRUE(found);
+        }
+    }
+
+    //The session key has been changed while sending
+    ASSERT_EQ(session_ids.size(), number_of_messages / max_blocks_per_session);
+
+    eprosima::fastrtps::rtps::security::CryptoTimingCounters timing_counters;
+    ASSERT_TRUE(CryptoPlugin->cryptotransform()->get_datawriter_timing_counters(*writer, timing_counters));
+    ASSERT_EQ(timing_counters.encoded_submessages, number_of_messages);
+    ASSERT_EQ(timing_counters.receiver_specific_macs, number_of_messages * receivers.size());
+    ASSERT_GT(timing_counters.common_protection_time.count(), 0);
+    ASSERT_GT(timing_counters.receiver_specific_macs_time.count(), 0);
+
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datawriter(writer, exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datareader(receivers[0], exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_datareader(receivers[1], exception));
+
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(participant_A, exception));
+    EXPECT_TRUE(CryptoPlugin->keyfactory()->unregister_participant(ParticipantA_remote, exception));
+
+    delete shared_secret;
+    delete perm_handle;
+    delete i_handle;
+}
+
 #endif // ifndef _UNITTEST_SECURITY_CRYPTOGRAPHY_CRYPTOGRAPHYPLUGINTESTS_HPP_
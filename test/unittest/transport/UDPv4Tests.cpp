@@ -17,6 +17,7 @@
 #include <fastrtps/rtps/network/NetworkFactory.h>
 #include <gtest/gtest.h>
 #include <thread>
+#include <atomic>
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
 //#include <fastdds/dds/log/Log.hpp>
@@ -458,6 +459,128 @@ TEST_F(UDPv4Tests, send_and_receive_between_allowed_sockets_using_localhost)
     sem.wait();
 }
 
+TEST_F(UDPv4Tests, send_and_receive_several_buffers_as_a_single_datagram)
+{
+    descriptor.maxMessageSize = 2048;
+    descriptor.sendBufferSize = 2048;
+    descriptor.receiveBufferSize = 2048;
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t unicastLocator;
+    unicastLocator.port = g_default_port;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(unicastLocator, "127.0.0.1");
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, "127.0.0.1");
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    octet header[4] = { 'R', 'T', 'P', 'S' };
+    std::vector<octet> payload(1000);
+    for (size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<octet>(i);
+    }
+    octet trailer[3] = { 'E', 'N', 'D' };
+
+    NetworkBuffers buffers;
+    buffers.emplace_back(header, static_cast<uint32_t>(sizeof(header)));
+    buffers.emplace_back(payload.data(), static_cast<uint32_t>(payload.size()));
+    buffers.emplace_back(trailer, static_cast<uint32_t>(sizeof(trailer)));
+    uint32_t total_bytes = static_cast<uint32_t>(sizeof(header) + payload.size() + sizeof(trailer));
+
+    std::vector<octet> expected(header, header + sizeof(header));
+    expected.insert(expected.end(), payload.begin(), payload.end());
+    expected.insert(expected.end(), trailer, trailer + sizeof(trailer));
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(expected.data(), msg_recv->data, total_bytes), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(buffers, total_bytes, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+    sem.wait();
+}
+
+TEST_F(UDPv4Tests, send_to_several_locators_on_a_single_call)
+{
+    // Socket buffers should be able to hold all the datagrams
+    descriptor.sendBufferSize = 65536;
+    descriptor.receiveBufferSize = 65536;
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, "127.0.0.1");
+
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    Semaphore sem;
+    std::atomic<size_t> received(0);
+
+    // More destinations than the ones sent on a single system call
+    const size_t num_destinations = 40;
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t unicastLocator;
+        unicastLocator.port = g_default_port + 1 + static_cast<uint32_t>(i);
+        unicastLocator.kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(unicastLocator, "127.0.0.1");
+        locator_list.push_back(unicastLocator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, unicastLocator));
+        ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+        MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    ++received;
+                    sem.post();
+                });
+    }
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        sem.wait();
+    }
+
+    EXPECT_EQ(received.load(), num_destinations);
+}
+
 TEST_F(UDPv4Tests, send_and_receive_between_allowed_sockets_using_unicast)
 {
     std::vector<IPFinder::info_IP> interfaces;
@@ -700,6 +823,71 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+#if defined(__linux__)
+TEST_F(UDPv4Tests, send_and_receive_with_several_listen_threads_and_batches)
+{
+    const int num_samples = 100;
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    UDPv4TransportDescriptor my_descriptor;
+    my_descriptor.listen_threads = 3;
+    my_descriptor.receive_batch_size = 16;
+
+    Locator_t sub_locator;
+    sub_locator.kind = LOCATOR_KIND_UDPv4;
+    sub_locator.port = g_default_port + 2;
+    IPLocator::setIPv4(sub_locator, 127, 0, 0, 1);
+
+    // Subscriber
+    UDPv4Transport sub_transport(my_descriptor);
+    ASSERT_TRUE(sub_transport.init());
+
+    MockReceiverResource sub_receiver(sub_transport, sub_locator);
+    MockMessageReceiver* sub_msg_recv = dynamic_cast<MockMessageReceiver*>(sub_receiver.CreateMessageReceiver());
+    ASSERT_TRUE(sub_transport.IsInputChannelOpen(sub_locator));
+
+    std::atomic<int> samples_received(0);
+    Semaphore sem;
+    std::function<void()> sub_callback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, sub_msg_recv->data, 5), 0);
+                if (samples_received.fetch_add(1) + 1 == num_samples)
+                {
+                    sem.post();
+                }
+            };
+    sub_msg_recv->setCallback(sub_callback);
+
+    // The port shared by the listening threads cannot be taken by another transport
+    UDPv4Transport other_transport(my_descriptor);
+    ASSERT_TRUE(other_transport.init());
+    MockReceiverResource other_receiver(other_transport, sub_locator);
+    EXPECT_FALSE(other_transport.IsInputChannelOpen(sub_locator));
+
+    // Publisher
+    UDPv4Transport pub_transport(my_descriptor);
+    ASSERT_TRUE(pub_transport.init());
+
+    LocatorList_t send_locators_list;
+    send_locators_list.push_back(sub_locator);
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(pub_transport.OpenOutputChannel(send_resource_list, sub_locator));
+
+    for (int i = 0; i < num_samples; i++)
+    {
+        Locators locators_begin(send_locators_list.begin());
+        Locators locators_end(send_locators_list.end());
+
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    sem.wait();
+    EXPECT_EQ(num_samples, samples_received.load());
+}
+#endif // if defined(__linux__)
+
 void UDPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.maxMessageSize = 5;
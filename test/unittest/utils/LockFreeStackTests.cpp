@@ -0,0 +1,135 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/lock_free_stack.hpp>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+TEST(LockFreeStackTests, push_pop)
+{
+    LockFreeStack<int> uut;
+
+    // Without capacity nothing can be pushed
+    ASSERT_TRUE(uut.empty());
+    ASSERT_FALSE(uut.push(1));
+
+    uut.reserve(100);
+    ASSERT_GE(uut.capacity(), 100u);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(uut.push(i));
+    }
+    ASSERT_EQ(uut.size(), 100u);
+
+    // Values are returned in reverse order
+    for (int i = 99; i >= 0; --i)
+    {
+        int value = -1;
+        ASSERT_TRUE(uut.pop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    int value = -1;
+    ASSERT_FALSE(uut.pop(value));
+    ASSERT_TRUE(uut.empty());
+}
+
+TEST(LockFreeStackTests, capacity_exhausted)
+{
+    LockFreeStack<int> uut;
+    uut.reserve(1);
+
+    size_t capacity = uut.capacity();
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        ASSERT_TRUE(uut.push(static_cast<int>(i)));
+    }
+    ASSERT_FALSE(uut.push(0));
+
+    // Growing keeps the values already pushed
+    uut.reserve(capacity + 1);
+    ASSERT_TRUE(uut.push(0));
+    ASSERT_EQ(uut.size(), capacity + 1);
+}
+
+TEST(LockFreeStackTests, concurrent_push_pop)
+{
+    constexpr size_t num_threads = 4;
+    constexpr size_t num_values = 1000;
+    constexpr size_t num_iterations = 10000;
+
+    LockFreeStack<size_t> uut;
+    uut.reserve(num_values);
+    for (size_t i = 0; i < num_values; ++i)
+    {
+        ASSERT_TRUE(uut.push(i));
+    }
+
+    // Every thread takes values and gives them back, so no value should be lost nor duplicated
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&uut]()
+                {
+                    std::vector<size_t> taken;
+                    for (size_t i = 0; i < num_iterations; ++i)
+                    {
+                        size_t value;
+                        if (uut.pop(value))
+                        {
+                            taken.push_back(value);
+                        }
+
+                        if (taken.size() > 8 || (!taken.empty() && 0 == i % 3))
+                        {
+                            EXPECT_TRUE(uut.push(taken.back()));
+                            taken.pop_back();
+                        }
+                    }
+
+                    for (size_t value : taken)
+                    {
+                        EXPECT_TRUE(uut.push(value));
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(uut.size(), num_values);
+    std::set<size_t> values;
+    size_t value;
+    while (uut.pop(value))
+    {
+        ASSERT_TRUE(values.insert(value).second);
+    }
+    ASSERT_EQ(values.size(), num_values);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1788,7 +1788,10 @@ TEST_F(XMLParserTests, getXMLBuiltinAttributes_NegativeClauses)
  * 1. Check an invalid tag of:
  *      <dbytesPerPeriod>
  *      <periodMillisecs>
+ *      <kind>
+ *      <burstBytes>
  * 2. Check invalid element
+ * 3. Check invalid kind
  */
 TEST_F(XMLParserTests, getXMLThroughputController_NegativeClauses)
 {
@@ -1818,6 +1821,8 @@ TEST_F(XMLParserTests, getXMLThroughputController_NegativeClauses)
     {
         "bytesPerPeriod",
         "periodMillisecs",
+        "kind",
+        "burstBytes",
     };
 
     for (std::string tag : field_vec)
@@ -1836,6 +1841,59 @@ TEST_F(XMLParserTests, getXMLThroughputController_NegativeClauses)
     titleElement = xml_doc.RootElement();
     EXPECT_EQ(XMLP_ret::XML_ERROR,
             XMLParserTest::getXMLThroughputController_wrapper(titleElement, throughputController, ident));
+
+    // Invalid kind
+    sprintf(xml, xml_p, "<kind>LEAKY_BUCKET</kind>");
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    titleElement = xml_doc.RootElement();
+    EXPECT_EQ(XMLP_ret::XML_ERROR,
+            XMLParserTest::getXMLThroughputController_wrapper(titleElement, throughputController, ident));
+}
+
+/*
+ * This test checks the positive case of configuration via XML of the throughput controller kinds.
+ * 1. Check that the XML return code is correct for each kind.
+ * 2. Check that the kind and the burst size are set.
+ */
+TEST_F(XMLParserTests, getXMLThroughputControllerKinds)
+{
+    uint8_t ident = 1;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // Parametrized XML
+    const char* xml_p =
+            "\
+            <throughputController>\
+                <bytesPerPeriod>8192</bytesPerPeriod>\
+                <periodMillisecs>10</periodMillisecs>\
+                <kind>%s</kind>\
+                <burstBytes>65536</burstBytes>\
+            </throughputController>\
+            ";
+    char xml[1000];
+
+    std::vector<std::pair<std::string, ThroughputControllerKind>> kinds =
+    {
+        {"FIXED_WINDOW", FIXED_WINDOW_THROUGHPUT_CONTROLLER},
+        {"TOKEN_BUCKET", TOKEN_BUCKET_THROUGHPUT_CONTROLLER},
+        {"PRIORITY", PRIORITY_THROUGHPUT_CONTROLLER},
+        {"FAIR_SHARE", FAIR_SHARE_THROUGHPUT_CONTROLLER},
+    };
+
+    for (const auto& kind : kinds)
+    {
+        ThroughputControllerDescriptor throughputController;
+        sprintf(xml, xml_p, kind.first.c_str());
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK,
+                XMLParserTest::getXMLThroughputController_wrapper(titleElement, throughputController, ident));
+        EXPECT_EQ(8192u, throughputController.bytesPerPeriod);
+        EXPECT_EQ(10u, throughputController.periodMillisecs);
+        EXPECT_EQ(kind.second, throughputController.kind);
+        EXPECT_EQ(65536u, throughputController.burstBytes);
+    }
 }
 
 /*
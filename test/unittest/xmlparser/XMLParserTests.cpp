@@ -559,6 +559,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <listen_threads>4</listen_threads>\
+                    <receive_batch_size>32</receive_batch_size>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -586,7 +588,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
                 </transport_descriptor>\
                 ";
-        char xml[2000];
+        char xml[3000];
 
         // UDPv4
         sprintf(xml, xml_p, "4");
@@ -600,6 +602,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->listen_threads, 4u);
+        EXPECT_EQ(pUDPv4Desc->receive_batch_size, 32u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -620,6 +624,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->listen_threads, 4u);
+        EXPECT_EQ(pUDPv6Desc->receive_batch_size, 32u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -660,6 +666,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <calculate_crc>false</calculate_crc>\
                     <check_crc>false</check_crc>\
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
+                    <io_threads>4</io_threads>\
                     <tls><!-- TLS Section --></tls>\
                 </transport_descriptor>\
                 ";
@@ -692,6 +699,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv4Desc->io_threads, 4u);
         xmlparser::XMLProfileManager::DeleteInstance();
 
         // TCPv6
@@ -717,6 +725,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv6Desc->io_threads, 4u);
         xmlparser::XMLProfileManager::DeleteInstance();
     }
 